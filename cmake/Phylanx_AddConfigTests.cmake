@@ -244,3 +244,11 @@ function(phylanx_check_for_cxx17_shared_ptr_array)
     SOURCE cmake/tests/cxx17_shared_ptr_array.cpp FILE ${ARGN}
   )
 endfunction()
+
+# ##############################################################################
+function(phylanx_check_for_cxx17_floating_point_from_chars)
+  add_phylanx_config_test(
+    PHYLANX_WITH_CXX17_FLOATING_POINT_FROM_CHARS
+    SOURCE cmake/tests/cxx17_floating_point_from_chars.cpp FILE ${ARGN}
+  )
+endfunction()
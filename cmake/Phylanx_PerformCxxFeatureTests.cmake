@@ -13,4 +13,8 @@ function(phylanx_perform_cxx_feature_tests)
   phylanx_check_for_cxx17_shared_ptr_array(
     DEFINITIONS PHYLANX_HAVE_CXX17_SHARED_PTR_ARRAY
   )
+
+  phylanx_check_for_cxx17_floating_point_from_chars(
+    DEFINITIONS PHYLANX_HAVE_CXX17_FLOATING_POINT_FROM_CHARS
+  )
 endfunction()
@@ -0,0 +1,17 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <charconv>
+#include <system_error>
+
+int main()
+{
+    char const str[] = "3.1415";
+    double value = 0.0;
+
+    auto result = std::from_chars(str, str + sizeof(str) - 1, value);
+    return result.ec == std::errc() ? 0 : 1;
+}
@@ -13,6 +13,7 @@
 
 #include <hpx/include/naming.hpp>
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -116,6 +117,16 @@ namespace phylanx { namespace execution_tree
         compiler::function_list& snippets,
         hpx::id_type const& default_locality = hpx::find_here());
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// The functions above that compile PhySL source code cache the generated
+    /// code and hand it out again whenever the same source is compiled for
+    /// the same target locality into the same function list. Code compiled
+    /// with a given environment is additionally reused only for the same
+    /// environment.
+    PHYLANX_EXPORT std::int64_t compile_cache_hits(bool reset);
+    PHYLANX_EXPORT std::int64_t compile_cache_misses(bool reset);
+    PHYLANX_EXPORT void clear_compile_cache();
+
     ///////////////////////////////////////////////////////////////////////////
     /// Add the given variable to the compilation environment
     PHYLANX_EXPORT compiler::function define_variable(
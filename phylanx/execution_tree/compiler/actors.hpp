@@ -640,6 +640,9 @@ namespace phylanx { namespace execution_tree { namespace compiler
           : compile_id_(0)
         {}
 
+        // releases the code cached for this function_list (see compile.cpp)
+        PHYLANX_EXPORT ~function_list();
+
         function_list(function_list const&) = delete;
         function_list(function_list &&) = delete;
 
@@ -466,6 +466,10 @@ namespace phylanx { namespace execution_tree { namespace compiler
             std::int64_t line_;
             std::int64_t column_;
             std::string codename_;
+
+            // the variable was defined from an expression that is known to
+            // produce an array
+            bool is_array_ = false;
         };
 
     private:
@@ -480,6 +484,7 @@ namespace phylanx { namespace execution_tree { namespace compiler
           : outer_(outer)
           , base_arg_num_(
                 outer != nullptr ? outer->base_arg_num_ + arg_num : arg_num)
+          , generation_(0)
         {}
 
         template <typename F>
@@ -518,6 +523,7 @@ namespace phylanx { namespace execution_tree { namespace compiler
                     "couldn't insert name into symbol table");
             }
 
+            ++generation_;
             return &result.first->second.f_;
         }
 
@@ -586,10 +592,23 @@ namespace phylanx { namespace execution_tree { namespace compiler
             return base_arg_num_;
         }
 
+        // the generation changes whenever a name is (re-)defined in this
+        // or any of the outer environments
+        std::size_t generation() const
+        {
+            std::size_t generation = generation_;
+            if (outer_ != nullptr)
+            {
+                generation += outer_->generation();
+            }
+            return generation;
+        }
+
     private:
         environment* outer_;
         map_type definitions_;
         std::size_t base_arg_num_;
+        std::size_t generation_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
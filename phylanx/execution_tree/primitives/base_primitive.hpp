@@ -269,6 +269,21 @@ namespace phylanx { namespace execution_tree
     PHYLANX_EXPORT bool is_numeric_operand_strict(
         primitive_argument_type const& val);
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The functions above expand sparse (compressed) data into dense arrays.
+    // Primitives that are able to operate on compressed data directly use the
+    // functions below, which leave sparse data as it is.
+    PHYLANX_EXPORT bool is_sparse_operand(primitive_argument_type const& val);
+
+    PHYLANX_EXPORT ir::node_data<double> extract_sparse_numeric_value(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT ir::node_data<double> extract_sparse_numeric_value(
+        primitive_argument_type && val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+
     ///////////////////////////////////////////////////////////////////////////
     PHYLANX_EXPORT std::size_t extract_numeric_value_dimension(
         primitive_argument_type const& val,
@@ -422,6 +437,76 @@ namespace phylanx { namespace execution_tree
     PHYLANX_EXPORT bool is_integer_operand_strict(
         primitive_argument_type const& val);
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Extract a ir::node_data<float> type from a given
+    // primitive_argument_type, convert other numeric types, throw if it
+    // doesn't hold a numeric value.
+    PHYLANX_EXPORT ir::node_data<float> extract_float32_value(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT ir::node_data<float> extract_float32_value(
+        primitive_argument_type&& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT float extract_scalar_float32_value(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT float extract_scalar_float32_value(
+        primitive_argument_type&& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+
+    // Extract a ir::node_data<float> type from a given
+    // primitive_argument_type, throw if it doesn't hold one.
+    PHYLANX_EXPORT ir::node_data<float> extract_float32_value_strict(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT ir::node_data<float> extract_float32_value_strict(
+        primitive_argument_type&& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+
+    PHYLANX_EXPORT bool is_float32_operand_strict(
+        primitive_argument_type const& val);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Extract a ir::node_data<std::int32_t> type from a given
+    // primitive_argument_type, convert other numeric types, throw if it
+    // doesn't hold a numeric value.
+    PHYLANX_EXPORT ir::node_data<std::int32_t> extract_int32_value(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT ir::node_data<std::int32_t> extract_int32_value(
+        primitive_argument_type&& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT std::int32_t extract_scalar_int32_value(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT std::int32_t extract_scalar_int32_value(
+        primitive_argument_type&& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+
+    // Extract a ir::node_data<std::int32_t> type from a given
+    // primitive_argument_type, throw if it doesn't hold one.
+    PHYLANX_EXPORT ir::node_data<std::int32_t> extract_int32_value_strict(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT ir::node_data<std::int32_t> extract_int32_value_strict(
+        primitive_argument_type&& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+
+    PHYLANX_EXPORT bool is_int32_operand_strict(
+        primitive_argument_type const& val);
+
     ///////////////////////////////////////////////////////////////////////////
     PHYLANX_EXPORT std::int64_t extract_scalar_positive_integer_value(
         primitive_argument_type const& val,
@@ -529,6 +614,20 @@ namespace phylanx { namespace execution_tree
     {
         return extract_boolean_value(val, name, codename);
     }
+    template <>
+    inline ir::node_data<float> extract_node_data(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_float32_value(val, name, codename);
+    }
+    template <>
+    inline ir::node_data<std::int32_t> extract_node_data(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_int32_value(val, name, codename);
+    }
 
     template <typename T>
     ir::node_data<T> extract_node_data(primitive_argument_type&& val,
@@ -556,6 +655,20 @@ namespace phylanx { namespace execution_tree
     {
         return extract_boolean_value(std::move(val), name, codename);
     }
+    template <>
+    inline ir::node_data<float> extract_node_data(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_float32_value(std::move(val), name, codename);
+    }
+    template <>
+    inline ir::node_data<std::int32_t> extract_node_data(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_int32_value(std::move(val), name, codename);
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
@@ -584,6 +697,20 @@ namespace phylanx { namespace execution_tree
     {
         return extract_boolean_value_strict(val, name, codename);
     }
+    template <>
+    inline ir::node_data<float> extract_node_data_strict(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_float32_value_strict(val, name, codename);
+    }
+    template <>
+    inline ir::node_data<std::int32_t> extract_node_data_strict(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_int32_value_strict(val, name, codename);
+    }
 
     template <typename T>
     ir::node_data<T> extract_node_data_strict(primitive_argument_type&& val,
@@ -611,6 +738,20 @@ namespace phylanx { namespace execution_tree
     {
         return extract_boolean_value_strict(std::move(val), name, codename);
     }
+    template <>
+    inline ir::node_data<float> extract_node_data_strict(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_float32_value_strict(std::move(val), name, codename);
+    }
+    template <>
+    inline ir::node_data<std::int32_t> extract_node_data_strict(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_int32_value_strict(std::move(val), name, codename);
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
@@ -636,6 +777,18 @@ namespace phylanx { namespace execution_tree
     {
         return extract_scalar_boolean_value(val, name, codename);
     }
+    template <>
+    inline float extract_scalar_data(primitive_argument_type const& val,
+        std::string const& name, std::string const& codename)
+    {
+        return extract_scalar_float32_value(val, name, codename);
+    }
+    template <>
+    inline std::int32_t extract_scalar_data(primitive_argument_type const& val,
+        std::string const& name, std::string const& codename)
+    {
+        return extract_scalar_int32_value(val, name, codename);
+    }
 
     template <typename T>
     T extract_scalar_data(primitive_argument_type&& val,
@@ -660,6 +813,18 @@ namespace phylanx { namespace execution_tree
     {
         return extract_scalar_boolean_value(std::move(val), name, codename);
     }
+    template <>
+    inline float extract_scalar_data(primitive_argument_type&& val,
+        std::string const& name, std::string const& codename)
+    {
+        return extract_scalar_float32_value(std::move(val), name, codename);
+    }
+    template <>
+    inline std::int32_t extract_scalar_data(primitive_argument_type&& val,
+        std::string const& name, std::string const& codename)
+    {
+        return extract_scalar_int32_value(std::move(val), name, codename);
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
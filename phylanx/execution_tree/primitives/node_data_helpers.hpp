@@ -25,14 +25,39 @@
 namespace phylanx { namespace execution_tree
 {
     ///////////////////////////////////////////////////////////////////////////
+    // The common type of several arguments is the one with the smallest
+    // value, i.e. mixing single precision values with double precision values
+    // yields double precision results. As for numpy, mixing single precision
+    // values with (32 or 64 bit) integers yields double precision results as
+    // well, since single precision can't represent all integers exactly (see
+    // common_data_type below).
     enum node_data_type
     {
         node_data_type_double = 0,
-        node_data_type_int64 = 1,
-        node_data_type_bool = 2,
-        node_data_type_unknown = 3,     // must be largest value
+        node_data_type_float32 = 1,
+        node_data_type_int64 = 2,
+        node_data_type_int32 = 3,
+        node_data_type_bool = 4,
+        node_data_type_unknown = 5,     // must be largest value
     };
 
+    /// Return the data type to be used for the result of an operation
+    /// involving arguments of the two given types.
+    inline node_data_type common_data_type(
+        node_data_type lhs, node_data_type rhs)
+    {
+        if (lhs > rhs)
+        {
+            std::swap(lhs, rhs);
+        }
+        if (lhs == node_data_type_float32 &&
+            (rhs == node_data_type_int64 || rhs == node_data_type_int32))
+        {
+            return node_data_type_double;
+        }
+        return lhs;
+    }
+
     /// Extract node_data_type from a primitive name
     PHYLANX_EXPORT node_data_type map_dtype(std::string const& spec);
     PHYLANX_EXPORT node_data_type extract_dtype(std::string name);
@@ -52,12 +77,17 @@ namespace phylanx { namespace execution_tree
     template <typename... Ts>
     node_data_type extract_common_type(Ts const&... args)
     {
-        int const __dummy[] = {
+        node_data_type const __dummy[] = {
             extract_common_type(args)...,
             node_data_type_unknown
         };
-        return node_data_type(
-            *std::min_element(&__dummy[0], &__dummy[sizeof...(args)]));
+
+        node_data_type result = node_data_type_unknown;
+        for (std::size_t i = 0; i != sizeof...(args); ++i)
+        {
+            result = common_data_type(result, __dummy[i]);
+        }
+        return result;
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -377,6 +377,8 @@ namespace phylanx { namespace execution_tree
           , util::recursive_wrapper<hpx::shared_future<primitive_argument_type>>
           , ir::range
           , phylanx::ir::dictionary
+          , ir::node_data<float>
+          , ir::node_data<std::int32_t>
         >;
 
     PHYLANX_EXPORT primitive_argument_type extract_copy_value(
@@ -397,7 +399,9 @@ namespace phylanx { namespace execution_tree
             primitive_index = 5,
             future_index = 6,
             list_index = 7,
-            dictionary_index = 8
+            dictionary_index = 8,
+            float32_index = 9,
+            int32_index = 10
         };
 
         using annotation_ptr = std::shared_ptr<execution_tree::annotation>;
@@ -707,6 +711,42 @@ namespace phylanx { namespace execution_tree
           , annotation_(ann)
         {}
 
+        // float
+        primitive_argument_type(ir::node_data<float> const& val)
+          : argument_value_type{val}
+        {}
+        primitive_argument_type(ir::node_data<float>&& val)
+          : argument_value_type{std::move(val)}
+        {}
+        primitive_argument_type(ir::node_data<float> const& val,
+                annotation_ptr const& ann)
+          : argument_value_type{val}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(ir::node_data<float>&& val,
+                annotation_ptr const& ann)
+          : argument_value_type{std::move(val)}
+          , annotation_(ann)
+        {}
+
+        // std::int32_t
+        primitive_argument_type(ir::node_data<std::int32_t> const& val)
+          : argument_value_type{val}
+        {}
+        primitive_argument_type(ir::node_data<std::int32_t>&& val)
+          : argument_value_type{std::move(val)}
+        {}
+        primitive_argument_type(ir::node_data<std::int32_t> const& val,
+                annotation_ptr const& ann)
+          : argument_value_type{val}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(ir::node_data<std::int32_t>&& val,
+                annotation_ptr const& ann)
+          : argument_value_type{std::move(val)}
+          , annotation_(ann)
+        {}
+
         // primitive
         primitive_argument_type(primitive const& val)
           : argument_value_type{val}
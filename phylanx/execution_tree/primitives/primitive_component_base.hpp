@@ -98,6 +98,7 @@ namespace phylanx { namespace execution_tree
             std::int64_t get_eval_count(bool reset) const;
             std::int64_t get_eval_duration(bool reset) const;
             std::int64_t get_direct_execution(bool reset) const;
+            std::int64_t get_direct_execution_decisions(bool reset) const;
 
             virtual std::int64_t get_transferred_bytes(bool reset) const;
 
@@ -106,6 +107,13 @@ namespace phylanx { namespace execution_tree
             // decide whether to execute eval directly
             hpx::launch select_direct_eval_execution(hpx::launch policy) const;
 
+            // decide whether the current invocation of eval should be timed
+            bool enable_eval_timer() const;
+
+            // re-evaluate the direct execution decision based on the
+            // measurements collected since the last decision
+            void update_direct_execution() const;
+
             // A primitive was constructed with no operands if the list of
             // operands is empty or the only provided operand is 'nil' (used
             // for function invocations like 'func()').
@@ -132,6 +140,8 @@ namespace phylanx { namespace execution_tree
             static std::int64_t get_ec_threshold();
             static std::int64_t get_exec_upper_threshold();
             static std::int64_t get_exec_lower_threshold();
+            static bool get_adaptive_direct_execution();
+            static std::int64_t get_eval_sample_interval();
 
         protected:
             static primitive_arguments_type noargs;
@@ -144,6 +154,9 @@ namespace phylanx { namespace execution_tree
             mutable std::int64_t eval_count_;
             mutable std::int64_t eval_duration_;
             mutable std::int64_t execute_directly_;
+            mutable std::int64_t direct_execution_decisions_;
+            mutable std::int64_t eval_sample_countdown_;
+            bool const eval_direct_;        // always execute eval directly
             bool measurements_enabled_;
 
 #if defined(HPX_HAVE_APEX)
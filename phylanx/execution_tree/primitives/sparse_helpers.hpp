@@ -0,0 +1,73 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_EXECUTION_TREE_SPARSE_HELPERS)
+#define PHYLANX_EXECUTION_TREE_SPARSE_HELPERS
+
+#include <phylanx/config.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <type_traits>
+#include <utility>
+
+#include <blaze/Math.h>
+
+namespace phylanx { namespace execution_tree
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Invoke the given function with either the compressed or the dense
+    // representation of the given 1-dimensional or 2-dimensional array.
+    template <typename T, typename F>
+    decltype(auto) visit_sparse_or_dense(ir::node_data<T>& nd, F&& f)
+    {
+        switch (nd.index())
+        {
+        case ir::node_data<T>::sparse_storage1d:
+            return std::forward<F>(f)(nd.sparse_vector());
+
+        case ir::node_data<T>::sparse_storage2d:
+            return std::forward<F>(f)(nd.sparse_matrix());
+
+        default:
+            break;
+        }
+
+        if (nd.num_dimensions() == 1)
+        {
+            return std::forward<F>(f)(nd.vector());
+        }
+        return std::forward<F>(f)(nd.matrix());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Evaluate the given blaze expression into a new instance of node_data.
+    // The result is stored in compressed form only if blaze decided that the
+    // expression is sparse (e.g. the sum of two sparse matrices).
+    template <typename T, typename Expr>
+    typename std::enable_if<blaze::IsVector<Expr>::value,
+        ir::node_data<T>>::type
+    sparse_or_dense_result(Expr const& expr)
+    {
+        using result_type =
+            typename std::conditional<blaze::IsSparseVector<Expr>::value,
+                blaze::CompressedVector<T>, blaze::DynamicVector<T>>::type;
+
+        return ir::node_data<T>{result_type(expr)};
+    }
+
+    template <typename T, typename Expr>
+    typename std::enable_if<blaze::IsMatrix<Expr>::value,
+        ir::node_data<T>>::type
+    sparse_or_dense_result(Expr const& expr)
+    {
+        using result_type =
+            typename std::conditional<blaze::IsSparseMatrix<Expr>::value,
+                blaze::CompressedMatrix<T>, blaze::DynamicMatrix<T>>::type;
+
+        return ir::node_data<T>{result_type(expr)};
+    }
+}}
+
+#endif
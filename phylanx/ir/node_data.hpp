@@ -141,10 +141,14 @@ namespace phylanx { namespace ir
         using custom_storage4d_type =
             blaze::CustomArray<4UL, T, blaze::aligned, blaze::padded>;
 
+        using sparse_storage1d_type = blaze::CompressedVector<T>;
+        using sparse_storage2d_type = blaze::CompressedMatrix<T>;
+
         using storage_type = util::variant<storage0d_type, storage1d_type,
             storage2d_type, storage3d_type, storage4d_type,
             custom_storage0d_type, custom_storage1d_type, custom_storage2d_type,
-            custom_storage3d_type, custom_storage4d_type>;
+            custom_storage3d_type, custom_storage4d_type,
+            sparse_storage1d_type, sparse_storage2d_type>;
 
         enum variant_index
         {
@@ -157,7 +161,9 @@ namespace phylanx { namespace ir
             custom_storage1d = 6,
             custom_storage2d = 7,
             custom_storage3d = 8,
-            custom_storage4d = 9
+            custom_storage4d = 9,
+            sparse_storage1d = 10,
+            sparse_storage2d = 11
         };
 
         using dimensions_type = std::array<std::size_t, max_dimensions>;
@@ -202,6 +208,13 @@ namespace phylanx { namespace ir
         explicit node_data(custom_storage4d_type const& values);
         explicit node_data(custom_storage4d_type && values);
 
+        /// Create node data for a sparse 1-dimensional or 2-dimensional value
+        explicit node_data(sparse_storage1d_type const& values);
+        explicit node_data(sparse_storage1d_type && values);
+
+        explicit node_data(sparse_storage2d_type const& values);
+        explicit node_data(sparse_storage2d_type && values);
+
         // conversion helpers for Python bindings and AST parsing
         explicit node_data(std::vector<T> const& values);
         explicit node_data(std::vector<std::vector<T>> const& values);
@@ -236,9 +249,7 @@ namespace phylanx { namespace ir
         template <typename U>
         static storage_type init_data_from_type(node_data<U> const& d)
         {
-            std::size_t dims = d.num_dimensions();
-
-            switch (dims)
+            switch (d.index())
             {
             case storage0d:         HPX_FALLTHROUGH;
             case custom_storage0d:
@@ -249,11 +260,19 @@ namespace phylanx { namespace ir
                 increment_copy_construction_count();
                 return storage_type(d.vector());
 
+            case sparse_storage1d:
+                increment_copy_construction_count();
+                return storage_type(sparse_storage1d_type(d.sparse_vector()));
+
             case storage2d:         HPX_FALLTHROUGH;
             case custom_storage2d:
                 increment_copy_construction_count();
                 return storage_type(d.matrix());
 
+            case sparse_storage2d:
+                increment_copy_construction_count();
+                return storage_type(sparse_storage2d_type(d.sparse_matrix()));
+
             case storage3d:         HPX_FALLTHROUGH;
             case custom_storage3d:
                 increment_copy_construction_count();
@@ -310,6 +329,13 @@ namespace phylanx { namespace ir
 
         node_data& operator=(custom_storage4d_type const& val);
         node_data& operator=(custom_storage4d_type && val);
+
+        node_data& operator=(sparse_storage1d_type const& val);
+        node_data& operator=(sparse_storage1d_type && val);
+
+        node_data& operator=(sparse_storage2d_type const& val);
+        node_data& operator=(sparse_storage2d_type && val);
+
         // conversion helpers for Python bindings and AST parsing
         node_data& operator=(std::vector<T> const& val);
         node_data& operator=(std::vector<std::vector<T>> const& values);
@@ -415,6 +441,27 @@ namespace phylanx { namespace ir
         storage0d_type& scalar_non_ref();
         storage0d_type const& scalar_non_ref() const;
 
+        /// Access the compressed representation of sparse data. The dense
+        /// accessors above (vector(), matrix(), etc.) are not available for
+        /// sparse data, use dense() to obtain an expanded instance instead.
+        sparse_storage1d_type& sparse_vector();
+        sparse_storage1d_type const& sparse_vector() const;
+
+        sparse_storage2d_type& sparse_matrix();
+        sparse_storage2d_type const& sparse_matrix() const;
+
+        /// Return whether the underlying data is stored in compressed form
+        bool is_sparse() const
+        {
+            return data_.index() == sparse_storage1d ||
+                data_.index() == sparse_storage2d;
+        }
+
+        /// Return a dense instance of node_data holding the same values. Dense
+        /// data is referred to, sparse data is expanded into a new array.
+        node_data<T> dense() const&;
+        node_data<T> dense() &&;
+
         /// Extract the dimensionality of the underlying data array.
         std::size_t num_dimensions() const;
 
@@ -492,6 +539,10 @@ namespace phylanx { namespace ir
         node_data<std::uint8_t> const& lhs, node_data<std::uint8_t> const& rhs);
     PHYLANX_EXPORT bool operator==(
         node_data<std::int64_t> const& lhs, node_data<std::int64_t> const& rhs);
+    PHYLANX_EXPORT bool operator==(
+        node_data<float> const& lhs, node_data<float> const& rhs);
+    PHYLANX_EXPORT bool operator==(
+        node_data<std::int32_t> const& lhs, node_data<std::int32_t> const& rhs);
 
     template <typename T>
     bool operator!=(node_data<T> const& lhs, node_data<T> const& rhs)
@@ -518,6 +569,23 @@ namespace phylanx { namespace ir
         return lhs == rhs;
     }
 
+    inline bool allclose(node_data<std::int32_t> const& lhs,
+        node_data<std::int32_t> const& rhs, double rtol = 0, double atol = 0,
+        bool equal_nan = false)
+    {
+        return lhs == rhs;
+    }
+
+    // single precision values are compared after widening them, the default
+    // tolerance accounts for the reduced precision
+    inline bool allclose(node_data<float> const& lhs,
+        node_data<float> const& rhs, double rtol = 1e-4, double atol = 1e-6,
+        bool equal_nan = false)
+    {
+        return allclose(node_data<double>(lhs), node_data<double>(rhs), rtol,
+            atol, equal_nan);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     PHYLANX_EXPORT std::ostream& operator<<(
         std::ostream& out, node_data<double> const& nd);
@@ -525,6 +593,10 @@ namespace phylanx { namespace ir
         std::ostream& out, node_data<std::uint8_t> const& nd);
     PHYLANX_EXPORT std::ostream& operator<<(
         std::ostream& out, node_data<std::int64_t> const& nd);
+    PHYLANX_EXPORT std::ostream& operator<<(
+        std::ostream& out, node_data<float> const& nd);
+    PHYLANX_EXPORT std::ostream& operator<<(
+        std::ostream& out, node_data<std::int32_t> const& nd);
 }}
 
 #endif
@@ -11,6 +11,8 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
 #include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/kmeans_operations.hpp>
 
 #include <hpx/futures/future.hpp>
 
@@ -28,6 +30,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
     /// Creates a primitive executing the kmeans algorithm on the given
     /// input data
     ///
+    /// The points are processed in blocks, concurrently. The distances of
+    /// a block of points to all centroids are computed using a single matrix
+    /// multiplication (|x|^2 - 2 x.c + |c|^2).
+    ///
     class kmeans
       : public primitive_component_base
       , public std::enable_shared_from_this<kmeans>
@@ -48,18 +54,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::string const& name, std::string const& codename);
 
     protected:
+        using points_type = common::kmeans_points_type;
+
         blaze::DynamicMatrix<double> initialize_centroids(
-            blaze::DynamicMatrix<double> const& points, std::size_t num_points,
-            std::size_t num_centroids) const;
-        blaze::DynamicVector<std::size_t> closest_centroids(
-            blaze::DynamicMatrix<double> const& points,
-            blaze::DynamicMatrix<double> const& centroids,
-            std::size_t num_points, std::size_t num_centroids) const;
-        blaze::DynamicMatrix<double> move_centroids(
-            blaze::DynamicMatrix<double> const& points,
-            blaze::DynamicVector<std::size_t>&& closest,
-            blaze::DynamicMatrix<double>&& centroids, std::size_t num_points,
-            std::size_t num_centroids) const;
+            points_type const& points, std::size_t num_centroids) const;
+        blaze::DynamicMatrix<double> initialize_centroids_plusplus(
+            points_type const& points, std::size_t num_centroids) const;
 
         primitive_argument_type calculate_kmeans(
             primitive_arguments_type&& args) const;
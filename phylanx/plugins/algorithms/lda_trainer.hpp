@@ -31,6 +31,8 @@
 #include <numeric>
 #include <algorithm>
 #include <iostream>
+#include <random>
+#include <vector>
 
 #include <blaze/Blaze.h>
 
@@ -49,18 +51,45 @@ class lda_trainer_impl {
         alpha(alpha_), beta(beta_) {
     }
 
-    static void gibbs(
-        const blaze::DynamicMatrix<double> & word_doc_mat,
-        const double alpha,
-        const double beta,
-        blaze::DynamicVector<std::int64_t> & z,
-        blaze::DynamicMatrix<double> & wp0,
-        blaze::DynamicMatrix<double> & dp,
-        blaze::DynamicVector<double, blaze::rowVector> & ztot);
-
     using dmatrix_t = blaze::DynamicMatrix<double>;
     using dvector_t = blaze::DynamicVector<double>;
     using i64vector_t = blaze::DynamicVector<std::int64_t>;
+    using rowvector_t = blaze::DynamicVector<double, blaze::rowVector>;
+
+    // the word instances of the word-document matrix in document order,
+    // the words of document d are
+    // words[doc_offsets[d]] ... words[doc_offsets[d+1]-1]
+    //
+    struct corpus {
+        std::vector<std::int64_t> doc_offsets;
+        std::vector<std::int64_t> words;
+    };
+
+    // a block of documents sampled by one HPX thread (AD-LDA), all
+    // buffers are allocated once and reused in every iteration
+    //
+    struct partition {
+        std::int64_t first_doc, last_doc;
+
+        // distinct words of the documents of this partition, local_words
+        // maps each word instance to its row in wp
+        std::vector<std::int64_t> vocabulary;
+        std::vector<std::int64_t> local_words;
+
+        dmatrix_t wp;           // word-topic counts of the vocabulary
+        rowvector_t ztot;       // topic counts
+        dvector_t probs;        // cumulative topic probabilities
+        std::mt19937 rng;
+    };
+
+    static void gibbs(
+        const corpus & docs,
+        const double alpha,
+        const double beta,
+        const std::int64_t W,
+        i64vector_t & z,
+        dmatrix_t & dp,
+        partition & part);
 
     std::tuple<dmatrix_t, dmatrix_t> operator()(
         const dmatrix_t & word_doc_mat,
@@ -0,0 +1,92 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_FUSED_ELEMENTWISE)
+#define PHYLANX_PRIMITIVES_FUSED_ELEMENTWISE
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    namespace detail
+    {
+        enum class fused_opcode : std::uint8_t
+        {
+            operand,
+            add, sub, mul, div,
+            less, less_equal, greater, greater_equal, equal, not_equal,
+            logical_and, logical_or,
+            negate, logical_not
+        };
+
+        struct fused_instruction
+        {
+            fused_opcode opcode_;
+            std::size_t operand_;       // index of operand (if 'operand')
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // __fused_elementwise(program, operands...) evaluates a tree of element-
+    // wise arithmetic, comparison, and logical operations in one pass. The
+    // program is given in postfix notation, where integer tokens refer to
+    // the operands (starting at 1). The compiler generates this primitive
+    // for expressions like 'a * b + c - d'.
+    class fused_elementwise
+      : public primitive_component_base
+      , public std::enable_shared_from_this<fused_elementwise>
+    {
+    public:
+        static match_pattern_type const match_data;
+
+        fused_elementwise() = default;
+
+        fused_elementwise(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    protected:
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+
+    private:
+        void parse_program(std::string const& program);
+        void create_fallback();
+
+        bool evaluate_fused(primitive_arguments_type const& ops,
+            primitive_argument_type& result) const;
+        hpx::future<primitive_argument_type> evaluate_generic(
+            primitive_arguments_type&& ops, eval_context ctx) const;
+
+        std::vector<detail::fused_instruction> program_;
+        std::vector<std::size_t> uses_;     // number of uses of each operand
+        std::size_t max_depth_ = 0;         // maximal evaluation stack depth
+
+        // the primitives implementing each of the operations (nullptr for
+        // operands), used if the fused evaluation can't be applied
+        std::vector<std::shared_ptr<primitive_component_base>> fallback_;
+    };
+
+    inline primitive create_fused_elementwise(hpx::id_type const& locality,
+        primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(locality, "__fused_elementwise",
+            std::move(operands), name, codename);
+    }
+}}}
+
+#endif
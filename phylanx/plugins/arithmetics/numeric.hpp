@@ -82,6 +82,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
         template <typename T>
         primitive_argument_type numeric3d3d(args_type<T> && args) const;
 
+        // at least one of the operands of equal shape is sparse
+        primitive_argument_type numeric_sparse(
+            primitive_argument_type&& op1, primitive_argument_type&& op2) const;
+
     protected:
         template <typename T>
         primitive_argument_type handle_numeric_operands_helper(
@@ -11,6 +11,7 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/annotation.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/execution_tree/primitives/sparse_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/ir/ranges.hpp>
 #include <phylanx/plugins/arithmetics/numeric.hpp>
@@ -24,6 +25,7 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -335,6 +337,88 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 name_, codename_));
     }
 
+    namespace detail
+    {
+        // Operations that map zeros to zero announce this by defining a
+        // constant 'sparse_operands', only those may keep sparse data sparse.
+        template <typename Op, typename Enable = void>
+        struct supports_sparse_operands : std::false_type
+        {
+        };
+
+        template <typename Op>
+        struct supports_sparse_operands<Op,
+                typename std::enable_if<Op::sparse_operands>::type>
+          : std::true_type
+        {
+        };
+
+        template <typename Op, typename T1, typename T2,
+            typename Enable = void>
+        struct is_numeric_op_callable : std::false_type
+        {
+        };
+
+        template <typename Op, typename T1, typename T2>
+        struct is_numeric_op_callable<Op, T1, T2,
+                decltype(void(Op{}(std::declval<T1 const&>(),
+                    std::declval<T2 const&>())))>
+          : std::true_type
+        {
+        };
+
+        // return false if the operation is not defined for the given
+        // combination of sparse and dense operands
+        template <typename Op, typename T1, typename T2>
+        typename std::enable_if<is_numeric_op_callable<Op, T1, T2>::value,
+            bool>::type
+        numeric_sparse(
+            T1 const& lhs, T2 const& rhs, ir::node_data<double>& result)
+        {
+            result = sparse_or_dense_result<double>(Op{}(lhs, rhs));
+            return true;
+        }
+
+        template <typename Op, typename T1, typename T2>
+        typename std::enable_if<!is_numeric_op_callable<Op, T1, T2>::value,
+            bool>::type
+        numeric_sparse(T1 const&, T2 const&, ir::node_data<double>&)
+        {
+            return false;
+        }
+    }
+
+    template <typename Op, typename Derived>
+    primitive_argument_type numeric<Op, Derived>::numeric_sparse(
+        primitive_argument_type&& op1, primitive_argument_type&& op2) const
+    {
+        auto lhs =
+            extract_sparse_numeric_value(std::move(op1), name_, codename_);
+        auto rhs =
+            extract_sparse_numeric_value(std::move(op2), name_, codename_);
+
+        ir::node_data<double> result;
+        bool handled = visit_sparse_or_dense(lhs,
+            [&](auto const& l) -> bool
+            {
+                return visit_sparse_or_dense(rhs,
+                    [&](auto const& r) -> bool
+                    {
+                        return detail::numeric_sparse<Op>(l, r, result);
+                    });
+            });
+
+        if (handled)
+        {
+            return primitive_argument_type{std::move(result)};
+        }
+
+        // fall back to operating on the expanded data
+        return derived().template handle_numeric_operands_helper<double>(
+            primitive_argument_type{std::move(lhs).dense()},
+            primitive_argument_type{std::move(rhs).dense()});
+    }
+
     template <typename Op, typename Derived>
     primitive_argument_type numeric<Op, Derived>::handle_numeric_operands(
         primitive_argument_type&& op1, primitive_argument_type&& op2) const
@@ -345,6 +429,17 @@ namespace phylanx { namespace execution_tree { namespace primitives
             t = extract_common_type(op1, op2);
         }
 
+        // sparse operands of the same shape are combined without expanding
+        // them (broadcasting always operates on dense data)
+        if (detail::supports_sparse_operands<Op>::value &&
+            t == node_data_type_double &&
+            (is_sparse_operand(op1) || is_sparse_operand(op2)) &&
+            extract_numeric_value_dimensions(op1, name_, codename_) ==
+                extract_numeric_value_dimensions(op2, name_, codename_))
+        {
+            return numeric_sparse(std::move(op1), std::move(op2));
+        }
+
         switch (t)
         {
         case node_data_type_bool:
@@ -352,11 +447,20 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 .template handle_numeric_operands_helper<std::uint8_t>(
                     std::move(op1), std::move(op2));
 
+        case node_data_type_int32:
+            return derived()
+                .template handle_numeric_operands_helper<std::int32_t>(
+                    std::move(op1), std::move(op2));
+
         case node_data_type_int64:
             return derived()
                 .template handle_numeric_operands_helper<std::int64_t>(
                     std::move(op1), std::move(op2));
 
+        case node_data_type_float32:
+            return derived().template handle_numeric_operands_helper<float>(
+                std::move(op1), std::move(op2));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return derived().template handle_numeric_operands_helper<double>(
@@ -464,11 +568,20 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 .template handle_numeric_operands_helper<std::uint8_t>(
                     std::move(ops));
 
+        case node_data_type_int32:
+            return derived()
+                .template handle_numeric_operands_helper<std::int32_t>(
+                    std::move(ops));
+
         case node_data_type_int64:
             return derived()
                 .template handle_numeric_operands_helper<std::int64_t>(
                     std::move(ops));
 
+        case node_data_type_float32:
+            return derived().template handle_numeric_operands_helper<float>(
+                std::move(ops));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return derived().template handle_numeric_operands_helper<double>(
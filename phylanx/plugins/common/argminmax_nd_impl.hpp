@@ -78,12 +78,14 @@ namespace phylanx { namespace common {
                     std::move(args[0]), name, codename),
                 axis, name, codename);
 
+        case execution_tree::node_data_type_int32: HPX_FALLTHROUGH;
         case execution_tree::node_data_type_int64:
             return detail::argminmax0d<Operation>(numargs,
                 execution_tree::extract_integer_value_strict(
                     std::move(args[0]), name, codename),
                 axis, name, codename);
 
+        case execution_tree::node_data_type_float32: HPX_FALLTHROUGH;
         case execution_tree::node_data_type_double:
             return detail::argminmax0d<Operation>(numargs,
                 execution_tree::extract_numeric_value_strict(
@@ -180,12 +182,14 @@ namespace phylanx { namespace common {
                     std::move(args[0]), name, codename),
                 axis, value, name, codename);
 
+        case execution_tree::node_data_type_int32: HPX_FALLTHROUGH;
         case execution_tree::node_data_type_int64:
             return detail::argminmax1d<Operation>(numargs,
                 execution_tree::extract_integer_value_strict(
                     std::move(args[0]), name, codename),
                 axis, value, name, codename);
 
+        case execution_tree::node_data_type_float32: HPX_FALLTHROUGH;
         case execution_tree::node_data_type_double:
             return detail::argminmax1d<Operation>(numargs,
                 execution_tree::extract_numeric_value_strict(
@@ -419,12 +423,14 @@ namespace phylanx { namespace common {
                     std::move(args[0]), name, codename),
                 axis, value, name, codename);
 
+        case execution_tree::node_data_type_int32: HPX_FALLTHROUGH;
         case execution_tree::node_data_type_int64:
             return detail::argminmax2d<Operation>(numargs,
                 execution_tree::extract_integer_value_strict(
                     std::move(args[0]), name, codename),
                 axis, value, name, codename);
 
+        case execution_tree::node_data_type_float32: HPX_FALLTHROUGH;
         case execution_tree::node_data_type_double:
             return detail::argminmax2d<Operation>(numargs,
                 execution_tree::extract_numeric_value_strict(
@@ -651,12 +657,14 @@ namespace phylanx { namespace common {
                     std::move(args[0]), name, codename),
                 axis, name, codename);
 
+        case execution_tree::node_data_type_int32: HPX_FALLTHROUGH;
         case execution_tree::node_data_type_int64:
             return detail::argminmax3d<Operation>(numargs,
                 execution_tree::extract_integer_value_strict(
                     std::move(args[0]), name, codename),
                 axis, name, codename);
 
+        case execution_tree::node_data_type_float32: HPX_FALLTHROUGH;
         case execution_tree::node_data_type_double:
             return detail::argminmax3d<Operation>(numargs,
                 execution_tree::extract_numeric_value_strict(
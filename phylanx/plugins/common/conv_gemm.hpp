@@ -0,0 +1,84 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_COMMON_CONV_GEMM)
+#define PHYLANX_COMMON_CONV_GEMM
+
+#include <phylanx/config.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/export_definitions.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
+namespace phylanx { namespace common {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Describes how the filter is placed over the (implicitly zero-padded)
+    // input. Output element (i, j) sees the input elements
+    // (i * stride_height - pad_top + p * dilation_height,
+    //  j * stride_width - pad_left + q * dilation_width) for all filter
+    // positions (p, q).
+    struct conv_geometry
+    {
+        std::int64_t pad_top = 0;
+        std::int64_t pad_left = 0;
+        std::int64_t stride_height = 1;
+        std::int64_t stride_width = 1;
+        std::int64_t dilation_height = 1;
+        std::int64_t dilation_width = 1;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // All convolutions below lower the input into a patch matrix (im2col)
+    // and compute the result with matrix multiplications per batch item. The
+    // batch items are processed concurrently. conv2d_gemm and conv1d_gemm
+    // additionally compute blocks of output channels concurrently.
+
+    // arg: (batch, in_height, in_width, in_channels)
+    // kernel: (filter_height, filter_width, in_channels, out_channels)
+    // result: (batch, res_height, res_width, out_channels)
+    PHYLANX_COMMON_EXPORT blaze::DynamicArray<4UL, double> conv2d_gemm(
+        ir::node_data<double> const& arg, ir::node_data<double> const& kernel,
+        std::size_t res_height, std::size_t res_width,
+        conv_geometry const& geometry);
+
+    // arg: (batch, in_height, in_width, in_channels)
+    // kernel: (filter_height, filter_width, out_channels, in_channels)
+    // result: (batch, res_height, res_width, out_channels)
+    //
+    // Input element (i, j) contributes to the output element
+    // (i * stride_height - pad_top + p * dilation_height,
+    //  j * stride_width - pad_left + q * dilation_width), i.e. the geometry
+    // is the one of the corresponding forward convolution.
+    PHYLANX_COMMON_EXPORT blaze::DynamicArray<4UL, double>
+    conv2d_transpose_gemm(ir::node_data<double> const& arg,
+        ir::node_data<double> const& kernel, std::size_t res_height,
+        std::size_t res_width, conv_geometry const& geometry);
+
+    // arg: (batch, length, in_channels)
+    // kernel: (filter_length, in_channels, out_channels)
+    // result: (batch, res_length, out_channels)
+    PHYLANX_COMMON_EXPORT blaze::DynamicTensor<double> conv1d_gemm(
+        ir::node_data<double> const& arg, ir::node_data<double> const& kernel,
+        std::size_t res_length, std::int64_t pad_left, std::int64_t strides,
+        std::int64_t dilation_rate);
+
+    // arg: (batch, length, in_channels)
+    // depth_kernel: (filter_length, in_channels, depth_multiplier)
+    // point_kernel: (1, in_channels * depth_multiplier, out_channels)
+    // result: (batch, res_length, out_channels)
+    PHYLANX_COMMON_EXPORT blaze::DynamicTensor<double> separable_conv1d_gemm(
+        ir::node_data<double> const& arg,
+        ir::node_data<double> const& depth_kernel,
+        ir::node_data<double> const& point_kernel, std::size_t res_length,
+        std::int64_t pad_left, std::int64_t strides,
+        std::int64_t dilation_rate);
+}}
+
+#endif
@@ -0,0 +1,56 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_COMMON_KMEANS_OPERATIONS)
+#define PHYLANX_COMMON_KMEANS_OPERATIONS
+
+#include <phylanx/config.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/export_definitions.hpp>
+
+#include <cstddef>
+
+#include <blaze/Math.h>
+
+namespace phylanx { namespace common {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The k-means building blocks below process the points in blocks of
+    // kmeans_block_size rows, concurrently.
+    constexpr std::size_t kmeans_block_size = 1024;
+
+    using kmeans_points_type = ir::node_data<double>::custom_storage2d_type;
+
+    // Assign each point to its closest centroid. The distances of a block of
+    // points to all centroids are computed using a single matrix
+    // multiplication (|x|^2 - 2 x.c + |c|^2, where |x|^2 is omitted as it
+    // does not influence which centroid is the closest one).
+    PHYLANX_COMMON_EXPORT blaze::DynamicVector<std::size_t>
+    kmeans_closest_centroids(kmeans_points_type const& points,
+        blaze::DynamicMatrix<double> const& centroids);
+
+    // Sum up the points assigned to each of the centroids. Row k of the
+    // result holds the sum of all points assigned to centroid k followed
+    // by the number of those points (in the last column). The result is
+    // independent of the order in which the blocks of points are processed.
+    PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<double> kmeans_accumulate(
+        kmeans_points_type const& points,
+        blaze::DynamicVector<std::size_t> const& closest,
+        std::size_t num_centroids);
+
+    // Calculate the new centroids from the (possibly all-reduced) sums as
+    // returned by kmeans_accumulate. Centroids without any points assigned
+    // to them stay where they are.
+    PHYLANX_COMMON_EXPORT blaze::DynamicMatrix<double> kmeans_move_centroids(
+        blaze::DynamicMatrix<double> const& sums,
+        blaze::DynamicMatrix<double> const& centroids);
+
+    // Return the largest squared distance any of the centroids has moved.
+    PHYLANX_COMMON_EXPORT double kmeans_max_shift(
+        blaze::DynamicMatrix<double> const& centroids,
+        blaze::DynamicMatrix<double> const& moved);
+}}
+
+#endif
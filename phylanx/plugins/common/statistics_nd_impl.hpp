@@ -907,6 +907,7 @@ namespace phylanx { namespace common {
                     axis0, axis1, keepdims, std::move(initial), name, codename,
                     std::move(ctx));
 
+            case execution_tree::node_data_type_int32: HPX_FALLTHROUGH;
             case execution_tree::node_data_type_int64:
                 return statistics3d_slice<Op>(
                     extract_integer_value_strict(
@@ -914,6 +915,12 @@ namespace phylanx { namespace common {
                     axis0, axis1, keepdims, std::move(initial), name, codename,
                     std::move(ctx));
 
+            case execution_tree::node_data_type_float32:
+                return statistics3d_slice<Op>(
+                    extract_float32_value(std::move(arg), name, codename),
+                    axis0, axis1, keepdims, std::move(initial), name, codename,
+                    std::move(ctx));
+
             case execution_tree::node_data_type_unknown:
                 HPX_FALLTHROUGH;
             case execution_tree::node_data_type_double:
@@ -1335,6 +1342,7 @@ namespace phylanx { namespace common {
                     axis0, axis1, keepdims, std::move(initial), name, codename,
                     std::move(ctx));
 
+            case execution_tree::node_data_type_int32: HPX_FALLTHROUGH;
             case execution_tree::node_data_type_int64:
                 return statistics4d_slice<Op>(
                     extract_integer_value_strict(
@@ -1342,6 +1350,12 @@ namespace phylanx { namespace common {
                     axis0, axis1, keepdims, std::move(initial), name, codename,
                     std::move(ctx));
 
+            case execution_tree::node_data_type_float32:
+                return statistics4d_slice<Op>(
+                    extract_float32_value(std::move(arg), name, codename),
+                    axis0, axis1, keepdims, std::move(initial), name, codename,
+                    std::move(ctx));
+
             case execution_tree::node_data_type_unknown:
                 HPX_FALLTHROUGH;
             case execution_tree::node_data_type_double:
@@ -1605,6 +1619,7 @@ namespace phylanx { namespace common {
                     axis0, axis1, axis2, keepdims, std::move(initial), name,
                     codename, std::move(ctx));
 
+            case execution_tree::node_data_type_int32: HPX_FALLTHROUGH;
             case execution_tree::node_data_type_int64:
                 return statistics4d_tensor<Op>(
                     execution_tree::extract_integer_value_strict(
@@ -1612,6 +1627,13 @@ namespace phylanx { namespace common {
                     axis0, axis1, axis2, keepdims, std::move(initial), name,
                     codename, std::move(ctx));
 
+            case execution_tree::node_data_type_float32:
+                return statistics4d_tensor<Op>(
+                    execution_tree::extract_float32_value(
+                        std::move(arg), name, codename),
+                    axis0, axis1, axis2, keepdims, std::move(initial), name,
+                    codename, std::move(ctx));
+
             case execution_tree::node_data_type_unknown:
                 HPX_FALLTHROUGH;
             case execution_tree::node_data_type_double:
@@ -2119,12 +2141,18 @@ namespace phylanx { namespace common {
                 axis, keepdims, std::move(initial), name, codename,
                 std::move(ctx));
 
+        case execution_tree::node_data_type_int32: HPX_FALLTHROUGH;
         case execution_tree::node_data_type_int64:
             return detail::statisticsnd<Op>(
                 extract_integer_value_strict(std::move(arg), name, codename),
                 axis, keepdims, std::move(initial), name, codename,
                 std::move(ctx));
 
+        case execution_tree::node_data_type_float32:
+            return detail::statisticsnd<Op>(
+                extract_float32_value(std::move(arg), name, codename), axis,
+                keepdims, std::move(initial), name, codename, std::move(ctx));
+
         case execution_tree::node_data_type_unknown:
             HPX_FALLTHROUGH;
         case execution_tree::node_data_type_double:
@@ -2215,12 +2243,19 @@ namespace phylanx { namespace common {
                         std::move(arg), name, codename),
                     std::move(initial), name, codename, std::move(ctx));
 
+            case execution_tree::node_data_type_int32: HPX_FALLTHROUGH;
             case execution_tree::node_data_type_int64:
                 return detail::statisticsnd<Op>(
                     execution_tree::extract_integer_value_strict(
                         std::move(arg), name, codename),
                     std::move(initial), name, codename, std::move(ctx));
 
+            case execution_tree::node_data_type_float32:
+                return detail::statisticsnd<Op>(
+                    execution_tree::extract_float32_value(
+                        std::move(arg), name, codename),
+                    std::move(initial), name, codename, std::move(ctx));
+
             case execution_tree::node_data_type_unknown:
                 HPX_FALLTHROUGH;
             case execution_tree::node_data_type_double:
@@ -2312,6 +2347,7 @@ namespace phylanx { namespace common {
                     keepdims, std::move(initial), name, codename,
                     std::move(ctx));
 
+            case execution_tree::node_data_type_int32: HPX_FALLTHROUGH;
             case execution_tree::node_data_type_int64:
                 return statisticsnd_flat<Op>(
                     execution_tree::extract_integer_value_strict(
@@ -2319,6 +2355,13 @@ namespace phylanx { namespace common {
                     keepdims, std::move(initial), name, codename,
                     std::move(ctx));
 
+            case execution_tree::node_data_type_float32:
+                return statisticsnd_flat<Op>(
+                    execution_tree::extract_float32_value(
+                        std::move(arg), name, codename),
+                    keepdims, std::move(initial), name, codename,
+                    std::move(ctx));
+
             case execution_tree::node_data_type_unknown:
                 HPX_FALLTHROUGH;
             case execution_tree::node_data_type_double:
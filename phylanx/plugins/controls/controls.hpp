@@ -21,6 +21,7 @@
 #include <phylanx/plugins/controls/parallel_block_operation.hpp>
 #include <phylanx/plugins/controls/parallel_map_operation.hpp>
 #include <phylanx/plugins/controls/range_operation.hpp>
+#include <phylanx/plugins/controls/scalar_loop.hpp>
 #include <phylanx/plugins/controls/while_operation.hpp>
 
 #endif
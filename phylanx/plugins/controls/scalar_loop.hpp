@@ -0,0 +1,94 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_SCALAR_LOOP)
+#define PHYLANX_PRIMITIVES_SCALAR_LOOP
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    namespace detail
+    {
+        enum class scalar_opcode : std::uint8_t
+        {
+            mov,
+            add, sub, mul, div,
+            less, less_equal, greater, greater_equal, equal, not_equal,
+            logical_and, logical_or,
+            negate, logical_not,
+            jump, jump_if_false,
+            ret
+        };
+
+        struct scalar_instruction
+        {
+            scalar_opcode opcode_;
+            std::size_t dest_;      // target register (or jump target)
+            std::size_t lhs_;
+            std::size_t rhs_;
+        };
+
+        struct scalar_register;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // __scalar_loop(program, loop, operands...) runs a while() or for() loop
+    // whose condition and body consist only of scalar arithmetic,
+    // comparisons, and assignments to variables. The program is a sequence
+    // of three-address instructions operating on a register file that holds
+    // the values of the operands, followed by temporaries. The variables
+    // are read once before and written once after running the program. If
+    // any of the values is not a scalar (or the program encounters an
+    // operation it can't handle), the original loop is evaluated instead.
+    // The compiler generates this primitive for all suitable loops.
+    class scalar_loop
+      : public primitive_component_base
+      , public std::enable_shared_from_this<scalar_loop>
+    {
+    public:
+        static match_pattern_type const match_data;
+
+        scalar_loop() = default;
+
+        scalar_loop(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+
+    private:
+        void parse_program(std::string const& program);
+
+        bool run(std::vector<detail::scalar_register>& regs,
+            std::size_t& result) const;
+
+        std::vector<detail::scalar_instruction> program_;
+        std::vector<std::size_t> stored_;   // operands assigned to
+        std::size_t num_operands_ = 0;
+        std::size_t num_registers_ = 0;
+    };
+
+    inline primitive create_scalar_loop(hpx::id_type const& locality,
+        primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(locality, "__scalar_loop",
+            std::move(operands), name, codename);
+    }
+}}}
+
+#endif
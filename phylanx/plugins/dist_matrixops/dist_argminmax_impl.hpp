@@ -93,10 +93,12 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                 return primitive_argument_type(
                     Op::template initial<std::uint8_t>());
 
+            case node_data_type_int32: HPX_FALLTHROUGH;
             case node_data_type_int64:
                 return primitive_argument_type(
                     Op::template initial<std::int64_t>());
 
+            case node_data_type_float32: HPX_FALLTHROUGH;
             case node_data_type_double: HPX_FALLTHROUGH;
             case node_data_type_unknown:
                 return primitive_argument_type(Op::template initial<double>());
@@ -126,11 +128,13 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                     blaze::DynamicVector<std::uint8_t>(
                         size, Op::template initial<std::uint8_t>()));
 
+            case node_data_type_int32: HPX_FALLTHROUGH;
             case node_data_type_int64:
                 return primitive_argument_type(
                     blaze::DynamicVector<std::int64_t>(
                         size, Op::template initial<std::int64_t>()));
 
+            case node_data_type_float32: HPX_FALLTHROUGH;
             case node_data_type_double: HPX_FALLTHROUGH;
             case node_data_type_unknown:
                 return primitive_argument_type(blaze::DynamicVector<double>(
@@ -198,12 +202,14 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                         std::move(local_value), name, codename),
                     index, locs);
 
+            case node_data_type_int32: HPX_FALLTHROUGH;
             case node_data_type_int64:
                 return detail::argminmax0d_reduce<Op>(
                     extract_scalar_integer_value_strict(
                         std::move(local_value), name, codename),
                     index, locs);
 
+            case node_data_type_float32: HPX_FALLTHROUGH;
             case node_data_type_double:
                 return detail::argminmax0d_reduce<Op>(
                     extract_scalar_numeric_value_strict(
@@ -302,12 +308,14 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                         std::move(local_value), name, codename),
                     indices, locs);
 
+            case node_data_type_int32: HPX_FALLTHROUGH;
             case node_data_type_int64:
                 return detail::argminmax1d_reduce<Op>(
                     extract_integer_value_strict(
                         std::move(local_value), name, codename),
                     indices, locs);
 
+            case node_data_type_float32: HPX_FALLTHROUGH;
             case node_data_type_double:
                 return detail::argminmax1d_reduce<Op>(
                     extract_numeric_value_strict(
@@ -83,6 +83,12 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
             execution_tree::localities_information&& lhs_localities,
             execution_tree::localities_information const& rhs_localities) const;
         template <typename T>
+        execution_tree::primitive_argument_type dot2d2d_block(
+            ir::node_data<T>&& lhs, ir::node_data<T>&& rhs,
+            execution_tree::localities_information&& lhs_localities,
+            execution_tree::localities_information const& rhs_localities,
+            bool use_cannon) const;
+        template <typename T>
         execution_tree::primitive_argument_type dot2d3d(
             ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const;
         template <typename T>
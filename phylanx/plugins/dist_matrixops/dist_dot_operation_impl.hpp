@@ -17,6 +17,7 @@
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/common/dot_operation_nd.hpp>
 #include <phylanx/plugins/dist_matrixops/dist_dot_operation.hpp>
+#include <phylanx/plugins/dist_matrixops/matrix_product_algorithms.hpp>
 #include <phylanx/util/distributed_matrix.hpp>
 #include <phylanx/util/distributed_vector.hpp>
 
@@ -561,6 +562,39 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
         return result;
     }
 
+    // the result tile covers the rows of the lhs tile and the columns of the
+    // rhs tile
+    template <typename T>
+    execution_tree::primitive_argument_type dist_dot_operation::dot2d2d_block(
+        ir::node_data<T>&& lhs, ir::node_data<T>&& rhs,
+        execution_tree::localities_information&& lhs_localities,
+        execution_tree::localities_information const& rhs_localities,
+        bool use_cannon) const
+    {
+        blaze::DynamicMatrix<T> result_matrix = use_cannon ?
+            detail::cannon_product(lhs, rhs, lhs_localities, rhs_localities,
+                &transferred_bytes_, name_, codename_) :
+            detail::summa_product(lhs, rhs, lhs_localities, rhs_localities,
+                &transferred_bytes_, name_, codename_);
+
+        execution_tree::primitive_argument_type result =
+            execution_tree::primitive_argument_type{std::move(result_matrix)};
+
+        execution_tree::tiling_information_2d tile_info(
+            lhs_localities.get_span(0), rhs_localities.get_span(1));
+
+        ++lhs_localities.annotation_.generation_;
+
+        auto locality_ann = lhs_localities.locality_.as_annotation();
+        result.set_annotation(
+            execution_tree::localities_annotation(locality_ann,
+                tile_info.as_annotation(name_, codename_),
+                lhs_localities.annotation_, name_, codename_),
+            name_, codename_);
+
+        return result;
+    }
+
     template <typename T>
     execution_tree::primitive_argument_type dist_dot_operation::dot2d2d(
         ir::node_data<T>&& lhs, ir::node_data<T>&& rhs,
@@ -587,7 +621,24 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                     "the operands have incompatible number of dimensions"));
         }
 
-        // we do not support block tiling here yet
+        // block tiled operands are multiplied using either Cannon's
+        // algorithm or SUMMA, depending on the tiling of all localities
+        switch (detail::select_product_algorithm(
+            lhs_localities, rhs_localities, name_, codename_))
+        {
+        case detail::product_algorithm::cannon:
+            return dot2d2d_block(std::move(lhs), std::move(rhs),
+                std::move(lhs_localities), rhs_localities, true);
+
+        case detail::product_algorithm::summa:
+            return dot2d2d_block(std::move(lhs), std::move(rhs),
+                std::move(lhs_localities), rhs_localities, false);
+
+        default:
+            break;
+        }
+
+        // the remaining operands must be row-tiled or column-tiled
         if (!(lhs.dimension(1) == lhs_localities.columns(name_, codename_) ||
             lhs.dimension(0) == lhs_localities.rows(name_, codename_)) ||
             !(rhs.dimension(1) == rhs_localities.columns(name_, codename_) ||
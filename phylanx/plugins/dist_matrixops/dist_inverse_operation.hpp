@@ -8,6 +8,7 @@
 #define PHYLANX_MATRIX_INV_OPERATION
 
 #include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
@@ -25,6 +26,18 @@
 
 namespace phylanx { namespace dist_matrixops { namespace primitives {
 
+    /// \brief Inverts a square matrix tiled by columns (inverse_d) or solves
+    ///        a linear system with such a matrix (linear_solver_lu_d).
+    ///
+    /// Both primitives use a blocked right-looking LU factorization with
+    /// partial pivoting. The columns are grouped into panels, each owned by
+    /// a single locality. The owner factorizes its panel and sends it to all
+    /// localities in one collective operation, every locality then applies
+    /// the panel to its local columns of the matrix and of the right hand
+    /// side. The next panel is factorized and sent before the remaining
+    /// trailing update is done, overlapping the communication with the
+    /// computation. The backward substitution exchanges the column panels
+    /// of U the same way.
     class dist_inverse
       : public execution_tree::primitives::primitive_component_base
       , public std::enable_shared_from_this<dist_inverse>
@@ -36,8 +49,15 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
             execution_tree::eval_context ctx) const override;
 
     public:
+        enum inverse_mode
+        {
+            inverse_mode_inverse,   // inverse_d
+            inverse_mode_solve      // linear_solver_lu_d
+        };
+
         // Declare match_data type that appears in cpp file
-        static execution_tree::match_pattern_type const match_data;
+        static std::vector<execution_tree::match_pattern_type> const
+            match_data;
 
         dist_inverse() = default;
 
@@ -45,17 +65,28 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
             std::string const& name, std::string const& codename);
 
     private:
-        template <typename T>
-        execution_tree::primitive_argument_type distGaussInv(
-            ir::node_data<T>&& arg,
+        // Solve A * X = B in place, a holds the local columns of A, b the
+        // local columns of B (all rows each). On return b holds the local
+        // columns of X.
+        void lu_solve(blaze::DynamicMatrix<double>& a,
+            blaze::DynamicMatrix<double>& b,
+            execution_tree::localities_information const& lhs_localities)
+            const;
+
+        execution_tree::primitive_argument_type distInverse(
+            ir::node_data<double>&& arg,
             execution_tree::localities_information&& lhs_localities) const;
-        execution_tree::primitive_argument_type distGaussInv(
-            execution_tree::primitive_argument_type&& lhs) const;
+        execution_tree::primitive_argument_type distSolve(
+            ir::node_data<double>&& lhs, ir::node_data<double>&& rhs,
+            execution_tree::localities_information&& lhs_localities,
+            execution_tree::localities_information&& rhs_localities,
+            bool rhs_distributed) const;
 
     private:
         std::int64_t get_transferred_bytes(bool reset) const;
 
         mutable std::int64_t transferred_bytes_;
+        inverse_mode mode_;
     };
 
     inline execution_tree::primitive create_dist_inverse(
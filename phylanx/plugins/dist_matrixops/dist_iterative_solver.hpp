@@ -0,0 +1,84 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_DIST_MATRIXOPS_DIST_ITERATIVE_SOLVER)
+#define PHYLANX_DIST_MATRIXOPS_DIST_ITERATIVE_SOLVER
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace dist_matrixops { namespace primitives
+{
+    /// \brief Iterative solvers for linear systems with a row-tiled matrix.
+    ///
+    /// Every locality holds all columns of some of the rows of the matrix
+    /// and the corresponding elements of the right hand side. The matrix
+    /// vector products are computed locally, the local parts of the vector
+    /// they are applied to are exchanged together with the partial scalar
+    /// products in a single collective operation.
+    ///
+    /// iterative_solver_conjugate_gradient_d and iterative_solver_cg_jacobi_d
+    /// implement the pipelined (Jacobi preconditioned) conjugate gradient
+    /// method, which needs one collective operation per iteration.
+    /// iterative_solver_gmres_d implements the restarted GMRES method using
+    /// classical Gram-Schmidt orthogonalization, which needs two collective
+    /// operations per iteration.
+    class dist_iterative_solver
+      : public execution_tree::primitives::primitive_component_base
+      , public std::enable_shared_from_this<dist_iterative_solver>
+    {
+    public:
+        enum solver_type
+        {
+            solver_cg,            // iterative_solver_conjugate_gradient_d
+            solver_cg_jacobi,     // iterative_solver_cg_jacobi_d
+            solver_gmres          // iterative_solver_gmres_d
+        };
+
+        static std::vector<execution_tree::match_pattern_type> const
+            match_data;
+
+        dist_iterative_solver() = default;
+
+        dist_iterative_solver(
+            execution_tree::primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    protected:
+        hpx::future<execution_tree::primitive_argument_type> eval(
+            execution_tree::primitive_arguments_type const& operands,
+            execution_tree::primitive_arguments_type const& args,
+            execution_tree::eval_context ctx) const override;
+
+    private:
+        execution_tree::primitive_argument_type calculate(
+            execution_tree::primitive_arguments_type&& args) const;
+
+    private:
+        solver_type solver_;
+    };
+
+    inline execution_tree::primitive create_dist_iterative_solver(
+        hpx::id_type const& locality,
+        execution_tree::primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return execution_tree::create_primitive_component(locality,
+            "iterative_solver_conjugate_gradient_d", std::move(operands),
+            name, codename);
+    }
+}}}
+
+#endif
@@ -0,0 +1,67 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_DIST_KMEANS)
+#define PHYLANX_PRIMITIVES_DIST_KMEANS
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+namespace phylanx { namespace dist_matrixops { namespace primitives
+{
+    /// Creates a primitive executing the kmeans algorithm on a row-tiled
+    /// distributed matrix of points. Every locality assigns its local points
+    /// to the closest centroids, only the per-centroid sums and counts are
+    /// all-reduced in each iteration.
+    class dist_kmeans
+      : public execution_tree::primitives::primitive_component_base
+      , public std::enable_shared_from_this<dist_kmeans>
+    {
+    protected:
+        hpx::future<execution_tree::primitive_argument_type> eval(
+            execution_tree::primitive_arguments_type const& operands,
+            execution_tree::primitive_arguments_type const& args,
+            execution_tree::eval_context ctx) const override;
+
+    public:
+        static execution_tree::match_pattern_type const match_data;
+
+        dist_kmeans() = default;
+
+        dist_kmeans(execution_tree::primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        blaze::DynamicMatrix<double> all_reduce_sums(
+            blaze::DynamicMatrix<double>&& sums, std::size_t iteration,
+            execution_tree::localities_information const& locs) const;
+
+        execution_tree::primitive_argument_type calculate_kmeans(
+            execution_tree::primitive_arguments_type&& args) const;
+    };
+
+    inline execution_tree::primitive create_dist_kmeans(
+        hpx::id_type const& locality,
+        execution_tree::primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return execution_tree::create_primitive_component(
+            locality, "kmeans_d", std::move(operands), name, codename);
+    }
+}}}
+
+#endif
@@ -15,7 +15,10 @@
 #include <phylanx/plugins/dist_matrixops/dist_dot_operation.hpp>
 #include <phylanx/plugins/dist_matrixops/dist_identity.hpp>
 #include <phylanx/plugins/dist_matrixops/dist_inverse_operation.hpp>
+#include <phylanx/plugins/dist_matrixops/dist_iterative_solver.hpp>
+#include <phylanx/plugins/dist_matrixops/dist_kmeans.hpp>
 #include <phylanx/plugins/dist_matrixops/dist_random.hpp>
+#include <phylanx/plugins/dist_matrixops/dist_sort.hpp>
 #include <phylanx/plugins/dist_matrixops/dist_transpose_operation.hpp>
 #include <phylanx/plugins/dist_matrixops/retile_annotations.hpp>
 
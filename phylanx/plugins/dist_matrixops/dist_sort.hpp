@@ -0,0 +1,91 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_DIST_MATRIXOPS_DIST_SORT)
+#define PHYLANX_DIST_MATRIXOPS_DIST_SORT
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/naming.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace dist_matrixops { namespace primitives {
+
+    /// \brief Sorts a vector tiled across localities (sort_d) or returns the
+    ///        global indices that would sort it (argsort_d).
+    ///
+    /// The primitive implements a sample sort: every locality sorts its tile,
+    /// the splitters are selected from regular samples of all tiles, the
+    /// elements are exchanged with a single all-to-all step and the received
+    /// runs are merged locally. The result is tiled by columns, locality i
+    /// holds the i-th part of the sorted sequence.
+    class dist_sort
+      : public execution_tree::primitives::primitive_component_base
+      , public std::enable_shared_from_this<dist_sort>
+    {
+    public:
+        enum sort_mode
+        {
+            sort_mode_values,     // sort_d
+            sort_mode_indices     // argsort_d
+        };
+
+        static std::vector<execution_tree::match_pattern_type> const
+            match_data;
+
+        dist_sort() = default;
+
+        dist_sort(execution_tree::primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    protected:
+        hpx::future<execution_tree::primitive_argument_type> eval(
+            execution_tree::primitive_arguments_type const& operands,
+            execution_tree::primitive_arguments_type const& args,
+            execution_tree::eval_context ctx) const override;
+
+    private:
+        template <typename T>
+        execution_tree::primitive_argument_type sort1d_local(
+            ir::node_data<T>&& arg) const;
+
+        template <typename T>
+        execution_tree::primitive_argument_type sort1d_distributed(
+            ir::node_data<T>&& arg,
+            execution_tree::localities_information&& locs) const;
+
+        template <typename T>
+        execution_tree::primitive_argument_type sort1d(ir::node_data<T>&& arg,
+            execution_tree::localities_information&& locs,
+            bool distributed) const;
+
+        execution_tree::primitive_argument_type sort1d(
+            execution_tree::primitive_argument_type&& arg) const;
+
+    private:
+        sort_mode mode_;
+    };
+
+    inline execution_tree::primitive create_dist_sort(
+        hpx::id_type const& locality,
+        execution_tree::primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "sort_d", std::move(operands), name, codename);
+    }
+}}}    // namespace phylanx::dist_matrixops::primitives
+
+#endif
@@ -0,0 +1,701 @@
+//  Copyright (c) 2017-2019 Hartmut Kaiser
+//  Copyright (c) 2017 Parsa Amini
+//  Copyright (c) 2019 Bita Hasheminezhad
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This header is shared by dot_d and cannon_product_d. It does not declare
+// the distributed_matrix actions, this is left to the including file.
+
+#if !defined(PHYLANX_DIST_MATRIXOPS_MATRIX_PRODUCT_ALGORITHMS)
+#define PHYLANX_DIST_MATRIXOPS_MATRIX_PRODUCT_ALGORITHMS
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/tiling_annotations.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/util/distributed_matrix.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+#include <phylanx/util/serialization/blaze.hpp>
+
+#include <hpx/assert.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/collectives.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+namespace phylanx { namespace dist_matrixops { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    enum class product_algorithm
+    {
+        row_column,     // all tiles span all rows or all columns (dot_d)
+        cannon,         // square grid of uniformly sized tiles
+        summa           // any grid, possibly replicated (2.5D)
+    };
+
+    inline bool same_span(execution_tree::tiling_span const& lhs,
+        execution_tree::tiling_span const& rhs)
+    {
+        return lhs.start_ == rhs.start_ && lhs.stop_ == rhs.stop_;
+    }
+
+    inline bool contains_span(execution_tree::tiling_span const& outer,
+        std::int64_t start, std::int64_t stop)
+    {
+        return outer.start_ <= start && stop <= outer.stop_;
+    }
+
+    // localities holding the same lhs and rhs tiles are replicas of each
+    // other, the layer of a locality is its position among its replicas
+    inline std::vector<std::uint32_t> replicas(
+        execution_tree::localities_information const& lhs_localities,
+        execution_tree::localities_information const& rhs_localities,
+        std::uint32_t locality)
+    {
+        auto const& lhs_tile = lhs_localities.tiles_[locality];
+        auto const& rhs_tile = rhs_localities.tiles_[locality];
+
+        std::vector<std::uint32_t> result;
+        for (std::uint32_t loc = 0;
+             loc != lhs_localities.locality_.num_localities_; ++loc)
+        {
+            auto const& lhs_other = lhs_localities.tiles_[loc];
+            auto const& rhs_other = rhs_localities.tiles_[loc];
+            if (same_span(lhs_tile.spans_[0], lhs_other.spans_[0]) &&
+                same_span(lhs_tile.spans_[1], lhs_other.spans_[1]) &&
+                same_span(rhs_tile.spans_[0], rhs_other.spans_[0]) &&
+                same_span(rhs_tile.spans_[1], rhs_other.spans_[1]))
+            {
+                result.push_back(loc);
+            }
+        }
+        return result;
+    }
+
+    inline std::size_t replica_layer(
+        execution_tree::localities_information const& lhs_localities,
+        execution_tree::localities_information const& rhs_localities,
+        std::uint32_t locality)
+    {
+        auto group = replicas(lhs_localities, rhs_localities, locality);
+        return std::distance(group.begin(),
+            std::find(group.begin(), group.end(), locality));
+    }
+
+    // returns zero if the tiles of the operands are not all replicated the
+    // same number of times
+    inline std::size_t replication_factor(
+        execution_tree::localities_information const& lhs_localities,
+        execution_tree::localities_information const& rhs_localities)
+    {
+        std::size_t factor = 0;
+        for (std::uint32_t loc = 0;
+             loc != lhs_localities.locality_.num_localities_; ++loc)
+        {
+            std::size_t count =
+                replicas(lhs_localities, rhs_localities, loc).size();
+            if (factor != 0 && factor != count)
+            {
+                return 0;
+            }
+            factor = count;
+        }
+        return factor;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // all localities have to choose the same algorithm, thus the decision is
+    // based on the tiles of all localities only
+    inline bool is_row_or_column_tiled(
+        execution_tree::localities_information const& localities,
+        std::string const& name, std::string const& codename)
+    {
+        std::int64_t rows = localities.rows(name, codename);
+        std::int64_t columns = localities.columns(name, codename);
+        return std::all_of(localities.tiles_.begin(), localities.tiles_.end(),
+            [&](execution_tree::tiling_information const& tile) {
+                return tile.spans_[0].size() == rows ||
+                    tile.spans_[1].size() == columns;
+            });
+    }
+
+    // Cannon's algorithm as implemented by cannon_product_d requires the
+    // localities to form a square grid of at least 2x2 uniformly sized tiles
+    // with the lhs column spans matching the rhs row spans
+    inline bool is_cannon_compatible(
+        execution_tree::localities_information const& lhs_localities,
+        execution_tree::localities_information const& rhs_localities)
+    {
+        std::uint32_t num_localities = lhs_localities.locality_.num_localities_;
+        for (std::uint32_t loc = 0; loc != num_localities; ++loc)
+        {
+            auto const& lhs_row = lhs_localities.tiles_[loc].spans_[0];
+            auto const& rhs_column = rhs_localities.tiles_[loc].spans_[1];
+
+            std::vector<std::uint32_t> lhs_tile_row;
+            std::vector<std::uint32_t> rhs_tile_column;
+            for (std::uint32_t i = 0; i != num_localities; ++i)
+            {
+                if (same_span(lhs_localities.tiles_[i].spans_[0], lhs_row))
+                {
+                    lhs_tile_row.push_back(i);
+                }
+                if (same_span(rhs_localities.tiles_[i].spans_[1], rhs_column))
+                {
+                    rhs_tile_column.push_back(i);
+                }
+            }
+
+            if (lhs_tile_row.size() < 2 ||
+                lhs_tile_row.size() != rhs_tile_column.size())
+            {
+                return false;
+            }
+
+            std::int64_t width =
+                lhs_localities.tiles_[lhs_tile_row[0]].spans_[1].size();
+            std::int64_t start = -1;
+            for (std::size_t i = 0; i != lhs_tile_row.size(); ++i)
+            {
+                auto const& lhs_span =
+                    lhs_localities.tiles_[lhs_tile_row[i]].spans_[1];
+                auto const& rhs_span =
+                    rhs_localities.tiles_[rhs_tile_column[i]].spans_[0];
+                if (!same_span(lhs_span, rhs_span) ||
+                    lhs_span.size() != width || lhs_span.start_ <= start)
+                {
+                    return false;
+                }
+                start = lhs_span.start_;
+            }
+        }
+        return true;
+    }
+
+    inline product_algorithm select_product_algorithm(
+        execution_tree::localities_information const& lhs_localities,
+        execution_tree::localities_information const& rhs_localities,
+        std::string const& name, std::string const& codename)
+    {
+        std::uint32_t num_localities = lhs_localities.locality_.num_localities_;
+        if (num_localities == 1 ||
+            num_localities != rhs_localities.locality_.num_localities_)
+        {
+            return product_algorithm::row_column;
+        }
+
+        auto is_2d = [](execution_tree::tiling_information const& tile) {
+            return tile.dimension() == 2;
+        };
+        if (!std::all_of(lhs_localities.tiles_.begin(),
+                lhs_localities.tiles_.end(), is_2d) ||
+            !std::all_of(rhs_localities.tiles_.begin(),
+                rhs_localities.tiles_.end(), is_2d))
+        {
+            return product_algorithm::row_column;
+        }
+
+        // replicated tiles would be accounted for more than once otherwise,
+        // SUMMA uses the replicas as layers (2.5D) only if all tiles are
+        // replicated the same number of times
+        if (replication_factor(lhs_localities, rhs_localities) != 1)
+        {
+            return product_algorithm::summa;
+        }
+
+        if (is_row_or_column_tiled(lhs_localities, name, codename) &&
+            is_row_or_column_tiled(rhs_localities, name, codename))
+        {
+            return product_algorithm::row_column;
+        }
+
+        if (is_cannon_compatible(lhs_localities, rhs_localities))
+        {
+            return product_algorithm::cannon;
+        }
+
+        return product_algorithm::summa;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Cannon's algorithm: the tiles of the lhs tile row and of the rhs tile
+    // column are circulated, the next pair of tiles is fetched while the
+    // current one is being multiplied
+    template <typename T>
+    blaze::DynamicMatrix<T> cannon_product(ir::node_data<T> const& lhs,
+        ir::node_data<T> const& rhs,
+        execution_tree::localities_information const& lhs_localities,
+        execution_tree::localities_information const& rhs_localities,
+        std::int64_t* transferred_bytes, std::string const& name,
+        std::string const& codename)
+    {
+        // What if RHS or LHS isn't distributed?
+        std::size_t lhs_num_cols = lhs_localities.columns(name, codename);
+        std::size_t rhs_num_rows = rhs_localities.rows(name, codename);
+        execution_tree::tiling_span const& lhs_col_span =
+            lhs_localities.get_span(1);
+        execution_tree::tiling_span const& lhs_row_span =
+            lhs_localities.get_span(0);
+
+        execution_tree::tiling_span const& rhs_col_span =
+            rhs_localities.get_span(1);
+        execution_tree::tiling_span const& rhs_row_span =
+            rhs_localities.get_span(0);
+
+        // Maybe this error should be split to be more descriptive
+        if (lhs_num_cols % lhs_col_span.size() != 0 ||
+            rhs_num_rows % rhs_row_span.size() != 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_matrixops::detail::cannon_product",
+                util::generate_error_message(
+                    "All tiles in the tile row/column do not have "
+                    "equal height/width",
+                    name, codename));
+        }
+        std::vector<std::size_t> lhs_tile_row;
+        std::vector<std::size_t> rhs_tile_col;
+        std::size_t count = 0;
+        std::uint32_t lhs_num_localities =
+            lhs_localities.locality_.num_localities_;
+        std::uint32_t rhs_num_localities =
+            rhs_localities.locality_.num_localities_;
+        // This could maybe be replaced with a std::copy_if
+        if (lhs_num_localities != rhs_num_localities &&
+            lhs_num_localities != 1 && rhs_num_localities != 1)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_matrixops::detail::cannon_product",
+                util::generate_error_message(
+                    "number of tiles in lhs and rhs must be equal", name,
+                    codename));
+        }
+
+        for (std::size_t i = 0; i < lhs_num_localities; i++)
+        {
+            // This works because lhs_localities.tiles_ is
+            // guaranteed to be sorted by locality index
+            auto const& tmp_lhs_tile = lhs_localities.tiles_[i];
+            auto const& tmp_rhs_tile = rhs_localities.tiles_[i];
+            if (tmp_lhs_tile.spans_[0].start_ == lhs_row_span.start_ &&
+                tmp_lhs_tile.spans_[0].size() == lhs_row_span.size())
+            {
+                lhs_tile_row.push_back(count);
+            }
+            if (tmp_rhs_tile.spans_[1].start_ == rhs_col_span.start_ &&
+                tmp_rhs_tile.spans_[1].size() == rhs_col_span.size())
+            {
+                rhs_tile_col.push_back(count);
+            }
+            count++;
+        }
+
+        std::size_t lhs_tile_row_size = lhs_tile_row.size();
+        std::size_t rhs_tile_col_size = rhs_tile_col.size();
+        if (lhs_num_localities != 1 &&
+            (lhs_tile_row_size < 2 || rhs_tile_col_size < 2))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_matrixops::detail::cannon_product",
+                util::generate_error_message(
+                    "cannon_product requires tile rows and columns of size at "
+                    "least 2",
+                    name, codename));
+        }
+
+        std::int64_t max_start_col = 0;
+        std::int64_t max_start_row = 0;
+        for (std::size_t i = 0; i < lhs_tile_row_size; i++)
+        {
+            std::size_t lhs_tile_idx = lhs_tile_row[i];
+            std::size_t rhs_tile_idx = rhs_tile_col[i];
+            std::size_t lhs_local_width =
+                lhs_localities.tiles_[lhs_tile_idx].spans_[1].size();
+            std::size_t rhs_local_height =
+                rhs_localities.tiles_[rhs_tile_idx].spans_[0].size();
+            if (lhs_localities.tiles_[lhs_tile_idx].spans_[1].start_ <
+                    max_start_col ||
+                lhs_local_width != lhs_col_span.size() ||
+                rhs_localities.tiles_[rhs_tile_idx].spans_[0].start_ <
+                    max_start_row ||
+                rhs_local_height != rhs_row_span.size())
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_matrixops::detail::cannon_product",
+                    util::generate_error_message(
+                        "tiles not sorted in order of locality", name,
+                        codename));
+            }
+            max_start_col =
+                lhs_localities.tiles_[lhs_tile_idx].spans_[1].start_;
+            max_start_row =
+                rhs_localities.tiles_[rhs_tile_idx].spans_[0].start_;
+        }
+
+        std::uint32_t lhs_locality_id = lhs_localities.locality_.locality_id_;
+        std::uint32_t rhs_locality_id = rhs_localities.locality_.locality_id_;
+
+        // construct a distributed matrix object for both tiles
+        util::distributed_matrix<T> lhs_data(lhs_localities.annotation_.name_,
+            lhs.matrix(), lhs_num_localities, lhs_locality_id,
+            transferred_bytes);
+        util::distributed_matrix<T> rhs_data(rhs_localities.annotation_.name_,
+            rhs.matrix(), rhs_num_localities, rhs_locality_id,
+            transferred_bytes);
+
+        std::size_t lhs_local_tile_index = std::distance(lhs_tile_row.begin(),
+            std::find(
+                lhs_tile_row.begin(), lhs_tile_row.end(), lhs_locality_id));
+        std::size_t rhs_local_tile_index = std::distance(rhs_tile_col.begin(),
+            std::find(
+                rhs_tile_col.begin(), rhs_tile_col.end(), rhs_locality_id));
+
+        if (lhs_tile_row[lhs_local_tile_index] != lhs_locality_id ||
+            rhs_tile_col[rhs_local_tile_index] != rhs_locality_id)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_matrixops::detail::cannon_product",
+                util::generate_error_message(
+                    "This locality not present in locality list", name,
+                    codename));
+        }
+        // This needs greater granularity to determine this
+        blaze::DynamicMatrix<T> result_matrix(
+            lhs.dimension(0), rhs.dimension(1), T{0});
+
+        // 2d2d doesn't use every tile of the RHS, only those that contain
+        // the rows with the same index as the columns the LHS has
+        std::size_t iter_idx = (lhs_local_tile_index + 1) % lhs_tile_row_size;
+        bool lhs_flag = true;
+        bool rhs_flag = true;
+        hpx::lcos::future<blaze::DynamicMatrix<T>> lhs_tmp1;
+        hpx::lcos::future<blaze::DynamicMatrix<T>> rhs_tmp1;
+        if (iter_idx != lhs_local_tile_index)
+        {
+            lhs_tmp1 = lhs_data.fetch(lhs_tile_row[iter_idx]);
+            lhs_flag = false;
+        }
+        if (iter_idx != rhs_local_tile_index)
+        {
+            rhs_tmp1 = rhs_data.fetch(rhs_tile_col[iter_idx]);
+            rhs_flag = false;
+        }
+        iter_idx = (iter_idx + 1) % lhs_tile_row_size;
+
+        for (std::size_t i = 0; i < lhs_tile_row_size; i++)
+        {
+            hpx::lcos::future<blaze::DynamicMatrix<T>> lhs_tmp2;
+            hpx::lcos::future<blaze::DynamicMatrix<T>> rhs_tmp2;
+
+            // fetching the next tiles if necessary
+            if (i != lhs_tile_row_size - 1)
+            {
+                if (iter_idx != lhs_local_tile_index)
+                {
+                    lhs_tmp2 = lhs_data.fetch(lhs_tile_row[iter_idx]);
+                }
+                if (iter_idx != rhs_local_tile_index)
+                {
+                    rhs_tmp2 = rhs_data.fetch(rhs_tile_col[iter_idx]);
+                }
+            }
+
+            if (lhs_flag && rhs_flag)
+            {
+                // both tiles are available locally
+                result_matrix += lhs.matrix() * rhs.matrix();
+            }
+            else if (lhs_flag)
+            {
+                // left tile is in the current locality
+                result_matrix += lhs.matrix() * rhs_tmp1.get();
+            }
+            else if (rhs_flag)
+            {
+                // right tile is in the current locality
+                result_matrix += lhs_tmp1.get() * rhs.matrix();
+            }
+            else
+            {
+                // both lhs and rhs are remotely available
+                result_matrix += lhs_tmp1.get() * rhs_tmp1.get();
+            }
+
+            lhs_flag = iter_idx != lhs_local_tile_index ? false : true;
+            rhs_flag = iter_idx != rhs_local_tile_index ? false : true;
+            iter_idx = (iter_idx + 1) % lhs_tile_row_size;
+            lhs_tmp1 = std::move(lhs_tmp2);
+            rhs_tmp1 = std::move(rhs_tmp2);
+        }
+
+        return result_matrix;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // SUMMA: the inner dimension is split into panels at all tile boundaries
+    // of the lhs columns and the rhs rows. For each panel the owning tile of
+    // the lhs is broadcast along the tile row and the owning tile of the rhs
+    // is broadcast along the tile column, every locality then accumulates
+    // the product of both panels into its tile of the result. The grid of
+    // tiles does not have to be square and the tiles may differ in size.
+    //
+    // If the operand tiles are replicated c times (2.5D), the replicas split
+    // the panels between them and the partial results are summed up at the
+    // end. This trades c times the memory for c times fewer broadcasts per
+    // locality.
+    template <typename T>
+    blaze::DynamicMatrix<T> summa_product(ir::node_data<T> const& lhs,
+        ir::node_data<T> const& rhs,
+        execution_tree::localities_information const& lhs_localities,
+        execution_tree::localities_information const& rhs_localities,
+        std::int64_t* transferred_bytes, std::string const& name,
+        std::string const& codename)
+    {
+        using matrix_type = blaze::DynamicMatrix<T>;
+
+        std::uint32_t num_localities = lhs_localities.locality_.num_localities_;
+        std::uint32_t locality_id = lhs_localities.locality_.locality_id_;
+
+        auto const& lhs_tiles = lhs_localities.tiles_;
+        auto const& rhs_tiles = rhs_localities.tiles_;
+
+        // unevenly replicated tiles are handled as a single layer, the
+        // replicas then compute the same tile of the result independently
+        std::size_t layers =
+            (std::max)(replication_factor(lhs_localities, rhs_localities),
+                std::size_t(1));
+        auto layer_of = [&](std::uint32_t loc) -> std::size_t {
+            return layers == 1 ?
+                0 :
+                replica_layer(lhs_localities, rhs_localities, loc);
+        };
+        std::size_t layer = layer_of(locality_id);
+
+        // the localities sharing the lhs tile row and the rhs tile column
+        // with this locality in the same layer
+        std::vector<std::uint32_t> row_group;
+        std::vector<std::uint32_t> column_group;
+        for (std::uint32_t loc = 0; loc != num_localities; ++loc)
+        {
+            if (layer_of(loc) != layer)
+            {
+                continue;
+            }
+            if (same_span(lhs_tiles[loc].spans_[0],
+                    lhs_tiles[locality_id].spans_[0]))
+            {
+                row_group.push_back(loc);
+            }
+            if (same_span(rhs_tiles[loc].spans_[1],
+                    rhs_tiles[locality_id].spans_[1]))
+            {
+                column_group.push_back(loc);
+            }
+        }
+
+        // the panel boundaries are the same on all localities
+        std::vector<std::int64_t> bounds;
+        for (std::uint32_t loc = 0; loc != num_localities; ++loc)
+        {
+            bounds.push_back(lhs_tiles[loc].spans_[1].start_);
+            bounds.push_back(lhs_tiles[loc].spans_[1].stop_);
+            bounds.push_back(rhs_tiles[loc].spans_[0].start_);
+            bounds.push_back(rhs_tiles[loc].spans_[0].stop_);
+        }
+        std::sort(bounds.begin(), bounds.end());
+        bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+        // the panels handled by this layer
+        std::vector<std::size_t> panels;
+        for (std::size_t p = 0; p + 1 < bounds.size(); ++p)
+        {
+            if (p % layers == layer)
+            {
+                panels.push_back(p);
+            }
+        }
+
+        auto find_owner = [&](std::vector<std::uint32_t> const& group,
+                              execution_tree::localities_information const&
+                                  localities,
+                              std::size_t dim, std::size_t p) {
+            auto it = std::find_if(group.begin(), group.end(),
+                [&](std::uint32_t loc) {
+                    return contains_span(localities.tiles_[loc].spans_[dim],
+                        bounds[p], bounds[p + 1]);
+                });
+            if (it == group.end())
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_matrixops::detail::summa_product",
+                    util::generate_error_message(
+                        "the tiles of the operands do not cover the inner "
+                        "dimension of the product",
+                        name, codename));
+            }
+            return std::size_t(std::distance(group.begin(), it));
+        };
+
+        execution_tree::tiling_span const& lhs_col_span =
+            lhs_tiles[locality_id].spans_[1];
+        execution_tree::tiling_span const& rhs_row_span =
+            rhs_tiles[locality_id].spans_[0];
+
+        std::string const lhs_basename = "summa_lhs_" +
+            lhs_localities.annotation_.name_ + "/" +
+            std::to_string(lhs_localities.annotation_.generation_) + "/" +
+            std::to_string(lhs_tiles[locality_id].spans_[0].start_) + "/" +
+            std::to_string(layer);
+        std::string const rhs_basename = "summa_rhs_" +
+            rhs_localities.annotation_.name_ + "/" +
+            std::to_string(rhs_localities.annotation_.generation_) + "/" +
+            std::to_string(rhs_tiles[locality_id].spans_[1].start_) + "/" +
+            std::to_string(layer);
+
+        std::size_t const row_site = std::distance(row_group.begin(),
+            std::find(row_group.begin(), row_group.end(), locality_id));
+        std::size_t const column_site = std::distance(column_group.begin(),
+            std::find(column_group.begin(), column_group.end(), locality_id));
+
+        // broadcast the panel from the owner to all other members of the
+        // group, the owner sends its panel once to each of them
+        using panel_future = hpx::future<matrix_type>;
+        auto broadcast = [&](std::string const& basename,
+                             std::vector<std::uint32_t> const& group,
+                             std::size_t this_site, std::size_t owner,
+                             matrix_type&& panel,
+                             std::size_t p) -> panel_future {
+            if (group.size() == 1)
+            {
+                return hpx::make_ready_future(std::move(panel));
+            }
+            if (this_site == owner)
+            {
+                return hpx::collectives::broadcast_to(basename.c_str(),
+                    std::move(panel),
+                    hpx::collectives::num_sites_arg{group.size()},
+                    hpx::collectives::this_site_arg{this_site},
+                    hpx::collectives::generation_arg{p + 1},
+                    hpx::collectives::root_site_arg{owner});
+            }
+            return hpx::collectives::broadcast_from<matrix_type>(
+                basename.c_str(), hpx::collectives::this_site_arg{this_site},
+                hpx::collectives::generation_arg{p + 1},
+                hpx::collectives::root_site_arg{owner});
+        };
+
+        struct panel_exchange
+        {
+            panel_future lhs_;
+            panel_future rhs_;
+            std::size_t lhs_owner_;
+            std::size_t rhs_owner_;
+        };
+
+        auto start_exchange = [&](std::size_t p) -> panel_exchange {
+            std::size_t lhs_owner = find_owner(row_group, lhs_localities, 1, p);
+            std::size_t rhs_owner =
+                find_owner(column_group, rhs_localities, 0, p);
+            std::size_t panel_size = bounds[p + 1] - bounds[p];
+
+            matrix_type lhs_panel;
+            if (lhs_owner == row_site)
+            {
+                lhs_panel = blaze::submatrix(lhs.matrix(), 0,
+                    bounds[p] - lhs_col_span.start_, lhs.dimension(0),
+                    panel_size);
+            }
+            matrix_type rhs_panel;
+            if (rhs_owner == column_site)
+            {
+                rhs_panel = blaze::submatrix(rhs.matrix(),
+                    bounds[p] - rhs_row_span.start_, 0, panel_size,
+                    rhs.dimension(1));
+            }
+
+            return panel_exchange{
+                broadcast(lhs_basename, row_group, row_site, lhs_owner,
+                    std::move(lhs_panel), p),
+                broadcast(rhs_basename, column_group, column_site, rhs_owner,
+                    std::move(rhs_panel), p),
+                lhs_owner, rhs_owner};
+        };
+
+        auto receive = [&](panel_future& f, std::size_t owner,
+                           std::size_t this_site) -> matrix_type {
+            matrix_type data = f.get();
+            if (owner != this_site && transferred_bytes != nullptr)
+            {
+                *transferred_bytes +=
+                    std::int64_t(data.rows() * data.columns() * sizeof(T));
+            }
+            return data;
+        };
+
+        matrix_type result_matrix(lhs.dimension(0), rhs.dimension(1), T{0});
+
+        // the broadcasts for the next panel are started before the product
+        // of the current panel is being computed
+        panel_exchange next;
+        if (!panels.empty())
+        {
+            next = start_exchange(panels[0]);
+        }
+        for (std::size_t i = 0; i != panels.size(); ++i)
+        {
+            panel_exchange current = std::move(next);
+            if (i + 1 != panels.size())
+            {
+                next = start_exchange(panels[i + 1]);
+            }
+
+            matrix_type lhs_panel =
+                receive(current.lhs_, current.lhs_owner_, row_site);
+            matrix_type rhs_panel =
+                receive(current.rhs_, current.rhs_owner_, column_site);
+
+            result_matrix += lhs_panel * rhs_panel;
+        }
+
+        // sum up the partial results computed by the replicas
+        if (layers > 1)
+        {
+            auto const& row_span = lhs_tiles[locality_id].spans_[0];
+            auto const& column_span = rhs_tiles[locality_id].spans_[1];
+            std::string basename = "summa_replicas_" +
+                lhs_localities.annotation_.name_ + "/" +
+                std::to_string(lhs_localities.annotation_.generation_) + "/" +
+                std::to_string(row_span.start_) + "/" +
+                std::to_string(column_span.start_);
+
+            result_matrix = hpx::collectives::all_reduce(basename.c_str(),
+                std::move(result_matrix), blaze::Add{},
+                hpx::collectives::num_sites_arg{layers},
+                hpx::collectives::this_site_arg{layer},
+                hpx::collectives::generation_arg{1})
+                                .get();
+
+            if (transferred_bytes != nullptr)
+            {
+                *transferred_bytes += std::int64_t(result_matrix.rows() *
+                    result_matrix.columns() * sizeof(T));
+            }
+        }
+
+        return result_matrix;
+    }
+}}}
+
+#endif
@@ -17,7 +17,6 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <memory>
 #include <string>
 #include <utility>
@@ -38,13 +37,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::string const& name, std::string const& codename);
 
     private:
-        primitive_argument_type dist_read_2d(std::ifstream&& infile,
-            std::string const& filename, std::string const& tiling_type,
+        primitive_argument_type dist_read_2d(std::string const& filename,
+            std::string const& tiling_type,
             std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const&
                 intersections,
             std::string&& given_name, std::uint32_t numtiles) const;
-        primitive_argument_type dist_read_3d(std::ifstream&& infile,
-            std::string const& filename, std::int64_t given_nrows,
+        primitive_argument_type dist_read_3d(std::string const& filename,
+            std::int64_t given_nrows,
             std::string const& tiling_type,
             std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const&
                 intersections,
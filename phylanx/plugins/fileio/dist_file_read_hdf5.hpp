@@ -0,0 +1,63 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_DIST_FILE_READ_HDF5)
+#define PHYLANX_PRIMITIVES_DIST_FILE_READ_HDF5
+
+#include <phylanx/config.hpp>
+
+#if defined(PHYLANX_HAVE_HIGHFIVE)
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    class dist_file_read_hdf5
+      : public primitive_component_base
+      , public std::enable_shared_from_this<dist_file_read_hdf5>
+    {
+    public:
+        static match_pattern_type const match_data;
+
+        dist_file_read_hdf5() = default;
+
+        dist_file_read_hdf5(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        primitive_argument_type dist_read(std::string const& filename,
+            std::string const& dataset_name, std::string const& tiling_type,
+            std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const&
+                intersections,
+            std::string&& given_name, std::uint32_t numtiles) const;
+
+    protected:
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+    };
+
+    inline primitive create_dist_file_read_hdf5(hpx::id_type const& locality,
+        primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "file_read_hdf5_d", std::move(operands), name, codename);
+    }
+}}}
+
+#endif
+#endif
@@ -0,0 +1,110 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_FILE_READ_CHUNKS)
+#define PHYLANX_PRIMITIVES_FILE_READ_CHUNKS
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+
+#include <hpx/futures/future.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    namespace detail
+    {
+        // shared state describing a file that is being read in chunks
+        struct chunked_file;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // file_read_chunks(filename, rows_per_chunk, dataset) returns a list of
+    // lazily evaluated row blocks of the given csv (or hdf5) file. Nothing is
+    // read from disk before an element of the list is evaluated.
+    class file_read_chunks
+      : public primitive_component_base
+      , public std::enable_shared_from_this<file_read_chunks>
+    {
+    public:
+        static match_pattern_type const match_data;
+
+        file_read_chunks() = default;
+
+        file_read_chunks(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        primitive_argument_type create_chunks(std::string const& filename,
+            std::size_t rows_per_chunk, primitive_argument_type&& dataset) const;
+
+    protected:
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+
+    private:
+        // the most recently opened file
+        mutable hpx::lcos::local::spinlock mtx_;
+        mutable std::shared_ptr<detail::chunked_file> file_;
+    };
+
+    inline primitive create_file_read_chunks(hpx::id_type const& locality,
+        primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "file_read_chunks", std::move(operands), name, codename);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // file_read_chunk(filename, first_row, num_rows, dataset) reads a single
+    // row block, these are created by file_read_chunks. Evaluating a chunk
+    // starts reading the next chunk of the same file in the background.
+    class file_read_chunk
+      : public primitive_component_base
+      , public std::enable_shared_from_this<file_read_chunk>
+    {
+    public:
+        static match_pattern_type const match_data;
+
+        file_read_chunk() = default;
+
+        file_read_chunk(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    protected:
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+
+    private:
+        std::shared_ptr<detail::chunked_file> get_file(
+            std::string const& filename, std::string const& dataset) const;
+
+        // keeps the file open for as long as this chunk is alive
+        mutable hpx::lcos::local::spinlock mtx_;
+        mutable std::shared_ptr<detail::chunked_file> file_;
+    };
+
+    inline primitive create_file_read_chunk(hpx::id_type const& locality,
+        primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "file_read_chunk", std::move(operands), name, codename);
+    }
+}}}
+
+#endif
@@ -13,7 +13,6 @@
 #include <hpx/futures/future.hpp>
 
 #include <cstdint>
-#include <fstream>
 #include <memory>
 #include <string>
 #include <utility>
@@ -34,10 +33,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::string const& name, std::string const& codename);
 
     private:
-        primitive_argument_type read(
-            std::ifstream&& infile, std::string const& filename) const;
+        primitive_argument_type read(std::string const& filename) const;
 
-        primitive_argument_type read_3d(std::ifstream&& infile,
+        primitive_argument_type read_3d(
             std::string const& filename, std::int64_t given_nrows) const;
 
     protected:
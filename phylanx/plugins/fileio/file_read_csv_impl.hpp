@@ -10,11 +10,15 @@
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
 #include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
 #include <phylanx/plugins/fileio/file_read_csv.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+#include <phylanx/util/mapped_file.hpp>
 
 #include <hpx/futures/future.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/runtime.hpp>
 #include <hpx/include/util.hpp>
 
 #include <boost/spirit/include/qi_char.hpp>
@@ -23,70 +27,328 @@
 #include <boost/spirit/include/qi_parse.hpp>
 #include <boost/spirit/include/qi_real.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
-#include <iomanip>
-#include <memory>
+#include <iterator>
 #include <stdexcept>
 #include <string>
-#include <tuple>
-#include <utility>
 #include <vector>
 
+#if defined(PHYLANX_HAVE_CXX17_FLOATING_POINT_FROM_CHARS)
+#include <charconv>
+#include <system_error>
+#endif
+
 namespace phylanx { namespace execution_tree { namespace primitives
 {
+    ///////////////////////////////////////////////////////////////////////////
+    // The layout of a csv file as discovered by scan_csv_layout. The data
+    // section of the file (everything after an optional header) is split into
+    // chunks starting at line boundaries. For each chunk we know its byte
+    // offset and the index of its first row, which allows to seek directly to
+    // any given row without parsing anything that precedes it.
+    struct csv_layout
+    {
+        std::size_t n_rows = 0;
+        std::size_t n_cols = 0;
 
-    // read data from given file and return content
-    inline std::tuple<std::vector<double>, std::size_t, std::size_t>
-    read_helper(std::ifstream&& infile, std::string const& filename)
+        // chunk_offsets.size() == chunk_first_row.size() == num_chunks + 1,
+        // the last entries are the file size and n_rows respectively
+        std::vector<std::size_t> chunk_offsets;
+        std::vector<std::size_t> chunk_first_row;
+    };
+
+    namespace detail
     {
-        std::string line;
-        bool header_parsed = false;
-        std::vector<double> matrix_array, current_line;
-        std::size_t n_rows = 0, n_cols = 0;
-        std::size_t before_readln, after_readln;
+        // minimal number of bytes handled by a single chunk
+        constexpr std::size_t csv_min_chunk_size = 1024 * 1024;
 
-        while (std::getline(infile, line))
+        // row filter selecting all rows
+        struct csv_all_rows
         {
-            before_readln = matrix_array.size();
+            constexpr bool operator()(std::size_t) const
+            {
+                return true;
+            }
+        };
 
-            auto begin_local = line.begin();
-            if (boost::spirit::qi::parse(begin_local, line.end(),
-                    boost::spirit::qi::double_ % ',', current_line))
+        // return the end of the line starting at 'first', excluding the line
+        // terminator (either "\n" or "\r\n")
+        inline char const* csv_line_end(char const* first, char const* last)
+        {
+            char const* eol = std::find(first, last, '\n');
+            if (eol != first && *(eol - 1) == '\r')
             {
-                if (begin_local == line.end() || header_parsed)
-                {
-                    header_parsed = true;
+                --eol;
+            }
+            return eol;
+        }
+
+        inline char const* csv_next_line(char const* first, char const* last)
+        {
+            char const* eol = std::find(first, last, '\n');
+            return eol == last ? last : eol + 1;
+        }
 
-                    matrix_array.insert(matrix_array.end(),
-                        current_line.begin(), current_line.end());
+        // find the first line starting at or after 'pos'
+        inline char const* csv_resync(
+            char const* pos, char const* data_begin, char const* last)
+        {
+            if (pos <= data_begin)
+            {
+                return data_begin;
+            }
 
-                    after_readln = matrix_array.size();
-                    if (n_rows == 0)
-                    {
-                        n_cols = matrix_array.size();
-                    }
-                    else if (n_cols != (after_readln - before_readln))
+            // the line starts right after the first '\n' found at or after
+            // pos - 1
+            return csv_next_line(pos - 1, last);
+        }
+
+        // count the number of lines in [first, last), a trailing line that is
+        // not terminated by '\n' is counted only if 'is_last' is true (i.e.
+        // if 'last' is the end of the file)
+        inline std::size_t csv_count_rows(
+            char const* first, char const* last, bool is_last)
+        {
+            std::size_t rows = std::count(first, last, '\n');
+            if (is_last && first != last && *(last - 1) != '\n')
+            {
+                ++rows;
+            }
+            return rows;
+        }
+
+        // convert a single value starting at 'it', advance 'it' past the
+        // converted characters
+        inline bool csv_parse_value(
+            char const*& it, char const* last, double& value)
+        {
+#if defined(PHYLANX_HAVE_CXX17_FLOATING_POINT_FROM_CHARS)
+            // std::from_chars does not accept a leading '+', a second sign
+            // following it is malformed
+            if (it != last && *it == '+')
+            {
+                ++it;
+                if (it != last && (*it == '+' || *it == '-'))
+                {
+                    return false;
+                }
+            }
+            auto result = std::from_chars(it, last, value);
+            if (result.ec != std::errc())
+            {
+                return false;
+            }
+            it = result.ptr;
+            return true;
+#else
+            return boost::spirit::qi::parse(
+                it, last, boost::spirit::qi::double_, value);
+#endif
+        }
+
+        // parse one line of csv data, invoking f(column, value) for each of
+        // the columns in [col_begin, col_end), all other columns are skipped
+        // without being converted
+        template <typename F>
+        void csv_parse_line(char const* first, char const* last,
+            std::size_t n_cols, std::size_t col_begin, std::size_t col_end,
+            std::string const& filename, std::size_t row, F&& f)
+        {
+            std::size_t col = 0;
+            char const* it = first;
+            while (true)
+            {
+                if (col >= col_begin && col < col_end)
+                {
+                    double value = 0.0;
+                    if (!csv_parse_value(it, last, value))
                     {
-                        throw std::runtime_error(util::generate_error_message(
-                            "wrong data format, different number of element in "
-                            "this row " +
-                            filename + ':' + std::to_string(n_rows)));
+                        throw std::runtime_error(
+                            util::generate_error_message("wrong data format " +
+                                filename + ':' + std::to_string(row)));
                     }
-                    n_rows++;
+                    f(col, value);
+                }
+                else
+                {
+                    it = std::find(it, last, ',');
                 }
-                current_line.clear();
+
+                ++col;
+                if (it == last)
+                {
+                    break;
+                }
+                if (*it != ',')
+                {
+                    throw std::runtime_error(
+                        util::generate_error_message("wrong data format " +
+                            filename + ':' + std::to_string(row)));
+                }
+                ++it;
+            }
+
+            if (col != n_cols)
+            {
+                throw std::runtime_error(util::generate_error_message(
+                    "wrong data format, different number of element in "
+                    "this row " +
+                    filename + ':' + std::to_string(row)));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Discover the number of rows and columns of the given csv file without
+    // converting any of the values. Lines preceding the first line that
+    // consists of numeric values only are treated as header lines.
+    inline csv_layout scan_csv_layout(util::mapped_file const& file)
+    {
+        namespace qi = boost::spirit::qi;
+
+        char const* const first = file.begin();
+        char const* const last = file.end();
+
+        csv_layout layout;
+
+        // skip header, determine number of columns
+        char const* data_begin = first;
+        std::vector<double> current_line;
+        while (data_begin != last)
+        {
+            char const* eol = detail::csv_line_end(data_begin, last);
+
+            char const* it = data_begin;
+            if (!qi::parse(it, eol, qi::double_ % ',', current_line))
+            {
+                throw std::runtime_error(util::generate_error_message(
+                    "wrong data format " + file.filename() + ":0"));
             }
-            else
+
+            if (it == eol)
             {
-                throw std::runtime_error(
-                    util::generate_error_message("wrong data format " +
-                        filename + ':' + std::to_string(n_rows)));
+                layout.n_cols = current_line.size();
+                break;
             }
+
+            current_line.clear();
+            data_begin = detail::csv_next_line(eol, last);
+        }
+
+        if (layout.n_cols == 0)
+        {
+            // no data in this file
+            layout.chunk_offsets.push_back(file.size());
+            layout.chunk_first_row.push_back(0);
+            return layout;
+        }
+
+        // split the data section into chunks that start on line boundaries
+        std::size_t data_size = last - data_begin;
+        std::size_t num_chunks = (std::max)(std::size_t(1),
+            (std::min)(4 * std::size_t(hpx::get_os_thread_count()),
+                data_size / detail::csv_min_chunk_size));
+
+        layout.chunk_offsets.resize(num_chunks + 1);
+        layout.chunk_first_row.resize(num_chunks + 1);
+
+        layout.chunk_offsets[0] = data_begin - first;
+        layout.chunk_offsets[num_chunks] = file.size();
+
+        for (std::size_t i = 1; i != num_chunks; ++i)
+        {
+            layout.chunk_offsets[i] = detail::csv_resync(
+                data_begin + i * (data_size / num_chunks), data_begin, last) -
+                first;
         }
 
-        return std::move(std::make_tuple(matrix_array, n_rows, n_cols));
+        // count rows in each of the chunks
+        std::vector<std::size_t> rows(num_chunks);
+        hpx::for_loop(hpx::execution::par, std::size_t(0), num_chunks,
+            [&](std::size_t i)
+            {
+                rows[i] = detail::csv_count_rows(
+                    first + layout.chunk_offsets[i],
+                    first + layout.chunk_offsets[i + 1],
+                    layout.chunk_offsets[i + 1] == file.size());
+            });
+
+        layout.chunk_first_row[0] = 0;
+        for (std::size_t i = 0; i != num_chunks; ++i)
+        {
+            layout.chunk_first_row[i + 1] =
+                layout.chunk_first_row[i] + rows[i];
+        }
+        layout.n_rows = layout.chunk_first_row[num_chunks];
+
+        return layout;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Parse the rows [row_begin, row_end) and the columns [col_begin, col_end)
+    // of the csv file described by the given layout. Only the chunks holding
+    // the requested rows are touched, those are parsed concurrently. Rows for
+    // which keep_row(row) returns false are skipped without being converted.
+    // For each converted value f(row, column, value) is invoked.
+    template <typename RowFilter, typename F>
+    void parse_csv_rows(util::mapped_file const& file, csv_layout const& layout,
+        std::size_t row_begin, std::size_t row_end, std::size_t col_begin,
+        std::size_t col_end, RowFilter&& keep_row, F&& f)
+    {
+        if (row_begin >= row_end || col_begin >= col_end)
+        {
+            return;
+        }
+
+        if (row_end > layout.n_rows || col_end > layout.n_cols)
+        {
+            throw std::runtime_error(util::generate_error_message(
+                "requested rows or columns are out of range for file: " +
+                file.filename()));
+        }
+
+        // find the chunks that hold the requested rows
+        auto first_chunk = std::upper_bound(layout.chunk_first_row.begin(),
+            layout.chunk_first_row.end(), row_begin);
+        auto last_chunk = std::lower_bound(
+            first_chunk, layout.chunk_first_row.end(), row_end);
+
+        std::size_t chunk_begin =
+            std::distance(layout.chunk_first_row.begin(), first_chunk) - 1;
+        std::size_t chunk_end =
+            std::distance(layout.chunk_first_row.begin(), last_chunk);
+
+        hpx::for_loop(hpx::execution::par, chunk_begin, chunk_end,
+            [&](std::size_t chunk)
+            {
+                char const* it = file.begin() + layout.chunk_offsets[chunk];
+                char const* last =
+                    file.begin() + layout.chunk_offsets[chunk + 1];
+
+                std::size_t row = layout.chunk_first_row[chunk];
+                std::size_t end = (std::min)(
+                    row_end, layout.chunk_first_row[chunk + 1]);
+
+                for (/**/; row != end && it != last; ++row)
+                {
+                    if (row < row_begin || !keep_row(row))
+                    {
+                        it = detail::csv_next_line(it, last);
+                        continue;
+                    }
+
+                    char const* eol = detail::csv_line_end(it, last);
+                    detail::csv_parse_line(it, eol, layout.n_cols, col_begin,
+                        col_end, file.filename(), row,
+                        [&](std::size_t col, double value)
+                        {
+                            f(row, col, value);
+                        });
+                    it = detail::csv_next_line(eol, last);
+                }
+            });
     }
 }}}
 
@@ -14,13 +14,16 @@
 
 #include <hpx/futures/future.hpp>
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 namespace phylanx { namespace execution_tree { namespace primitives
 {
-    class file_read_hdf5 : public primitive_component_base
+    class file_read_hdf5
+      : public primitive_component_base
+      , public std::enable_shared_from_this<file_read_hdf5>
     {
     public:
         static match_pattern_type const match_data;
@@ -30,6 +33,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         file_read_hdf5(primitive_arguments_type&& operands,
             std::string const& name, std::string const& codename);
 
+    protected:
         hpx::future<primitive_argument_type> eval(
             primitive_arguments_type const& operands,
             primitive_arguments_type const& args,
@@ -0,0 +1,172 @@
+//  Copyright (c) 2018 Alireza Kheirkhahan
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_FILE_READ_HDF5_IMPL_HPP)
+#define PHYLANX_PRIMITIVES_FILE_READ_HDF5_IMPL_HPP
+
+#include <phylanx/config.hpp>
+
+#if defined(PHYLANX_HAVE_HIGHFIVE)
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/synchronization/mutex.hpp>
+
+#include <phylanx/util/detail/blaze-highfive.hpp>
+#include <highfive/H5DataSet.hpp>
+#include <highfive/H5DataSpace.hpp>
+#include <highfive/H5File.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The HDF5 library is thread-safe only if it was built that way. All
+    // HighFive objects of this plugin are created, used, and destroyed while
+    // holding this (process-wide) mutex.
+    hpx::lcos::local::mutex& hdf5_mutex();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Read the hyperslab [offset, offset + count) of the given dataset. Empty
+    // offset and count vectors select the beginning and the remainder of the
+    // dataset, respectively. Only the selected elements are read from disk.
+    inline primitive_argument_type read_hdf5_hyperslab(
+        HighFive::DataSet const& dataSet, std::vector<std::size_t> offset,
+        std::vector<std::size_t> count, std::string const& name,
+        std::string const& codename)
+    {
+        HighFive::DataSpace dataSpace = dataSet.getSpace();
+        std::vector<std::size_t> dims = dataSpace.getDimensions();
+
+        if (dims.empty())
+        {
+            if (!offset.empty() || !count.empty())
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::primitives::read_hdf5_hyperslab",
+                    util::generate_error_message(
+                        "a hyperslab can't be selected from a scalar dataset",
+                        name, codename));
+            }
+
+            // scalar value
+            double scalar;
+            dataSet.read(scalar);
+            return primitive_argument_type{ir::node_data<double>{scalar}};
+        }
+
+        if (offset.empty())
+        {
+            offset.resize(dims.size(), 0);
+        }
+        if (count.empty())
+        {
+            count.resize(dims.size());
+            for (std::size_t i = 0; i != dims.size(); ++i)
+            {
+                count[i] = offset[i] < dims[i] ? dims[i] - offset[i] : 0;
+            }
+        }
+
+        if (offset.size() != dims.size() || count.size() != dims.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::execution_tree::primitives::read_hdf5_hyperslab",
+                util::generate_error_message(
+                    "offset and count must have as many elements as the "
+                    "dataset has dimensions",
+                    name, codename));
+        }
+
+        for (std::size_t i = 0; i != dims.size(); ++i)
+        {
+            if (offset[i] + count[i] > dims[i])
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::primitives::read_hdf5_hyperslab",
+                    util::generate_error_message(
+                        "the selected hyperslab exceeds the dimensions of "
+                        "the dataset",
+                        name, codename));
+            }
+        }
+
+        switch (dims.size())
+        {
+        case 1:
+            {
+                // vector
+                blaze::DynamicVector<double> vector(count[0]);
+                if (count[0] != 0)
+                {
+                    dataSet.select(offset, count).read(vector);
+                }
+                return primitive_argument_type{
+                    ir::node_data<double>{std::move(vector)}};
+            }
+
+        case 2:
+            {
+                // matrix
+                blaze::DynamicMatrix<double> matrix(count[0], count[1]);
+                if (count[0] != 0 && count[1] != 0)
+                {
+                    dataSet.select(offset, count).read(matrix);
+                }
+                return primitive_argument_type{
+                    ir::node_data<double>{std::move(matrix)}};
+            }
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::primitives::read_hdf5_hyperslab",
+            util::generate_error_message(
+                "the input file has incompatible number of dimensions", name,
+                codename));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // extract a list of non-negative integers (e.g. an offset or a count)
+    inline std::vector<std::size_t> extract_hdf5_extents(
+        primitive_argument_type&& arg, std::string const& name,
+        std::string const& codename)
+    {
+        std::vector<std::size_t> result;
+        if (is_list_operand_strict(arg))
+        {
+            ir::range&& list =
+                extract_list_value_strict(std::move(arg), name, codename);
+            result.reserve(list.size());
+            for (auto const& elem : list)
+            {
+                result.push_back(static_cast<std::size_t>(
+                    extract_scalar_nonneg_integer_value_strict(
+                        elem, name, codename)));
+            }
+        }
+        else
+        {
+            result.push_back(static_cast<std::size_t>(
+                extract_scalar_nonneg_integer_value_strict(
+                    std::move(arg), name, codename)));
+        }
+        return result;
+    }
+}}}
+
+#endif
+#endif
@@ -7,7 +7,9 @@
 #define PHYLANX_PLUGINS_FILEIO_APR_10_2108_1130AM
 
 #include <phylanx/plugins/fileio/dist_file_read_csv.hpp>
+#include <phylanx/plugins/fileio/dist_file_read_hdf5.hpp>
 #include <phylanx/plugins/fileio/file_read.hpp>
+#include <phylanx/plugins/fileio/file_read_chunks.hpp>
 #include <phylanx/plugins/fileio/file_read_csv.hpp>
 #include <phylanx/plugins/fileio/file_read_hdf5.hpp>
 #include <phylanx/plugins/fileio/file_write.hpp>
@@ -97,6 +97,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_argument_type dot_nd(
             primitive_argument_type&& lhs, primitive_argument_type&& rhs) const;
 
+        // at least one of the (up to 2-dimensional) operands is sparse
+        primitive_argument_type dot_sparse(
+            ir::node_data<double>&& lhs, ir::node_data<double>&& rhs) const;
+
         primitive_argument_type contraction2d(
             primitive_argument_type&& lhs, primitive_argument_type&& rhs) const;
 
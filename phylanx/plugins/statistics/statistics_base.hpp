@@ -51,6 +51,17 @@ namespace phylanx { namespace execution_tree { namespace primitives {
 
         statistics_base(primitive_arguments_type&& operands,
             std::string const& name, std::string const& codename);
+
+        // Primitives that are able to reduce sparse data directly hide this
+        // function and return a valid result. By default, sparse data is
+        // expanded before being reduced.
+        primitive_argument_type handle_sparse_operand(
+            primitive_argument_type const& arg,
+            hpx::util::optional<std::int64_t> const& axis, bool keepdims,
+            primitive_argument_type const& initial, node_data_type dtype) const
+        {
+            return primitive_argument_type{};
+        }
     };
 }}}    // namespace phylanx::execution_tree::primitives
 
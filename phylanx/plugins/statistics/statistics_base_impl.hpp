@@ -112,6 +112,16 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                     }
                 }
 
+                if (is_sparse_operand(args[0]))
+                {
+                    auto result = this_->handle_sparse_operand(
+                        args[0], axis, keepdims, initial, dtype);
+                    if (valid(result))
+                    {
+                        return result;
+                    }
+                }
+
                 return common::statisticsnd<Op>(std::move(args[0]), axis,
                     keepdims, std::move(initial), dtype, this_->name_,
                     this_->codename_, std::move(ctx));
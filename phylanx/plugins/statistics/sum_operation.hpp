@@ -12,6 +12,9 @@
 #include <phylanx/plugins/common/statistics_operations.hpp>
 #include <phylanx/plugins/statistics/statistics_base.hpp>
 
+#include <hpx/datastructures/optional.hpp>
+
+#include <cstdint>
 #include <string>
 #include <utility>
 #include <vector>
@@ -42,6 +45,12 @@ namespace phylanx { namespace execution_tree { namespace primitives {
 
         sum_operation(primitive_arguments_type&& operands,
             std::string const& name, std::string const& codename);
+
+        // sums of sparse data are computed from the non-zero elements only
+        primitive_argument_type handle_sparse_operand(
+            primitive_argument_type const& arg,
+            hpx::util::optional<std::int64_t> const& axis, bool keepdims,
+            primitive_argument_type const& initial, node_data_type dtype) const;
     };
 
     inline primitive create_sum_operation(hpx::id_type const& locality,
@@ -85,6 +85,11 @@ namespace phylanx { namespace traits
     {
     };
 
+    template <typename T, bool TF>
+    struct is_vector<blaze::CompressedVector<T, TF>> : std::true_type
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, bool SO>
     struct is_matrix<blaze::DynamicMatrix<T, SO>> : std::true_type
@@ -97,6 +102,11 @@ namespace phylanx { namespace traits
     {
     };
 
+    template <typename T, bool SO>
+    struct is_matrix<blaze::CompressedMatrix<T, SO>> : std::true_type
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     struct is_tensor<blaze::DynamicTensor<T>> : std::true_type
@@ -13,6 +13,7 @@
 #include <highfive/H5DataSet.hpp>
 #include <highfive/H5DataSpace.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <stdexcept>
 #include <vector>
@@ -116,6 +117,8 @@ struct data_converter<blaze::CustomVector<T, AF, PF, TF, RT>, void>
     std::vector<std::size_t> _dims;
 };
 
+// Blaze matrices may pad their rows (spacing() != columns()), in which case
+// the data has to be staged through a contiguous buffer.
 template <typename T, bool SO>
 struct data_converter<blaze::DynamicMatrix<T, SO>, void>
 {
@@ -133,21 +136,44 @@ struct data_converter<blaze::DynamicMatrix<T, SO>, void>
         {
             matrix.resize(_dims[0], _dims[1]);
         }
-        return matrix.data();
+        if (matrix.spacing() == matrix.columns())
+        {
+            return matrix.data();
+        }
+        _buffer.resize(_dims[0] * _dims[1]);
+        return _buffer.data();
     }
 
     inline typename inspector<T>::type const* transform_write(
-        Matrix const& matrix) const noexcept
+        Matrix const& matrix) const
     {
-        return matrix.data();
+        if (matrix.spacing() == matrix.columns())
+        {
+            return matrix.data();
+        }
+        _buffer.resize(matrix.rows() * matrix.columns());
+        for (std::size_t i = 0; i != matrix.rows(); ++i)
+        {
+            std::copy(matrix.begin(i), matrix.end(i),
+                _buffer.begin() + i * matrix.columns());
+        }
+        return _buffer.data();
     }
 
     inline void process_result(Matrix& matrix) const
     {
-        (void) matrix;
+        if (!_buffer.empty())
+        {
+            for (std::size_t i = 0; i != matrix.rows(); ++i)
+            {
+                auto row = _buffer.begin() + i * matrix.columns();
+                std::copy(row, row + matrix.columns(), matrix.begin(i));
+            }
+        }
     }
 
     std::vector<std::size_t> _dims;
+    mutable std::vector<typename inspector<T>::type> _buffer;
 };
 
 template <typename T, blaze::AlignmentFlag AF, blaze::PaddingFlag PF, bool SO,
@@ -169,9 +195,19 @@ struct data_converter<blaze::CustomMatrix<T, AF, PF, SO, RT>, void>
     }
 
     inline typename inspector<T>::type const* transform_write(
-        Matrix const& matrix) const noexcept
+        Matrix const& matrix) const
     {
-        return matrix.data();
+        if (matrix.spacing() == matrix.columns())
+        {
+            return matrix.data();
+        }
+        _buffer.resize(matrix.rows() * matrix.columns());
+        for (std::size_t i = 0; i != matrix.rows(); ++i)
+        {
+            std::copy(matrix.begin(i), matrix.end(i),
+                _buffer.begin() + i * matrix.columns());
+        }
+        return _buffer.data();
     }
 
     inline void process_result(Matrix& matrix) const
@@ -180,6 +216,7 @@ struct data_converter<blaze::CustomMatrix<T, AF, PF, SO, RT>, void>
     }
 
     std::vector<std::size_t> _dims;
+    mutable std::vector<typename inspector<T>::type> _buffer;
 };
 
 }}
@@ -77,6 +77,9 @@ namespace phylanx { namespace util { namespace server {
             return &data_;
         }
 
+        // The local part references memory owned by the caller, which may
+        // be released before the reply has been sent. It is copied into the
+        // returned data (which is then sent without further copies).
         data_type fetch() const
         {
             return data_;
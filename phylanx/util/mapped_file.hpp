@@ -0,0 +1,71 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_MAPPED_FILE_HPP)
+#define PHYLANX_UTIL_MAPPED_FILE_HPP
+
+#include <phylanx/config.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Read-only memory mapping of a whole file. The mapping is released when
+    // the object goes out of scope.
+    class mapped_file
+    {
+    public:
+        PHYLANX_EXPORT explicit mapped_file(std::string const& filename);
+        PHYLANX_EXPORT ~mapped_file();
+
+        mapped_file(mapped_file const&) = delete;
+        mapped_file(mapped_file&&) = delete;
+        mapped_file& operator=(mapped_file const&) = delete;
+        mapped_file& operator=(mapped_file&&) = delete;
+
+        char const* data() const
+        {
+            return data_;
+        }
+        char const* begin() const
+        {
+            return data_;
+        }
+        char const* end() const
+        {
+            return data_ + size_;
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        std::string const& filename() const
+        {
+            return filename_;
+        }
+
+    private:
+        std::string filename_;
+        char const* data_;
+        std::size_t size_;
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
+        void* file_;
+        void* mapping_;
+#else
+        int fd_;
+#endif
+    };
+}}
+
+#endif
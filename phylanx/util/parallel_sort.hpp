@@ -0,0 +1,154 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_PARALLEL_SORT)
+#define PHYLANX_UTIL_PARALLEL_SORT
+
+#include <phylanx/config.hpp>
+
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/runtime.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Sorting algorithms selectable using the 'kind' argument of sort() and
+    // argsort(). 'quicksort' and 'heapsort' both map onto std::sort (which
+    // is an introsort falling back to heapsort), 'mergesort' and 'stable'
+    // preserve the order of equal elements.
+    inline bool is_valid_sort_kind(std::string const& kind)
+    {
+        return kind == "quicksort" || kind == "mergesort" ||
+            kind == "heapsort" || kind == "stable";
+    }
+
+    inline bool is_stable_sort_kind(std::string const& kind)
+    {
+        return kind == "mergesort" || kind == "stable";
+    }
+
+    namespace detail
+    {
+        // sequences shorter than this are sorted by the calling thread
+        constexpr std::size_t parallel_sort_min_chunk_size = 32768;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Merge the consecutive sorted chunks [bounds[i], bounds[i + 1]) into
+    // one sorted sequence. Neighboring chunks are merged pairwise, all
+    // merges of one round run concurrently. The merge is stable.
+    template <typename Iter, typename Compare>
+    void merge_sorted_chunks(std::vector<Iter> const& bounds, Compare comp)
+    {
+        std::size_t const num_chunks = bounds.empty() ? 0 : bounds.size() - 1;
+
+        for (std::size_t width = 1; width < num_chunks; width *= 2)
+        {
+            std::size_t const num_merges =
+                (num_chunks + 2 * width - 1) / (2 * width);
+
+            hpx::for_loop(hpx::execution::par, std::size_t(0), num_merges,
+                [&](std::size_t i)
+                {
+                    std::size_t const first = 2 * i * width;
+                    std::size_t const middle =
+                        (std::min)(first + width, num_chunks);
+                    std::size_t const last =
+                        (std::min)(first + 2 * width, num_chunks);
+
+                    if (middle < last)
+                    {
+                        std::inplace_merge(bounds[first], bounds[middle],
+                            bounds[last], comp);
+                    }
+                });
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sort the given sequence using all HPX worker threads. The sequence is
+    // split into one chunk per thread, the chunks are sorted concurrently
+    // and are then merged. The overall sort is stable if the chunks are
+    // sorted using std::stable_sort.
+    template <typename Iter, typename Compare>
+    void parallel_sort(Iter begin, Iter end, Compare comp, bool stable = false)
+    {
+        std::size_t const size = std::distance(begin, end);
+        std::size_t const num_chunks = (std::min)(
+            std::size_t(hpx::get_os_thread_count()),
+            size / detail::parallel_sort_min_chunk_size);
+
+        if (num_chunks < 2)
+        {
+            if (stable)
+            {
+                std::stable_sort(begin, end, comp);
+            }
+            else
+            {
+                std::sort(begin, end, comp);
+            }
+            return;
+        }
+
+        std::vector<Iter> bounds;
+        bounds.reserve(num_chunks + 1);
+        for (std::size_t i = 0; i != num_chunks; ++i)
+        {
+            bounds.push_back(std::next(begin, i * size / num_chunks));
+        }
+        bounds.push_back(end);
+
+        hpx::for_loop(hpx::execution::par, std::size_t(0), num_chunks,
+            [&](std::size_t i)
+            {
+                if (stable)
+                {
+                    std::stable_sort(bounds[i], bounds[i + 1], comp);
+                }
+                else
+                {
+                    std::sort(bounds[i], bounds[i + 1], comp);
+                }
+            });
+
+        merge_sorted_chunks(bounds, comp);
+    }
+
+    template <typename Iter>
+    void parallel_sort(Iter begin, Iter end, bool stable = false)
+    {
+        parallel_sort(begin, end, std::less<>{}, stable);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Invoke the given function for all independent sequences (rows,
+    // columns, or slices) [0, count), concurrently if there are enough of
+    // them to keep the worker threads busy.
+    template <typename F>
+    void for_each_sequence(std::size_t count, std::size_t size, F&& f)
+    {
+        if (count < 2 ||
+            count * size < detail::parallel_sort_min_chunk_size)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                f(i);
+            }
+            return;
+        }
+
+        hpx::for_loop(hpx::execution::par, std::size_t(0), count, f);
+    }
+}}
+
+#endif
@@ -6,8 +6,14 @@
 
 #include <phylanx/config.hpp>
 
+#include <hpx/include/parallel_for_loop.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <random>
+#include <utility>
 
 #if !defined(PHYLANX_PRIMITIVES_RANDOM_UTILS)
 #define PHYLANX_PRIMITIVES_RANDOM_UTILS
@@ -23,6 +29,139 @@ namespace phylanx { namespace util
     PHYLANX_EXPORT void set_seed(std::uint32_t seed);
 
     PHYLANX_EXPORT std::uint32_t get_seed();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Counter based random number generator (Philox4x32-10, see Salmon et al.,
+    // "Parallel random numbers: as easy as 1, 2, 3", SC'11). The generated
+    // sequence is a pure function of the seed, the stream, and the index it
+    // was positioned at, which allows to generate the elements of an array
+    // independently of each other.
+    class philox_engine
+    {
+    public:
+        using result_type = std::uint32_t;
+
+        static constexpr result_type min()
+        {
+            return 0;
+        }
+        static constexpr result_type max()
+        {
+            return 0xffffffff;
+        }
+
+        philox_engine(
+            std::uint32_t seed, std::uint64_t stream, std::uint64_t index)
+          : key_{seed, static_cast<std::uint32_t>(stream)}
+          , counter_{static_cast<std::uint32_t>(index),
+                static_cast<std::uint32_t>(index >> 32), 0,
+                static_cast<std::uint32_t>(stream >> 32)}
+          , block_{}
+          , pos_(4)
+        {
+        }
+
+        result_type operator()()
+        {
+            if (pos_ == 4)
+            {
+                block_ = generate(counter_, key_);
+                ++counter_[2];
+                pos_ = 0;
+            }
+            return block_[pos_++];
+        }
+
+        // the raw block function of the generator
+        static std::array<std::uint32_t, 4> generate(
+            std::array<std::uint32_t, 4> counter,
+            std::array<std::uint32_t, 2> key)
+        {
+            for (int round = 0; round != 10; ++round)
+            {
+                std::uint64_t p0 = std::uint64_t(0xD2511F53) * counter[0];
+                std::uint64_t p1 = std::uint64_t(0xCD9E8D57) * counter[2];
+
+                counter = {
+                    static_cast<std::uint32_t>(p1 >> 32) ^ counter[1] ^ key[0],
+                    static_cast<std::uint32_t>(p1),
+                    static_cast<std::uint32_t>(p0 >> 32) ^ counter[3] ^ key[1],
+                    static_cast<std::uint32_t>(p0)};
+
+                key[0] += 0x9E3779B9;
+                key[1] += 0xBB67AE85;
+            }
+            return counter;
+        }
+
+    private:
+        std::array<std::uint32_t, 2> key_;
+        std::array<std::uint32_t, 4> counter_;
+        std::array<std::uint32_t, 4> block_;
+        int pos_;
+    };
+
+    // Identifies the sequence of random numbers used by one request. The
+    // streams are numbered consecutively in the order in which the requests
+    // are evaluated, starting from the last call to set_seed. The results are
+    // reproducible only as long as this order is. Random primitives that are
+    // evaluated concurrently (e.g. by parallel_block) may draw their streams
+    // in any order and thus swap their results between runs.
+    struct random_stream
+    {
+        std::uint32_t seed_;
+        std::uint64_t stream_;
+    };
+
+    PHYLANX_EXPORT random_stream next_random_stream();
+
+    // Draw the element with the given (global) index of the random sequence.
+    // The distribution is reset before drawing, thus the element depends on
+    // its index only, even if the same distribution object is reused.
+    template <typename Dist>
+    typename Dist::result_type random_element(
+        Dist& dist, random_stream const& stream, std::uint64_t index)
+    {
+        philox_engine engine(stream.seed_, stream.stream_, index);
+        dist.reset();
+        return dist(engine);
+    }
+
+    // Invoke f(d, i) for all elements i of an array to fill, where d is a
+    // copy of the given distribution. Larger arrays are filled concurrently
+    // in chunks, each chunk working on its own copy of the distribution.
+    constexpr std::size_t random_min_parallel_size = 16384;
+    constexpr std::size_t random_chunk_size = 4096;
+
+    template <typename Dist, typename F>
+    void random_for_each(std::size_t size, Dist const& dist, F&& f)
+    {
+        if (size < random_min_parallel_size)
+        {
+            Dist d(dist);
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                f(d, i);
+            }
+            return;
+        }
+
+        std::size_t const chunks =
+            (size + random_chunk_size - 1) / random_chunk_size;
+
+        hpx::for_loop(hpx::execution::par, std::size_t(0), chunks,
+            [&](std::size_t chunk) {
+                std::size_t const first = chunk * random_chunk_size;
+                std::size_t const last =
+                    (std::min)(first + random_chunk_size, size);
+
+                Dist d(dist);
+                for (std::size_t i = first; i != last; ++i)
+                {
+                    f(d, i);
+                }
+            });
+    }
 }}
 
 #endif
@@ -19,6 +19,8 @@ namespace phylanx { namespace util
     PHYLANX_EXPORT std::vector<char> serialize(ir::node_data<double> const&);
     PHYLANX_EXPORT std::vector<char> serialize(ir::node_data<std::int64_t> const&);
     PHYLANX_EXPORT std::vector<char> serialize(ir::node_data<std::uint8_t> const&);
+    PHYLANX_EXPORT std::vector<char> serialize(ir::node_data<float> const&);
+    PHYLANX_EXPORT std::vector<char> serialize(ir::node_data<std::int32_t> const&);
 
     namespace detail
     {
@@ -28,6 +30,10 @@ namespace phylanx { namespace util
             std::vector<char> const&, ir::node_data<std::int64_t>&);
         PHYLANX_EXPORT void unserialize(
             std::vector<char> const&, ir::node_data<std::uint8_t>&);
+        PHYLANX_EXPORT void unserialize(
+            std::vector<char> const&, ir::node_data<float>&);
+        PHYLANX_EXPORT void unserialize(
+            std::vector<char> const&, ir::node_data<std::int32_t>&);
     }
 
     ///////////////////////////////////////////////////////////////////////////
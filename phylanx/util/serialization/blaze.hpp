@@ -11,6 +11,8 @@
 
 #include <phylanx/config.hpp>
 #include <hpx/serialization/array.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
 #include <hpx/include/util.hpp>
 
 #include <blaze/Math.h>
@@ -18,6 +20,131 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Returns the number of bytes of array data this locality has handed to
+    // the parcel layer as zero-copy chunks, i.e. without copying them into
+    // the parcel buffer.
+    PHYLANX_EXPORT std::int64_t zero_copy_bytes_sent(bool reset);
+
+    namespace detail
+    {
+        // Chunks smaller than this are copied into the parcel buffer
+        // (hpx.parcel.zero_copy_serialization_threshold)
+        PHYLANX_EXPORT std::size_t zero_copy_serialization_threshold();
+
+        PHYLANX_EXPORT void count_zero_copy_bytes_sent(std::size_t bytes);
+
+        ///////////////////////////////////////////////////////////////////////
+        // The elements of dense arrays are handed to the archive as a single
+        // binary chunk. HPX sends chunks larger than the zero-copy threshold
+        // directly from the Blaze storage, the receiving end copies the chunk
+        // straight into the (already resized) storage of the target.
+        template <typename T>
+        void save_dense(hpx::serialization::output_archive& archive,
+            T const* data, std::size_t count, std::false_type)
+        {
+            archive << hpx::serialization::make_array(data, count);
+        }
+
+        template <typename T>
+        void save_dense(hpx::serialization::output_archive& archive,
+            T const* data, std::size_t count, std::true_type)
+        {
+            if (archive.endianess_differs())
+            {
+                archive << hpx::serialization::make_array(data, count);
+                return;
+            }
+
+            std::size_t const bytes = count * sizeof(T);
+            if (!archive.is_preprocessing() &&
+                !archive.disable_data_chunking() &&
+                bytes >= zero_copy_serialization_threshold())
+            {
+                count_zero_copy_bytes_sent(bytes);
+            }
+            archive.save_binary_chunk(data, bytes);
+        }
+
+        template <typename T>
+        void save_dense(hpx::serialization::output_archive& archive,
+            T const* data, std::size_t count)
+        {
+            if (count != 0)
+            {
+                save_dense(archive, data, count, std::is_arithmetic<T>{});
+            }
+        }
+
+        template <typename T>
+        void load_dense(hpx::serialization::input_archive& archive, T* data,
+            std::size_t count, std::false_type)
+        {
+            archive >> hpx::serialization::make_array(data, count);
+        }
+
+        template <typename T>
+        void load_dense(hpx::serialization::input_archive& archive, T* data,
+            std::size_t count, std::true_type)
+        {
+            if (archive.endianess_differs())
+            {
+                archive >> hpx::serialization::make_array(data, count);
+                return;
+            }
+            archive.load_binary_chunk(data, count * sizeof(T));
+        }
+
+        template <typename T>
+        void load_dense(hpx::serialization::input_archive& archive, T* data,
+            std::size_t count)
+        {
+            if (count != 0)
+            {
+                load_dense(archive, data, count, std::is_arithmetic<T>{});
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Chunks are sent only after save() has returned, data living in
+        // temporary buffers must always be copied into the parcel buffer
+        template <typename T>
+        void save_dense_copy(hpx::serialization::output_archive& archive,
+            T const* data, std::size_t count)
+        {
+            if (std::is_arithmetic<T>::value && !archive.endianess_differs())
+            {
+                archive.save_binary(data, count * sizeof(T));
+                return;
+            }
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                archive << data[i];
+            }
+        }
+
+        template <typename T>
+        void load_dense_copy(hpx::serialization::input_archive& archive,
+            T* data, std::size_t count)
+        {
+            if (std::is_arithmetic<T>::value && !archive.endianess_differs())
+            {
+                archive.load_binary(data, count * sizeof(T));
+                return;
+            }
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                archive >> data[i];
+            }
+        }
+    }
+}}
 
 namespace hpx { namespace serialization
 {
@@ -26,14 +153,12 @@ namespace hpx { namespace serialization
     void load(
         input_archive& archive, blaze::DynamicVector<T, TF>& target, unsigned)
     {
-        // De-serialize vector
+        // De-serialize vector, the padding elements are not transferred
         std::size_t count = 0UL;
-        std::size_t spacing = 0UL;
-        archive >> count >> spacing;
+        archive >> count;
 
         target.resize(count, false);
-        archive >>
-            hpx::serialization::make_array(target.data(), spacing);
+        phylanx::util::detail::load_dense(archive, target.data(), count);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -48,8 +173,8 @@ namespace hpx { namespace serialization
         archive >> rows >> columns >> spacing;
 
         target.resize(rows, columns, false);
-        archive >>
-            hpx::serialization::make_array(target.data(), spacing * columns);
+        phylanx::util::detail::load_dense(
+            archive, target.data(), spacing * columns);
     }
 
     template <typename T>
@@ -63,8 +188,8 @@ namespace hpx { namespace serialization
         archive >> rows >> columns >> spacing;
 
         target.resize(rows, columns, false);
-        archive >>
-            hpx::serialization::make_array(target.data(), rows * spacing);
+        phylanx::util::detail::load_dense(
+            archive, target.data(), rows * spacing);
     }
 
     template <typename T>
@@ -78,8 +203,8 @@ namespace hpx { namespace serialization
         archive >> pages >> rows >> columns >> spacing;
 
         target.resize(pages, rows, columns, false);
-        archive >> hpx::serialization::make_array(
-                       target.data(), rows * spacing * pages);
+        phylanx::util::detail::load_dense(
+            archive, target.data(), rows * spacing * pages);
     }
 
     template <typename T>
@@ -96,8 +221,8 @@ namespace hpx { namespace serialization
 
         target.resize(
             std::array<std::size_t, 4UL>{columns, rows, pages, quats}, false);
-        archive >> hpx::serialization::make_array(
-                       target.data(), rows * spacing * pages * quats);
+        phylanx::util::detail::load_dense(
+            archive, target.data(), rows * spacing * pages * quats);
     }
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, blaze::AlignmentFlag AF, blaze::PaddingFlag PF,
@@ -132,17 +257,86 @@ namespace hpx { namespace serialization
         HPX_ASSERT(false);      // shouldn't ever be called
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Compressed vectors and matrices are transferred as their non-zero
+    // elements only: the indices and values are sent as two separate arrays
+    // (copied into the parcel buffer as they are collected in temporaries)
+    template <typename T, bool TF>
+    void load(input_archive& archive, blaze::CompressedVector<T, TF>& target,
+        unsigned)
+    {
+        // De-serialize sparse vector
+        std::size_t count = 0UL;
+        std::size_t nonzeros = 0UL;
+        archive >> count >> nonzeros;
+
+        std::vector<std::size_t> indices(nonzeros);
+        std::vector<T> values(nonzeros);
+        phylanx::util::detail::load_dense_copy(
+            archive, indices.data(), nonzeros);
+        phylanx::util::detail::load_dense_copy(
+            archive, values.data(), nonzeros);
+
+        target.resize(count, false);
+        target.reserve(nonzeros);
+        for (std::size_t i = 0; i != nonzeros; ++i)
+        {
+            target.append(indices[i], values[i]);
+        }
+    }
+
+    template <typename T, bool SO>
+    void load(input_archive& archive, blaze::CompressedMatrix<T, SO>& target,
+        unsigned)
+    {
+        // De-serialize sparse matrix
+        std::size_t rows = 0UL;
+        std::size_t columns = 0UL;
+        std::size_t nonzeros = 0UL;
+        archive >> rows >> columns >> nonzeros;
+
+        // number of non-zero elements for each row (column-major: column)
+        std::size_t major = SO ? columns : rows;
+        std::vector<std::size_t> counts(major);
+        std::vector<std::size_t> indices(nonzeros);
+        std::vector<T> values(nonzeros);
+        phylanx::util::detail::load_dense_copy(archive, counts.data(), major);
+        phylanx::util::detail::load_dense_copy(
+            archive, indices.data(), nonzeros);
+        phylanx::util::detail::load_dense_copy(
+            archive, values.data(), nonzeros);
+
+        target.resize(rows, columns, false);
+        target.reserve(nonzeros);
+
+        std::size_t pos = 0;
+        for (std::size_t i = 0; i != major; ++i)
+        {
+            for (std::size_t j = 0; j != counts[i]; ++j, ++pos)
+            {
+                if (SO)
+                {
+                    target.append(indices[pos], i, values[pos]);
+                }
+                else
+                {
+                    target.append(i, indices[pos], values[pos]);
+                }
+            }
+            target.finalize(i);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, bool TF>
     void save(output_archive& archive,
         blaze::DynamicVector<T, TF> const& target, unsigned)
     {
-        // Serialize vector
+        // Serialize vector, the padding elements are not transferred
         std::size_t count = target.size();
-        std::size_t spacing = target.spacing();
-        archive << count << spacing;
+        archive << count;
 
-        archive << hpx::serialization::make_array(target.data(), spacing);
+        phylanx::util::detail::save_dense(archive, target.data(), count);
     }
 
     template <typename T>
@@ -155,8 +349,8 @@ namespace hpx { namespace serialization
         std::size_t spacing = target.spacing();
         archive << rows << columns << spacing;
 
-        archive << hpx::serialization::make_array(
-            target.data(), spacing * columns);
+        phylanx::util::detail::save_dense(
+            archive, target.data(), spacing * columns);
     }
 
     template <typename T>
@@ -169,8 +363,8 @@ namespace hpx { namespace serialization
         std::size_t spacing = target.spacing();
         archive << rows << columns << spacing;
 
-        archive << hpx::serialization::make_array(
-            target.data(), rows * spacing);
+        phylanx::util::detail::save_dense(
+            archive, target.data(), rows * spacing);
     }
 
     template <typename T>
@@ -184,8 +378,8 @@ namespace hpx { namespace serialization
         std::size_t spacing = target.spacing();
         archive << pages << rows << columns << spacing;
 
-        archive << hpx::serialization::make_array(
-            target.data(), pages * rows * spacing);
+        phylanx::util::detail::save_dense(
+            archive, target.data(), pages * rows * spacing);
     }
 
     template <typename T>
@@ -200,8 +394,8 @@ namespace hpx { namespace serialization
         std::size_t spacing = target.spacing();
         archive << quats << pages << rows << columns << spacing;
 
-        archive << hpx::serialization::make_array(
-            target.data(), quats * pages * rows * spacing);
+        phylanx::util::detail::save_dense(
+            archive, target.data(), quats * pages * rows * spacing);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -210,12 +404,11 @@ namespace hpx { namespace serialization
     void save(output_archive& archive,
         blaze::CustomVector<T, AF, PF, TF, RT> const& target, unsigned)
     {
-        // Serialize vector
+        // Serialize vector, the padding elements are not transferred
         std::size_t count = target.size();
-        std::size_t spacing = target.spacing();
-        archive << count << spacing;
+        archive << count;
 
-        archive << hpx::serialization::make_array(target.data(), spacing);
+        phylanx::util::detail::save_dense(archive, target.data(), count);
     }
 
     template <typename T, blaze::AlignmentFlag AF, blaze::PaddingFlag PF,
@@ -229,8 +422,8 @@ namespace hpx { namespace serialization
         std::size_t spacing = target.spacing();
         archive << rows << columns << spacing;
 
-        archive << hpx::serialization::make_array(
-            target.data(), spacing * columns);
+        phylanx::util::detail::save_dense(
+            archive, target.data(), spacing * columns);
     }
 
     template <typename T, blaze::AlignmentFlag AF, blaze::PaddingFlag PF,
@@ -244,8 +437,8 @@ namespace hpx { namespace serialization
         std::size_t spacing = target.spacing();
         archive << rows << columns << spacing;
 
-        archive << hpx::serialization::make_array(
-            target.data(), rows * spacing);
+        phylanx::util::detail::save_dense(
+            archive, target.data(), rows * spacing);
     }
 
     template <typename T, blaze::AlignmentFlag AF, blaze::PaddingFlag PF,
@@ -260,8 +453,8 @@ namespace hpx { namespace serialization
         std::size_t spacing = target.spacing();
         archive << pages << rows << columns << spacing;
 
-        archive << hpx::serialization::make_array(
-            target.data(), pages * rows * spacing);
+        phylanx::util::detail::save_dense(
+            archive, target.data(), pages * rows * spacing);
     }
 
     template <typename T, blaze::AlignmentFlag AF, blaze::PaddingFlag PF,
@@ -277,14 +470,79 @@ namespace hpx { namespace serialization
         std::size_t spacing = target.spacing();
         archive << quats << pages << rows << columns << spacing;
 
-        archive << hpx::serialization::make_array(
-            target.data(), quats * pages * rows * spacing);
+        phylanx::util::detail::save_dense(
+            archive, target.data(), quats * pages * rows * spacing);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, bool TF>
+    void save(output_archive& archive,
+        blaze::CompressedVector<T, TF> const& target, unsigned)
+    {
+        // Serialize sparse vector
+        std::size_t count = target.size();
+        std::size_t nonzeros = target.nonZeros();
+        archive << count << nonzeros;
+
+        std::vector<std::size_t> indices;
+        std::vector<T> values;
+        indices.reserve(nonzeros);
+        values.reserve(nonzeros);
+        for (auto it = target.begin(); it != target.end(); ++it)
+        {
+            indices.push_back(it->index());
+            values.push_back(it->value());
+        }
+
+        phylanx::util::detail::save_dense_copy(
+            archive, indices.data(), nonzeros);
+        phylanx::util::detail::save_dense_copy(
+            archive, values.data(), nonzeros);
+    }
+
+    template <typename T, bool SO>
+    void save(output_archive& archive,
+        blaze::CompressedMatrix<T, SO> const& target, unsigned)
+    {
+        // Serialize sparse matrix
+        std::size_t rows = target.rows();
+        std::size_t columns = target.columns();
+        std::size_t nonzeros = target.nonZeros();
+        archive << rows << columns << nonzeros;
+
+        std::size_t major = SO ? columns : rows;
+        std::vector<std::size_t> counts(major);
+        std::vector<std::size_t> indices;
+        std::vector<T> values;
+        indices.reserve(nonzeros);
+        values.reserve(nonzeros);
+        for (std::size_t i = 0; i != major; ++i)
+        {
+            counts[i] = target.nonZeros(i);
+            for (auto it = target.begin(i); it != target.end(i); ++it)
+            {
+                indices.push_back(it->index());
+                values.push_back(it->value());
+            }
+        }
+
+        phylanx::util::detail::save_dense_copy(archive, counts.data(), major);
+        phylanx::util::detail::save_dense_copy(
+            archive, indices.data(), nonzeros);
+        phylanx::util::detail::save_dense_copy(
+            archive, values.data(), nonzeros);
     }
 
     ///////////////////////////////////////////////////////////////////////////
     HPX_SERIALIZATION_SPLIT_FREE_TEMPLATE(
         (template <typename T, bool TF>), (blaze::DynamicVector<T, TF>));
 
+    HPX_SERIALIZATION_SPLIT_FREE_TEMPLATE(
+        (template <typename T, bool TF>), (blaze::CompressedVector<T, TF>));
+
+    HPX_SERIALIZATION_SPLIT_FREE_TEMPLATE(
+        (template <typename T, bool SO>), (blaze::CompressedMatrix<T, SO>));
+
     HPX_SERIALIZATION_SPLIT_FREE_TEMPLATE(
         (template <typename T, bool SO>), (blaze::DynamicMatrix<T, SO>));
 
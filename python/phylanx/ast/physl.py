@@ -608,6 +608,18 @@ class PhySL:
 
         return result
 
+    def call_batch(self, arg_sets):
+        """Invoke this Phylanx function once for each of the given argument
+           sets (a tuple of positional arguments, or a single argument), the
+           invocations are run in parallel. Returns the list of results."""
+
+        self._ensure_global_state()
+        self._ensure_is_compiled()
+
+        return phylanx.execution_tree.eval_batch(
+            PhySL.compiler_state, self.file_name,
+            self.wrapped_function.__name__, arg_sets)
+
     def tree(self):
         """Return the tree data for this object"""
 
@@ -194,6 +194,24 @@ def Phylanx(__phylanx_arg=None, **kwargs):
 
             return result
 
+        def batch(self, arg_sets):
+            """Invoke this decorator for each of the given argument sets, a
+               list (or a stacked array) of the arguments of the individual
+               invocations. Returns the list of results."""
+
+            # just invoke original function if decorator should be disabled
+            if self.disable_decorator:
+                return [self.decorated_function(*args)
+                        if isinstance(args, (tuple, list))
+                        else self.decorated_function(args)
+                        for args in arg_sets]
+
+            if self.backend == 'OpenSCoP':
+                raise NotImplementedError(
+                    "OpenSCoP kernels are not yet callable.")
+
+            return self.backend.call_batch(arg_sets)
+
         def generate_ast(self):
             return generate_phylanx_ast(self.__src__)
 
@@ -7,6 +7,7 @@
 
 #include <phylanx/phylanx.hpp>
 
+#include <hpx/include/parallel_for_loop.hpp>
 #include <hpx/iostream.hpp>
 
 #include <bindings/binding_helpers.hpp>
@@ -173,6 +174,90 @@ namespace phylanx { namespace bindings
             });
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    pybind11::list expression_batch_evaluator(compiler_state& state,
+        std::string const& file_name, std::string const& xexpr_str,
+        pybind11::iterable batch)
+    {
+        using phylanx::execution_tree::primitive_argument_type;
+        using phylanx::execution_tree::primitive_arguments_type;
+
+        // convert all argument sets while holding the GIL, a tuple or list
+        // represents the positional arguments of one evaluation, everything
+        // else (e.g. the rows of a stacked array) is a single argument
+        std::vector<primitive_arguments_type> batch_args;
+        for (auto const& item : batch)
+        {
+            primitive_arguments_type fargs;
+            if (pybind11::isinstance<pybind11::tuple>(item) ||
+                pybind11::isinstance<pybind11::list>(item))
+            {
+                auto seq = pybind11::reinterpret_borrow<pybind11::sequence>(
+                    item);
+                fargs.reserve(seq.size());
+                for (auto const& arg : seq)
+                {
+                    fargs.emplace_back(arg.cast<primitive_argument_type>());
+                }
+            }
+            else
+            {
+                fargs.emplace_back(item.cast<primitive_argument_type>());
+            }
+            batch_args.push_back(std::move(fargs));
+        }
+
+        std::vector<primitive_argument_type> results(batch_args.size());
+
+        {
+            pybind11::gil_scoped_release release;       // release GIL
+
+            hpx::threads::run_as_hpx_thread(
+                [&]()
+                {
+                    // Make sure None is printed as "None"
+                    phylanx::util::none_wrapper wrap_cout(hpx::cout);
+                    phylanx::util::none_wrapper wrap_debug(hpx::consolestream);
+
+                    auto const& code_x =
+                        phylanx::execution_tree::compile(file_name, xexpr_str,
+                            xexpr_str, state.eval_snippets, state.eval_env);
+
+                    if (state.enable_measurements)
+                    {
+                        auto const& funcs = code_x.functions();
+                        if (!funcs.empty())
+                        {
+                            state.primitive_instances.push_back(
+                                phylanx::util::enable_measurements(
+                                    funcs.front().name_));
+                        }
+                    }
+
+                    auto x = code_x.run(state.eval_ctx);
+
+                    // the evaluations are independent of each other
+                    hpx::for_loop(hpx::execution::par, std::size_t(0),
+                        batch_args.size(),
+                        [&](std::size_t i)
+                        {
+                            results[i] =
+                                x(std::move(batch_args[i]), state.eval_ctx);
+                        });
+                });
+        }
+
+        pybind11::list result;
+        for (auto& value : results)
+        {
+            result.append(pybind11::reinterpret_steal<pybind11::object>(
+                pybind11::detail::make_caster<primitive_argument_type>::cast(
+                    std::move(value), pybind11::return_value_policy::move,
+                    pybind11::handle())));
+        }
+        return result;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     phylanx::execution_tree::primitive code_for(
         phylanx::bindings::compiler_state& state, std::string const& file_name,
@@ -660,6 +745,12 @@ namespace phylanx { namespace bindings
                 case primitive_argument_type::dictionary_index:
                     return pybind11::dtype("O");
 
+                case primitive_argument_type::float32_index:
+                    return pybind11::dtype("float32");
+
+                case primitive_argument_type::int32_index:
+                    return pybind11::dtype("int32");
+
                 default:
                     break;
                 }
@@ -218,6 +218,12 @@ namespace phylanx { namespace bindings
         std::string const& xexpr_str, pybind11::args args,
         pybind11::kwargs kwargs);
 
+    // evaluate compiled expression for each of the given argument sets, the
+    // evaluations are run in parallel using a single HPX entry
+    pybind11::list expression_batch_evaluator(
+        compiler_state& state, std::string const& file_name,
+        std::string const& xexpr_str, pybind11::iterable batch);
+
     // extract pre-compiled code for given function name
     phylanx::execution_tree::primitive code_for(
         phylanx::bindings::compiler_state& state,
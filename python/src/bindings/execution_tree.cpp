@@ -54,6 +54,22 @@ void phylanx::bindings::bind_execution_tree(pybind11::module m)
         },
         "compile and evaluate a numerical expression in PhySL");
 
+    execution_tree.def("eval_batch",
+        phylanx::bindings::expression_batch_evaluator,
+        "compile a PhySL expression and evaluate it for each of the given "
+        "argument sets in parallel, returns the list of results");
+
+    execution_tree.def(
+        "eval_batch",
+        [](phylanx::bindings::compiler_state& state, std::string const& xexpr,
+            pybind11::iterable batch) -> pybind11::list
+        {
+            return phylanx::bindings::expression_batch_evaluator(
+                state, state.codename_, xexpr, batch);
+        },
+        "compile a PhySL expression and evaluate it for each of the given "
+        "argument sets in parallel, returns the list of results");
+
     // expose functionalities needed for accessing performance data
     execution_tree.def("enable_measurements",
         phylanx::bindings::enable_measurements,
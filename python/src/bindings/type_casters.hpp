@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -380,6 +381,24 @@ namespace pybind11 { namespace detail
         return blaze_ref_array(*src, base);
     }
 
+    // Reinterprets the elements of the given numpy array as elements of type
+    // Target. This is used to expose the std::uint8_t storage of boolean
+    // arrays as numpy arrays of dtype bool without converting the data.
+    template <typename Target, typename T>
+    handle blaze_array_view(handle a)
+    {
+        static_assert(sizeof(Target) == sizeof(T),
+            "the element types must have the same size");
+
+        if (std::is_same<Target, T>::value)
+        {
+            return a;
+        }
+
+        object arr = reinterpret_steal<object>(a);
+        return arr.attr("view")(pybind11::dtype::of<Target>()).release();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     struct casted_type
@@ -430,6 +449,8 @@ namespace pybind11 { namespace detail
         }
     };
 
+    // single precision and 32 bit integer arrays are loaded as such, they
+    // are not widened to double precision or 64 bit integers
     template <typename T>
     struct is_array_instance
     {
@@ -439,23 +460,12 @@ namespace pybind11 { namespace detail
         }
     };
 
-    template <>
-    struct is_array_instance<double>
-    {
-        static bool call(handle src)
-        {
-            return isinstance<array_t<double>>(src) ||
-                   isinstance<array_t<float>>(src);
-        }
-    };
-
     template <>
     struct is_array_instance<std::int64_t>
     {
         static bool call(handle src)
         {
             return isinstance<array_t<std::int64_t>>(src) ||
-                   isinstance<array_t<std::int32_t>>(src) ||
                    isinstance<array_t<std::int16_t>>(src) ||
                    isinstance<array_t<std::uint64_t>>(src) ||
                    isinstance<array_t<std::uint32_t>>(src) ||
@@ -510,6 +520,60 @@ namespace pybind11 { namespace detail
             return false;
         }
 
+        // scipy.sparse matrices are converted from their (canonical) CSR
+        // representation into a blaze::CompressedMatrix
+        bool load_sparse(handle src, bool convert)
+        {
+            if (!hasattr(src, "tocsr") || !hasattr(src, "nnz"))
+            {
+                return false;
+            }
+
+            object csr = src.attr("tocsr")();
+            if (!csr.attr("has_canonical_format").template cast<bool>())
+            {
+                // sorted indices without duplicates are required below
+                csr = csr.attr("copy")();
+                csr.attr("sum_duplicates")();
+            }
+
+            auto shape = csr.attr("shape").template cast<tuple>();
+            auto rows = shape[0].template cast<std::size_t>();
+            auto columns = shape[1].template cast<std::size_t>();
+
+            using index_array =
+                array_t<std::int64_t, array::c_style | array::forcecast>;
+            using data_array =
+                array_t<result_type, array::c_style | array::forcecast>;
+
+            auto indptr = index_array::ensure(csr.attr("indptr"));
+            auto indices = index_array::ensure(csr.attr("indices"));
+            auto data = data_array::ensure(csr.attr("data"));
+            if (!indptr || !indices || !data)
+            {
+                PyErr_Clear();
+                return false;
+            }
+
+            auto const* p = indptr.data();
+            auto const* idx = indices.data();
+            auto const* d = data.data();
+
+            blaze::CompressedMatrix<T> m(rows, columns);
+            m.reserve(data.size());
+            for (std::size_t i = 0; i != rows; ++i)
+            {
+                for (std::int64_t k = p[i]; k != p[i + 1]; ++k)
+                {
+                    m.append(i, idx[k], T(d[k]));
+                }
+                m.finalize(i);
+            }
+
+            value = std::move(m);
+            return true;
+        }
+
         bool load1d(handle src, bool convert)
         {
             if (!convert && !is_array_instance<result_type>::call(src))
@@ -687,103 +751,55 @@ namespace pybind11 { namespace detail
             return true;
         }
 
-        template <typename Type>
-        static handle cast_impl_automatic(Type* src)
-        {
-            using T_ = typename casted_type<T>::type;
-
-            switch (src->index())
-            {
-            // blaze::DynamicVector<T>
-            case phylanx::ir::node_data<T>::storage1d:
-                return blaze_encapsulate(&(src->vector_non_ref()));
-
-            // blaze::DynamicMatrix<T>
-            case phylanx::ir::node_data<T>::storage2d:
-                return blaze_encapsulate(&(src->matrix_non_ref()));
-
-            // blaze::DynamicTensor<T>
-            case phylanx::ir::node_data<T>::storage3d:
-                return blaze_encapsulate(&(src->tensor_non_ref()));
-
-            // blaze::DynamicArray<4, T>
-            case phylanx::ir::node_data<T>::storage4d:
-                return blaze_encapsulate(&(src->quatern_non_ref()));
-
-            // custom types require a copy (done by vector_copy/matrix_copy)
-            // blaze::CustomVector<T>
-            case phylanx::ir::node_data<T>::custom_storage1d:
-                return blaze_encapsulate(new blaze::DynamicVector<T_>(
-                    src->vector_copy()));
-
-            // blaze::CustomMatrix<T>
-            case phylanx::ir::node_data<T>::custom_storage2d:
-                return blaze_encapsulate(new blaze::DynamicMatrix<T_>(
-                    src->matrix_copy()));
-
-            // blaze::CustomTensor<T>
-            case phylanx::ir::node_data<T>::custom_storage3d:
-                return blaze_encapsulate(new blaze::DynamicTensor<T_>(
-                    src->tensor_copy()));
-
-            // blaze::CustomArray<4, T>
-            case phylanx::ir::node_data<T>::custom_storage4d:
-                return blaze_encapsulate(new blaze::DynamicArray<4, T_>(
-                    src->quatern_copy()));
-
-            default:
-                throw cast_error("cast_impl_automatic: "
-                    "unexpected node_data type: should not happen!");
-            }
-            return handle();
-        }
-
+        // The dense storage is moved into a heap allocated object that is
+        // owned by a capsule, the numpy array references the Blaze buffer
+        // directly (using the padded spacing of the storage as its strides).
+        // This is used for values returned from Python-bound functions and
+        // for pointers handed over to Python (take_ownership).
         template <typename Type>
         static handle cast_impl_move(Type* src)
         {
-            using T_ = typename casted_type<T>::type;
-
             switch (src->index())
             {
             // blaze::DynamicVector<T>
             case phylanx::ir::node_data<T>::storage1d:
-                return blaze_encapsulate(new blaze::DynamicVector<T_>(
+                return blaze_encapsulate(new blaze::DynamicVector<T>(
                     std::move(src->vector_non_ref())));
 
             // blaze::DynamicMatrix<T>
             case phylanx::ir::node_data<T>::storage2d:
-                return blaze_encapsulate(new blaze::DynamicMatrix<T_>(
+                return blaze_encapsulate(new blaze::DynamicMatrix<T>(
                     std::move(src->matrix_non_ref())));
 
             // blaze::DynamicTensor<T>
             case phylanx::ir::node_data<T>::storage3d:
-                return blaze_encapsulate(new blaze::DynamicTensor<T_>(
+                return blaze_encapsulate(new blaze::DynamicTensor<T>(
                     std::move(src->tensor_non_ref())));
 
             // blaze::DynamicArray<4, T>
             case phylanx::ir::node_data<T>::storage4d:
-                return blaze_encapsulate(new blaze::DynamicArray<4, T_>(
+                return blaze_encapsulate(new blaze::DynamicArray<4, T>(
                     std::move(src->quatern_non_ref())));
 
             // custom types require a copy (done by vector_copy/matrix_copy)
             // blaze::CustomVector<T>
             case phylanx::ir::node_data<T>::custom_storage1d:
-                return blaze_encapsulate(new blaze::DynamicVector<T_>(
+                return blaze_encapsulate(new blaze::DynamicVector<T>(
                     src->vector_copy()));
 
             // blaze::CustomMatrix<T>
             case phylanx::ir::node_data<T>::custom_storage2d:
-                return blaze_encapsulate(new blaze::DynamicMatrix<T_>(
+                return blaze_encapsulate(new blaze::DynamicMatrix<T>(
                     src->matrix_copy()));
 
             // blaze::CustomTensor<T>
             case phylanx::ir::node_data<T>::custom_storage3d:
-                return blaze_encapsulate(new blaze::DynamicTensor<T_>(
+                return blaze_encapsulate(new blaze::DynamicTensor<T>(
                     src->tensor_copy()));
 
             // blaze::CustomArray<4, T>
             case phylanx::ir::node_data<T>::custom_storage4d:
-                return blaze_encapsulate(new blaze::DynamicArray<4, T_>(
+                return blaze_encapsulate(new blaze::DynamicArray<4, T>(
                     src->quatern_copy()));
 
             default:
@@ -796,8 +812,6 @@ namespace pybind11 { namespace detail
         template <typename Type>
         static handle cast_impl_copy(Type* src)
         {
-            using T_ = typename casted_type<T>::type;
-
             switch (src->index())
             {
             // blaze::DynamicVector<T>
@@ -818,22 +832,22 @@ namespace pybind11 { namespace detail
 
             // blaze::CustomVector<T>
             case phylanx::ir::node_data<T>::custom_storage1d:
-                return blaze_encapsulate(new blaze::DynamicVector<T_>(
+                return blaze_encapsulate(new blaze::DynamicVector<T>(
                     src->vector_copy()));
 
             // blaze::CustomMatrix<T>
             case phylanx::ir::node_data<T>::custom_storage2d:
-                return blaze_encapsulate(new blaze::DynamicMatrix<T_>(
+                return blaze_encapsulate(new blaze::DynamicMatrix<T>(
                     src->matrix_copy()));
 
             // blaze::CustomTensor<T>
             case phylanx::ir::node_data<T>::custom_storage3d:
-                return blaze_encapsulate(new blaze::DynamicTensor<T_>(
+                return blaze_encapsulate(new blaze::DynamicTensor<T>(
                     src->tensor_copy()));
 
             // blaze::CustomArray<4, T>
             case phylanx::ir::node_data<T>::custom_storage4d:
-                return blaze_encapsulate(new blaze::DynamicArray<4, T_>(
+                return blaze_encapsulate(new blaze::DynamicArray<4, T>(
                     src->quatern_copy()));
 
             default:
@@ -846,8 +860,6 @@ namespace pybind11 { namespace detail
         template <typename Type>
         static handle cast_impl_automatic_reference(Type* src)
         {
-            using T_ = typename casted_type<T>::type;
-
             switch (src->index())
             {
             // blaze::DynamicVector<T>
@@ -869,22 +881,22 @@ namespace pybind11 { namespace detail
             // custom types require a copy (done by vector_copy/matrix_copy)
             // blaze::CustomVector<T>
             case phylanx::ir::node_data<T>::custom_storage1d:
-                return blaze_encapsulate(new blaze::DynamicVector<T_>(
+                return blaze_encapsulate(new blaze::DynamicVector<T>(
                     src->vector_copy()));
 
             // blaze::CustomMatrix<T>
             case phylanx::ir::node_data<T>::custom_storage2d:
-                return blaze_encapsulate(new blaze::DynamicMatrix<T_>(
+                return blaze_encapsulate(new blaze::DynamicMatrix<T>(
                     src->matrix_copy()));
 
             // blaze::CustomTensor<T>
             case phylanx::ir::node_data<T>::custom_storage3d:
-                return blaze_encapsulate(new blaze::DynamicTensor<T_>(
+                return blaze_encapsulate(new blaze::DynamicTensor<T>(
                     src->tensor_copy()));
 
             // blaze::CustomArray<T4, >
             case phylanx::ir::node_data<T>::custom_storage4d:
-                return blaze_encapsulate(new blaze::DynamicArray<4, T_>(
+                return blaze_encapsulate(new blaze::DynamicArray<4, T>(
                     src->quatern_copy()));
 
             default:
@@ -928,11 +940,67 @@ namespace pybind11 { namespace detail
             return handle();
         }
 
+        // sparse matrices are returned as scipy.sparse.csr_matrix, there are
+        // no 1-dimensional sparse arrays in scipy, so vectors are expanded
+        template <typename Type>
+        static handle cast_sparse(Type* src)
+        {
+            using T_ = typename casted_type<T>::type;
+
+            if (src->index() == phylanx::ir::node_data<T>::sparse_storage1d)
+            {
+                return blaze_array_view<T_, T>(blaze_encapsulate(
+                    new blaze::DynamicVector<T>(src->sparse_vector())));
+            }
+
+            auto const& m = src->sparse_matrix();
+            std::size_t nonzeros = m.nonZeros();
+
+            array_t<T_> data(nonzeros);
+            array_t<std::int64_t> indices(nonzeros);
+            array_t<std::int64_t> indptr(m.rows() + 1);
+
+            auto* d = data.mutable_data();
+            auto* idx = indices.mutable_data();
+            auto* p = indptr.mutable_data();
+
+            std::int64_t pos = 0;
+            for (std::size_t i = 0; i != m.rows(); ++i)
+            {
+                p[i] = pos;
+                for (auto it = m.begin(i); it != m.end(i); ++it, ++pos)
+                {
+                    d[pos] = T_(it->value());
+                    idx[pos] = std::int64_t(it->index());
+                }
+            }
+            p[m.rows()] = pos;
+
+            object csr_matrix =
+                module::import("scipy.sparse").attr("csr_matrix");
+            return csr_matrix(make_tuple(data, indices, indptr),
+                make_tuple(m.rows(), m.columns()))
+                .release();
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Type>
         static handle cast_impl(
             Type* src, return_value_policy policy, handle parent)
         {
+            // the pointed to object is handed over to us, we move its data
+            // out and release it afterwards
+            std::unique_ptr<Type> owned;
+            if (policy == return_value_policy::take_ownership)
+            {
+                owned.reset(src);
+            }
+
+            if (src->is_sparse())
+            {
+                return cast_sparse(src);
+            }
+
             if (0 == src->index())      // T
             {
                 // convert scalars to the corresponding numpy scalar type
@@ -943,24 +1011,30 @@ namespace pybind11 { namespace detail
                 return result.release();
             }
 
+            // the arrays are created using the element type of the storage,
+            // boolean arrays are reinterpreted afterwards
+            using T_ = typename casted_type<T>::type;
+
             switch (policy)
             {
             case return_value_policy::take_ownership:   HPX_FALLTHROUGH;
-            case return_value_policy::automatic:
-                return cast_impl_automatic(src);
-
             case return_value_policy::move:
-                return cast_impl_move(src);
+                return blaze_array_view<T_, T>(cast_impl_move(src));
 
+            // a pointer returned with the default policy still refers to
+            // the caller's data, which must not be moved from
+            case return_value_policy::automatic:        HPX_FALLTHROUGH;
             case return_value_policy::copy:
-                return cast_impl_copy(src);
+                return blaze_array_view<T_, T>(cast_impl_copy(src));
 
             case return_value_policy::reference:        HPX_FALLTHROUGH;
             case return_value_policy::automatic_reference:
-                return cast_impl_automatic_reference(src);
+                return blaze_array_view<T_, T>(
+                    cast_impl_automatic_reference(src));
 
             case return_value_policy::reference_internal:
-                return cast_impl_reference_internal(src, parent);
+                return blaze_array_view<T_, T>(
+                    cast_impl_reference_internal(src, parent));
 
             default:
                 throw cast_error(
@@ -972,7 +1046,8 @@ namespace pybind11 { namespace detail
     public:
         bool load(handle src, bool convert)
         {
-            return load0d(src, convert)
+            return load_sparse(src, convert)
+                || load0d(src, convert)
                 || load1d(src, convert)
                 || load2d(src, convert)
                 || load3d(src, convert)
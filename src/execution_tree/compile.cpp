@@ -14,11 +14,19 @@
 
 #include <hpx/modules/format.hpp>
 #include <hpx/include/naming.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 
 #include <algorithm>
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -129,6 +137,298 @@ namespace phylanx { namespace execution_tree
         {
             return hpx::util::format("function_{}", ++function_counter);
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Compiling the same PhySL source over and over again (as done by the
+        // Python bindings, for instance) is expensive as it requires to parse
+        // the code and to create a new primitive for each of the nodes of the
+        // expression tree. The compile_cache holds on to the entry points
+        // generated for a given source, which are handed out again whenever
+        // the same source is compiled for the same target and into the same
+        // function_list. The generated primitives hold state (variables, for
+        // instance), thus they are never shared between function lists. The
+        // entries of a function_list are removed when it is destroyed, which
+        // releases the primitives (and their registered names).
+        struct compile_cache_key
+        {
+            std::size_t hash_;              // hash of source_
+            std::string source_;            // the compiled source code
+            std::string name_;              // name of the compiled code
+            std::string func_name_;         // empty if generated
+            std::uint32_t locality_;        // target locality
+
+            // The compiled code may only be reused for the same function_list
+            // and, if a caller supplied environment was used, for the same
+            // environment (env_ is nullptr otherwise).
+            void const* env_;
+            void const* snippets_;
+
+            friend bool operator==(
+                compile_cache_key const& lhs, compile_cache_key const& rhs)
+            {
+                return lhs.hash_ == rhs.hash_ &&
+                    lhs.locality_ == rhs.locality_ && lhs.env_ == rhs.env_ &&
+                    lhs.snippets_ == rhs.snippets_ &&
+                    lhs.name_ == rhs.name_ &&
+                    lhs.func_name_ == rhs.func_name_ &&
+                    lhs.source_ == rhs.source_;
+            }
+        };
+
+        struct compile_cache_key_hash
+        {
+            std::size_t operator()(compile_cache_key const& key) const
+            {
+                return key.hash_;
+            }
+        };
+
+        class compile_cache
+        {
+        private:
+            struct entry_data
+            {
+                compiler::entry_point ep_;
+                std::size_t env_generation_;
+            };
+
+            using entry_list =
+                std::list<std::pair<compile_cache_key, entry_data>>;
+            using index_type = std::unordered_map<compile_cache_key,
+                entry_list::iterator, compile_cache_key_hash>;
+
+        public:
+            // the maximal number of entries can be changed using the
+            // configuration setting 'phylanx.compile_cache_size', the value
+            // zero disables caching
+            compile_cache()
+              : max_entries_(std::stoul(hpx::get_config_entry(
+                    "phylanx.compile_cache_size", "1024")))
+            {
+            }
+
+            bool enabled() const
+            {
+                return max_entries_ != 0;
+            }
+
+            // is_valid(ep, env_generation) is used to verify whether a found
+            // entry can still be used, invalid entries are removed
+            template <typename F>
+            bool find(compile_cache_key const& key, compiler::entry_point& ep,
+                F&& is_valid)
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+
+                auto it = index_.find(key);
+                if (it == index_.end())
+                {
+                    ++misses_;
+                    return false;
+                }
+
+                entry_data const& data = it->second->second;
+                if (!is_valid(data.ep_, data.env_generation_))
+                {
+                    entries_.erase(it->second);
+                    index_.erase(it);
+                    ++misses_;
+                    return false;
+                }
+
+                // move the entry to the front of the LRU list
+                entries_.splice(entries_.begin(), entries_, it->second);
+
+                ep = it->second->second.ep_;
+                ++hits_;
+                return true;
+            }
+
+            void insert(compile_cache_key&& key, compiler::entry_point ep,
+                std::size_t env_generation)
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+
+                auto it = index_.find(key);
+                if (it != index_.end())
+                {
+                    // somebody else was faster
+                    return;
+                }
+
+                entries_.emplace_front(std::move(key),
+                    entry_data{std::move(ep), env_generation});
+                index_.emplace(entries_.front().first, entries_.begin());
+
+                // evict least recently used entries
+                while (entries_.size() > max_entries_)
+                {
+                    index_.erase(entries_.back().first);
+                    entries_.pop_back();
+                }
+            }
+
+            void clear()
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+                index_.clear();
+                entries_.clear();
+            }
+
+            // remove all entries referring to the given function_list
+            void evict(compiler::function_list const* snippets)
+            {
+                entry_list evicted;
+
+                {
+                    std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+                    for (auto it = entries_.begin(); it != entries_.end();)
+                    {
+                        auto curr = it++;
+                        if (curr->first.snippets_ == snippets)
+                        {
+                            index_.erase(curr->first);
+                            evicted.splice(evicted.end(), entries_, curr);
+                        }
+                    }
+                }
+
+                // the primitives are released outside of the lock
+            }
+
+            std::int64_t hits(bool reset)
+            {
+                return hpx::util::get_and_reset_value(hits_, reset);
+            }
+
+            std::int64_t misses(bool reset)
+            {
+                return hpx::util::get_and_reset_value(misses_, reset);
+            }
+
+        private:
+            std::size_t const max_entries_;
+
+            hpx::lcos::local::spinlock mtx_;
+            entry_list entries_;
+            index_type index_;
+
+            std::atomic<std::int64_t> hits_{0};
+            std::atomic<std::int64_t> misses_{0};
+        };
+
+        compile_cache& get_compile_cache()
+        {
+            static compile_cache cache;
+            return cache;
+        }
+
+        compile_cache_key make_compile_cache_key(std::string const& name,
+            std::string const& func_name, std::string const& expr,
+            compiler::function_list const* snippets,
+            compiler::environment const* env,
+            hpx::id_type const& default_locality)
+        {
+            return compile_cache_key{std::hash<std::string>{}(expr), expr,
+                name, func_name,
+                hpx::naming::get_locality_id_from_id(default_locality), env,
+                snippets};
+        }
+
+        // Compile the given source or return the entry point that was
+        // generated earlier for the same source. An empty func_name causes
+        // a unique function name to be generated. If env is nullptr, a
+        // default environment is used.
+        compiler::entry_point const& compile_cached(std::string const& name,
+            std::string const& func_name, std::string const& expr,
+            compiler::function_list& snippets, compiler::environment* env,
+            hpx::id_type const& default_locality)
+        {
+            compile_cache& cache = get_compile_cache();
+            if (!cache.enabled())
+            {
+                std::string fname = func_name.empty() ?
+                    generate_unique_function_name() :
+                    func_name;
+                if (env != nullptr)
+                {
+                    return execution_tree::compile(name, fname,
+                        ast::generate_ast(expr), snippets, *env,
+                        default_locality);
+                }
+                return execution_tree::compile(name, fname,
+                    ast::generate_ast(expr), snippets, default_locality);
+            }
+
+            compile_cache_key key = make_compile_cache_key(
+                name, func_name, expr, &snippets, env, default_locality);
+
+            // The code has to be known to the given function_list, otherwise
+            // the function_list (and the environment) was recreated at the
+            // same address. Code compiled using a caller supplied environment
+            // can be reused only if no names were (re-)defined in the
+            // environment since.
+            auto const& entry_points = snippets.program_.entry_points();
+            auto is_valid = [&](compiler::entry_point const& ep,
+                                std::size_t env_generation) {
+                return entry_points.find(ep) != entry_points.end() &&
+                    (env == nullptr || env->generation() == env_generation);
+            };
+
+            compiler::entry_point ep;
+            if (cache.find(key, ep, is_valid))
+            {
+                // the cached code is already owned by the given function_list,
+                // make it the most recently added entry point
+                auto const& result =
+                    snippets.program_.add_entry_point(std::move(ep));
+
+                // re-enable all performance counters, if needed
+                if (util::need_performance_counters())
+                {
+                    phylanx::util::enable_measurements();
+                }
+
+                return result;
+            }
+
+            std::string fname = func_name.empty() ?
+                generate_unique_function_name() :
+                func_name;
+
+            compiler::entry_point const& result = (env != nullptr) ?
+                execution_tree::compile(name, fname, ast::generate_ast(expr),
+                    snippets, *env, default_locality) :
+                execution_tree::compile(name, fname, ast::generate_ast(expr),
+                    snippets, default_locality);
+
+            cache.insert(std::move(key), result,
+                env != nullptr ? env->generation() : 0);
+            return result;
+        }
+    }
+
+    namespace compiler
+    {
+        function_list::~function_list()
+        {
+            execution_tree::detail::get_compile_cache().evict(this);
+        }
+    }
+
+    std::int64_t compile_cache_hits(bool reset)
+    {
+        return detail::get_compile_cache().hits(reset);
+    }
+
+    std::int64_t compile_cache_misses(bool reset)
+    {
+        return detail::get_compile_cache().misses(reset);
+    }
+
+    void clear_compile_cache()
+    {
+        detail::get_compile_cache().clear();
     }
 
     compiler::entry_point const& compile(std::string const& name,
@@ -144,8 +444,8 @@ namespace phylanx { namespace execution_tree
         std::string const& expr, compiler::function_list& snippets,
         compiler::environment& env, hpx::id_type const& default_locality)
     {
-        return compile(name, detail::generate_unique_function_name(),
-            ast::generate_ast(expr), snippets, env, default_locality);
+        return detail::compile_cached(
+            name, "", expr, snippets, &env, default_locality);
     }
 
     compiler::entry_point const& compile(std::string const& name,
@@ -153,8 +453,8 @@ namespace phylanx { namespace execution_tree
         compiler::function_list& snippets, compiler::environment& env,
         hpx::id_type const& default_locality)
     {
-        return compile(name, func_name, ast::generate_ast(expr), snippets, env,
-            default_locality);
+        return detail::compile_cached(
+            name, func_name, expr, snippets, &env, default_locality);
     }
 
     compiler::entry_point const& compile(std::string const& name,
@@ -190,8 +490,8 @@ namespace phylanx { namespace execution_tree
         std::string const& expr, compiler::function_list& snippets,
         hpx::id_type const& default_locality)
     {
-        return compile(name, detail::generate_unique_function_name(),
-            ast::generate_ast(expr), snippets, default_locality);
+        return detail::compile_cached(
+            name, "", expr, snippets, nullptr, default_locality);
     }
 
     compiler::entry_point const& compile(std::string const& name,
@@ -206,8 +506,8 @@ namespace phylanx { namespace execution_tree
         std::string const& func_name, std::string const& expr,
         compiler::function_list& snippets, hpx::id_type const& default_locality)
     {
-        return compile(name, func_name, ast::generate_ast(expr), snippets,
-            default_locality);
+        return detail::compile_cached(
+            name, func_name, expr, snippets, nullptr, default_locality);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -224,8 +524,8 @@ namespace phylanx { namespace execution_tree
         compiler::function_list& snippets, compiler::environment& env,
         hpx::id_type const& default_locality)
     {
-        return compile("<unknown>", detail::generate_unique_function_name(),
-            ast::generate_ast(expr), snippets, env, default_locality);
+        return detail::compile_cached(
+            "<unknown>", "", expr, snippets, &env, default_locality);
     }
 
     compiler::entry_point const& compile(
@@ -239,8 +539,8 @@ namespace phylanx { namespace execution_tree
     compiler::entry_point const& compile(std::string const& expr,
         compiler::function_list& snippets, hpx::id_type const& default_locality)
     {
-        return compile("<unknown>", detail::generate_unique_function_name(),
-            ast::generate_ast(expr), snippets, default_locality);
+        return detail::compile_cached(
+            "<unknown>", "", expr, snippets, nullptr, default_locality);
     }
 
     ///////////////////////////////////////////////////////////////////////////
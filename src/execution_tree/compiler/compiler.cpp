@@ -27,6 +27,7 @@
 #include <hpx/include/naming.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/runtime.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
 
 #include <boost/fusion/include/std_pair.hpp>
 #include <boost/spirit/include/qi_attr.hpp>
@@ -188,36 +189,33 @@ namespace phylanx { namespace execution_tree { namespace compiler {
             ast::expression const& expr, std::vector<std::string>& args,
             std::vector<std::string>& defaults)
         {
-            // extract arguments, match primitive invocation
-            using placeholder_map_type =
-                std::multimap<std::string, ast::expression>;
-
-            std::string match = hpx::util::format("{}(__1_args)", name);
-            placeholder_map_type placeholders;
-            auto result = ast::match_ast(ast::generate_ast(match)[0], expr,
-                ast::detail::on_placeholder_match{placeholders});
-            if (!result)
+            // extract arguments, match primitive invocation (this is
+            // equivalent to matching against '<name>(__1_args)')
+            if (!ast::detail::is_function_call(expr) ||
+                ast::detail::function_name(expr) != name)
+            {
                 return true;    // could be operator
+            }
 
             bool has_ellipses = false;
             bool has_default_value = false;
 
-            auto its = placeholders.equal_range("_1_args");
-            for (auto it = its.first; it != its.second; ++it)
+            std::vector<ast::expression> const arguments =
+                ast::detail::function_arguments(expr);
+            for (auto const& arg : arguments)
             {
-                if (ast::detail::is_identifier(it->second))
+                if (ast::detail::is_identifier(arg))
                 {
                     // simple argument name
-                    if (ast::detail::is_placeholder_ellipses(it->second))
+                    if (ast::detail::is_placeholder_ellipses(arg))
                     {
-                        args.push_back(
-                            ast::detail::identifier_name(it->second));
+                        args.push_back(ast::detail::identifier_name(arg));
                         has_ellipses = true;    // must be last argument
                     }
                     else
                     {
                         auto names = split_argument(
-                            ast::detail::identifier_name(it->second));
+                            ast::detail::identifier_name(arg));
 
                         // kwargs cannot come after varargs
                         HPX_ASSERT(!has_ellipses);
@@ -233,17 +231,16 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                         }
                     }
                 }
-                else if (ast::detail::is_function_call(it->second))
+                else if (ast::detail::is_function_call(arg))
                 {
                     // argument with default value
-                    HPX_ASSERT(
-                        ast::detail::function_name(it->second) == "__arg");
+                    HPX_ASSERT(ast::detail::function_name(arg) == "__arg");
 
                     std::string argname;
                     std::string default_value;
 
                     if (!parse_argument_value(
-                            patterns, it->second, argname, default_value))
+                            patterns, arg, argname, default_value))
                     {
                         HPX_ASSERT(false);
                     }
@@ -265,6 +262,23 @@ namespace phylanx { namespace execution_tree { namespace compiler {
         }
 
         ///////////////////////////////////////////////////////////////////////
+        // the name of an argument as used in reconstructed patterns
+        std::string reconstruct_argument(
+            std::string const& arg, std::size_t count)
+        {
+            if (ast::detail::is_placeholder(arg))
+            {
+                return arg;
+            }
+
+            std::string result = '_' + std::to_string(count + 1);
+            if (!arg.empty())
+            {
+                result += '_' + arg;
+            }
+            return result;
+        }
+
         std::string reconstruct_pattern(std::string const& name,
             std::vector<std::string> const& args, std::size_t maxcount)
         {
@@ -283,46 +297,74 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                     pattern += ", ";
                 }
 
-                if (ast::detail::is_placeholder(arg))
-                {
-                    pattern += arg;
-                }
-                else
-                {
-                    pattern += '_' + std::to_string(count + 1);
-                    if (!arg.empty())
-                    {
-                        pattern += '_' + arg;
-                    }
-                }
+                pattern += reconstruct_argument(arg, count);
                 ++count;
             }
             pattern += ')';
             return pattern;
         }
 
+        // create the AST corresponding to reconstruct_pattern directly
+        ast::expression reconstruct_pattern_ast(std::string const& name,
+            std::vector<std::string> const& args, std::size_t maxcount)
+        {
+            std::vector<ast::expression> arguments;
+            arguments.reserve((std::min)(maxcount, args.size()));
+            for (std::size_t count = 0;
+                 count != args.size() && count != maxcount; ++count)
+            {
+                arguments.emplace_back(
+                    ast::identifier(reconstruct_argument(args[count], count)));
+            }
+            return ast::expression(
+                ast::function_call(ast::identifier(name), std::move(arguments)));
+        }
+
         ///////////////////////////////////////////////////////////////////////
+        // Every registered pattern is parsed only once. The ASTs for the
+        // dtype specific variants of a primitive and for the patterns with
+        // fewer default arguments are derived from the parsed AST instead of
+        // running their textual representation through the parser again.
         void insert_pattern(expression_pattern_list& result,
-            std::string pattern, match_pattern_type const& p,
-            std::string const& suffix)
+            std::string pattern, ast::expression const& pattern_ast,
+            match_pattern_type const& p, std::string const& suffix)
         {
-            if (!suffix.empty())
+            std::string const name = p.primitive_type_ + suffix;
+
+            ast::expression expr;
+            if (suffix.empty())
+            {
+                expr = pattern_ast;
+            }
+            else
             {
                 pattern = construct_extended_pattern(
                     std::move(pattern), p.primitive_type_, suffix);
-            }
 
-            auto exprs = ast::generate_ast(pattern);
-            HPX_ASSERT(exprs.size() == 1);
+                if (ast::detail::is_function_call(pattern_ast) &&
+                    ast::detail::function_name(pattern_ast) ==
+                        p.primitive_type_ &&
+                    ast::detail::function_attribute(pattern_ast).empty())
+                {
+                    expr = ast::expression(ast::function_call(
+                        ast::identifier(name),
+                        ast::detail::function_arguments(pattern_ast)));
+                }
+                else
+                {
+                    auto exprs = ast::generate_ast(pattern);
+                    HPX_ASSERT(exprs.size() == 1);
+                    expr = std::move(exprs[0]);
+                }
+            }
 
             std::vector<std::string> args;
             std::vector<std::string> defaults;
 
-            if (ast::detail::is_function_call(exprs[0]))
+            if (ast::detail::is_function_call(expr))
             {
                 // handle named arguments
-                if (!extract_arguments(p.primitive_type_ + suffix, result,
-                        exprs[0], args, defaults))
+                if (!extract_arguments(name, result, expr, args, defaults))
                 {
                     // something went wrong
                     HPX_ASSERT(false);
@@ -332,9 +374,8 @@ namespace phylanx { namespace execution_tree { namespace compiler {
             // reconstruct the pattern, if needed (leaving out default values)
             if (defaults.empty())
             {
-                result.insert(expression_pattern_list::value_type(
-                    p.primitive_type_ + suffix,
-                    expression_pattern{std::move(pattern), std::move(exprs[0]),
+                result.insert(expression_pattern_list::value_type(name,
+                    expression_pattern{std::move(pattern), std::move(expr),
                         p.create_primitive_, std::move(args),
                         std::move(defaults)}));
             }
@@ -344,24 +385,29 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                 // arguments)
                 for (std::size_t i = defaults.size() + 1; i != 0; --i)
                 {
-                    std::string resulting_pattern =
-                        reconstruct_pattern(p.primitive_type_ + suffix, args,
-                            args.size() - (i - 1));
-                    exprs = ast::generate_ast(resulting_pattern);
-
-                    result.insert(expression_pattern_list::value_type(
-                        p.primitive_type_ + suffix,
-                        expression_pattern{std::move(resulting_pattern),
-                            std::move(exprs[0]), p.create_primitive_, args,
-                            defaults}));
+                    std::size_t const count = args.size() - (i - 1);
+                    result.insert(expression_pattern_list::value_type(name,
+                        expression_pattern{
+                            reconstruct_pattern(name, args, count),
+                            reconstruct_pattern_ast(name, args, count),
+                            p.create_primitive_, args, defaults}));
                 }
             }
         }
 
+        void insert_pattern(expression_pattern_list& result,
+            std::string pattern, match_pattern_type const& p,
+            std::string const& suffix)
+        {
+            auto exprs = ast::generate_ast(pattern);
+            HPX_ASSERT(exprs.size() == 1);
+
+            insert_pattern(result, std::move(pattern), exprs[0], p, suffix);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         expression_pattern_list generate_patterns()
         {
-            std::string empty_suffix;
             expression_pattern_list result;
 
             // add internal arg(_1, _2) needed for default arguments
@@ -369,20 +415,23 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                 std::vector<std::string>{"__arg(_1, _2)"}, nullptr, nullptr,
                 "Internal");
 
-            insert_pattern(result, match.patterns_[0], match, empty_suffix);
+            insert_pattern(result, match.patterns_[0], match, "");
 
             for (auto const& patterns : get_all_known_patterns())
             {
                 auto const& p = patterns.data_;
                 for (auto const& pattern : p.patterns_)
                 {
-                    insert_pattern(result, pattern, p, empty_suffix);
+                    auto exprs = ast::generate_ast(pattern);
+                    HPX_ASSERT(exprs.size() == 1);
+
+                    insert_pattern(result, pattern, exprs[0], p, "");
 
                     if (p.supports_dtype_)
                     {
-                        insert_pattern(result, pattern, p, "__bool");
-                        insert_pattern(result, pattern, p, "__int");
-                        insert_pattern(result, pattern, p, "__float");
+                        insert_pattern(result, pattern, exprs[0], p, "__bool");
+                        insert_pattern(result, pattern, exprs[0], p, "__int");
+                        insert_pattern(result, pattern, exprs[0], p, "__float");
                     }
                 }
             }
@@ -871,6 +920,13 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                     access_target(f, "access-variable", default_locality_),
                     name_, id.id, id.col, define_globally);
 
+                // remember whether the variable will hold an array
+                environment::definition_data* data = env_.find_data(name);
+                if (data != nullptr && &data->f_ == cf)
+                {
+                    data->is_array_ = is_known_array(body);
+                }
+
                 // Correct type of the access object if this variable refers
                 // to a lambda or a block.
                 auto body_f = compile_body(body, locality);
@@ -1573,6 +1629,784 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                     name_, id));
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Trees of element-wise arithmetic, comparison, and logical
+        // operations (like 'a * b + c - d') are compiled into a single
+        // __fused_elementwise primitive instead of creating one primitive
+        // (and one temporary result) for each of the operations.
+        struct fusion_data
+        {
+            std::string program_;       // postfix representation
+            std::vector<ast::expression> operands_;
+            std::map<std::string, std::size_t> variables_;
+            std::size_t num_operations_ = 0;
+        };
+
+        static bool fuse_elementwise_enabled()
+        {
+            static bool enabled =
+                hpx::get_config_entry("phylanx.fuse_elementwise", "1") == "1";
+            return enabled;
+        }
+
+        // minimal number of operations to fuse
+        static std::size_t fuse_elementwise_threshold()
+        {
+            static std::size_t threshold = std::stoul(hpx::get_config_entry(
+                "phylanx.fuse_elementwise_threshold", "3"));
+            return threshold;
+        }
+
+        static char const* fused_operator(ast::optoken op)
+        {
+            switch (op)
+            {
+            case ast::optoken::op_plus:          return "+";
+            case ast::optoken::op_minus:         return "-";
+            case ast::optoken::op_times:         return "*";
+            case ast::optoken::op_divide:        return "/";
+            case ast::optoken::op_less:          return "<";
+            case ast::optoken::op_less_equal:    return "<=";
+            case ast::optoken::op_greater:       return ">";
+            case ast::optoken::op_greater_equal: return ">=";
+            case ast::optoken::op_equal:         return "==";
+            case ast::optoken::op_not_equal:     return "!=";
+            case ast::optoken::op_logical_and:   return "&&";
+            case ast::optoken::op_logical_or:    return "||";
+            case ast::optoken::op_negative:      return "neg";
+            case ast::optoken::op_not:           return "!";
+            default:
+                break;
+            }
+            return nullptr;
+        }
+
+        static void add_fused_operation(fusion_data& data, ast::optoken op)
+        {
+            data.program_ += ' ';
+            data.program_ += fused_operator(op);
+            ++data.num_operations_;
+        }
+
+        static void add_fused_operand(
+            fusion_data& data, ast::expression&& expr)
+        {
+            // variables that are referenced more than once are accessed
+            // only once
+            std::size_t index = data.operands_.size() + 1;
+            if (ast::detail::is_identifier(expr))
+            {
+                auto p = data.variables_.emplace(
+                    ast::detail::identifier_name(expr), index);
+                if (!p.second)
+                {
+                    index = p.first->second;
+                }
+                else
+                {
+                    data.operands_.push_back(std::move(expr));
+                }
+            }
+            else
+            {
+                data.operands_.push_back(std::move(expr));
+            }
+
+            if (!data.program_.empty())
+            {
+                data.program_ += ' ';
+            }
+            data.program_ += std::to_string(index);
+        }
+
+        static bool flatten_fused_operand(
+            fusion_data& data, ast::operand const& op)
+        {
+            if (op.index() == 2)
+            {
+                // unary operation, negated literals are handled as operands
+                ast::unary_expr const& ue = util::get<2>(op.get()).get();
+                if ((ue.operator_ == ast::optoken::op_negative ||
+                        ue.operator_ == ast::optoken::op_not) &&
+                    !ast::detail::is_literal_value(ue.operand_))
+                {
+                    if (!flatten_fused_operand(data, ue.operand_))
+                    {
+                        return false;
+                    }
+                    add_fused_operation(data, ue.operator_);
+                    return true;
+                }
+            }
+            else if (op.index() == 1)
+            {
+                // parenthesized sub-expression
+                ast::primary_expr const& pe = util::get<1>(op.get()).get();
+                if (pe.index() == 6)
+                {
+                    return flatten_fused_expression(
+                        data, util::get<6>(pe.get()).get());
+                }
+            }
+
+            add_fused_operand(data, ast::expression(op));
+            return true;
+        }
+
+        static bool flatten_fused_expression(
+            fusion_data& data, ast::expression const& expr)
+        {
+            if (!flatten_fused_operand(data, expr.first))
+            {
+                return false;
+            }
+
+            // convert into postfix notation, all operators are left
+            // associative
+            std::vector<ast::optoken> ops;
+            for (auto const& op : expr.rest)
+            {
+                if (fused_operator(op.operator_) == nullptr)
+                {
+                    return false;
+                }
+
+                int prec = ast::precedence_of(op.operator_);
+                while (!ops.empty() && ast::precedence_of(ops.back()) >= prec)
+                {
+                    add_fused_operation(data, ops.back());
+                    ops.pop_back();
+                }
+                ops.push_back(op.operator_);
+
+                if (!flatten_fused_operand(data, op.operand_))
+                {
+                    return false;
+                }
+            }
+
+            while (!ops.empty())
+            {
+                add_fused_operation(data, ops.back());
+                ops.pop_back();
+            }
+            return true;
+        }
+
+        // Leaves of element-wise expressions are known to be scalars if they
+        // are scalar literals or constants. Variables are treated as scalars
+        // unless they were defined from an expression known to produce an
+        // array.
+        bool is_scalar_fused_operand(ast::operand const& op)
+        {
+            if (op.index() == 2)
+            {
+                // negated literal
+                return is_scalar_fused_operand(
+                    util::get<2>(op.get()).get().operand_);
+            }
+            if (op.index() != 1)
+            {
+                return false;
+            }
+
+            ast::primary_expr const& pe = util::get<1>(op.get()).get();
+            switch (pe.index())
+            {
+            case 1:                     // bool
+                return true;
+
+            case 2:                     // phylanx::ir::node_data<double>
+                return util::get<2>(pe.get()).num_dimensions() == 0;
+
+            case 5:                     // phylanx::ir::node_data<std::int64_t>
+                return util::get<5>(pe.get()).num_dimensions() == 0;
+
+            case 9:                     // phylanx::ir::node_data<std::uint8_t>
+                return util::get<9>(pe.get()).num_dimensions() == 0;
+
+            case 3:                     // identifier
+                {
+                    std::string name =
+                        ast::detail::identifier_name(ast::expression(op));
+                    if (get_constants().find(name) != get_constants().end())
+                    {
+                        return true;
+                    }
+                    environment::definition_data* data = env_.find_data(name);
+                    return data == nullptr || !data->is_array_;
+                }
+
+            default:
+                break;
+            }
+            return false;
+        }
+
+        // An expression is known to produce an array if it is an array
+        // literal, a variable known to hold an array, or an element-wise
+        // operation on any of those.
+        bool is_known_array_operand(ast::operand const& op)
+        {
+            if (op.index() == 2)
+            {
+                return is_known_array_operand(
+                    util::get<2>(op.get()).get().operand_);
+            }
+            if (op.index() != 1)
+            {
+                return false;
+            }
+
+            ast::primary_expr const& pe = util::get<1>(op.get()).get();
+            switch (pe.index())
+            {
+            case 2:                     // phylanx::ir::node_data<double>
+                return util::get<2>(pe.get()).num_dimensions() != 0;
+
+            case 5:                     // phylanx::ir::node_data<std::int64_t>
+                return util::get<5>(pe.get()).num_dimensions() != 0;
+
+            case 9:                     // phylanx::ir::node_data<std::uint8_t>
+                return util::get<9>(pe.get()).num_dimensions() != 0;
+
+            case 3:                     // identifier
+                {
+                    environment::definition_data* data = env_.find_data(
+                        ast::detail::identifier_name(ast::expression(op)));
+                    return data != nullptr && data->is_array_;
+                }
+
+            case 6:                     // parenthesized sub-expression
+                return is_known_array(util::get<6>(pe.get()).get());
+
+            default:
+                break;
+            }
+            return false;
+        }
+
+        bool is_known_array(ast::expression const& expr)
+        {
+            bool result = is_known_array_operand(expr.first);
+            for (auto const& op : expr.rest)
+            {
+                if (fused_operator(op.operator_) == nullptr)
+                {
+                    return false;
+                }
+                result = result || is_known_array_operand(op.operand_);
+            }
+            return result;
+        }
+
+        bool handle_fusion(
+            ast::expression const& expr, ast::tagged const& id, function& f)
+        {
+            if (!fuse_elementwise_enabled())
+            {
+                return false;
+            }
+
+            // quickly reject single operands
+            if (expr.rest.empty())
+            {
+                if (expr.first.index() == 1)
+                {
+                    ast::primary_expr const& pe =
+                        util::get<1>(expr.first.get()).get();
+                    if (pe.index() != 6)
+                    {
+                        return false;
+                    }
+                }
+                else if (expr.first.index() != 2)
+                {
+                    return false;
+                }
+            }
+
+            fusion_data data;
+            if (!flatten_fused_expression(data, expr) ||
+                data.num_operations_ < fuse_elementwise_threshold())
+            {
+                return false;
+            }
+
+            // scalar expressions are left to the separate primitives, the
+            // fused evaluation applies to arrays only
+            if (std::all_of(data.operands_.begin(), data.operands_.end(),
+                    [&](ast::expression const& operand)
+                    {
+                        return is_scalar_fused_operand(operand.first);
+                    }))
+            {
+                return false;
+            }
+
+            std::string name("__fused_elementwise");
+            compiled_function* cf = env_.find(name);
+            if (cf == nullptr)
+            {
+                return false;
+            }
+
+            // add sequence number for this primitive component
+            std::size_t sequence_number = snippets_.sequence_numbers_[name]++;
+
+            // get global name of the component created
+            primitive_name_parts name_parts(name, sequence_number, id.id,
+                id.col, snippets_.compile_id_ - 1,
+                get_locality_id(default_locality_));
+
+            std::list<function> args;
+            args.push_back(literal_value(
+                primitive_argument_type{std::move(data.program_)}));
+            for (auto const& arg : data.operands_)
+            {
+                args.push_back((*this)(arg));
+            }
+
+            f = (*cf)(std::move(args), std::move(name_parts), name_);
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Loops whose condition and body consist only of scalar arithmetic,
+        // comparisons, and assignments to variables (like 'while(n < 10,
+        // block(store(i, i + n), store(n, n + 1)))') are additionally lowered
+        // into a flat sequence of three-address instructions that is run by
+        // the __scalar_loop primitive. The original loop is kept as its
+        // fallback.
+        struct scalar_loop_data
+        {
+            struct instruction
+            {
+                std::string text_;
+                std::size_t label_;     // jump target (if any)
+            };
+
+            std::vector<instruction> program_;
+            std::vector<std::size_t> labels_;   // position of labels
+            std::vector<ast::expression> operands_;
+            std::map<std::string, std::size_t> variables_;
+            std::size_t num_temporaries_ = 0;
+        };
+
+        static bool scalar_loops_enabled()
+        {
+            static bool enabled =
+                hpx::get_config_entry("phylanx.scalar_loops", "1") == "1";
+            return enabled;
+        }
+
+        static char const* scalar_operator(ast::optoken op)
+        {
+            switch (op)
+            {
+            case ast::optoken::op_plus:          return "add";
+            case ast::optoken::op_minus:         return "sub";
+            case ast::optoken::op_times:         return "mul";
+            case ast::optoken::op_divide:        return "div";
+            case ast::optoken::op_less:          return "lt";
+            case ast::optoken::op_less_equal:    return "le";
+            case ast::optoken::op_greater:       return "gt";
+            case ast::optoken::op_greater_equal: return "ge";
+            case ast::optoken::op_equal:         return "eq";
+            case ast::optoken::op_not_equal:     return "ne";
+            case ast::optoken::op_logical_and:   return "and";
+            case ast::optoken::op_logical_or:    return "or";
+            case ast::optoken::op_negative:      return "neg";
+            case ast::optoken::op_not:           return "not";
+            default:
+                break;
+            }
+            return nullptr;
+        }
+
+        static std::string new_scalar_temporary(scalar_loop_data& data)
+        {
+            return "t" + std::to_string(data.num_temporaries_++);
+        }
+
+        static std::size_t new_scalar_label(scalar_loop_data& data)
+        {
+            data.labels_.push_back(0);
+            return data.labels_.size() - 1;
+        }
+
+        static void place_scalar_label(
+            scalar_loop_data& data, std::size_t label)
+        {
+            data.labels_[label] = data.program_.size();
+        }
+
+        static void add_scalar_instruction(scalar_loop_data& data,
+            std::string text, std::size_t label = std::size_t(-1))
+        {
+            data.program_.push_back(
+                scalar_loop_data::instruction{std::move(text), label});
+        }
+
+        static std::string add_scalar_operand(
+            scalar_loop_data& data, ast::expression&& expr)
+        {
+            data.operands_.push_back(std::move(expr));
+            return "a" + std::to_string(data.operands_.size() - 1);
+        }
+
+        // variables are loaded only once, regardless of how often they are
+        // referenced
+        std::string add_scalar_variable(scalar_loop_data& data,
+            std::string const& name, ast::expression const& expr)
+        {
+            auto it = data.variables_.find(name);
+            if (it != data.variables_.end())
+            {
+                return "a" + std::to_string(it->second);
+            }
+
+            data.variables_.emplace(name, data.operands_.size());
+            return add_scalar_operand(data, ast::expression(expr));
+        }
+
+        bool is_scalar_variable(ast::expression const& expr)
+        {
+            if (!ast::detail::is_identifier(expr))
+            {
+                return false;
+            }
+            std::string name = ast::detail::identifier_name(expr);
+            return get_constants().find(name) == get_constants().end() &&
+                env_.find(name) != nullptr;
+        }
+
+        bool lower_scalar_operand(scalar_loop_data& data,
+            ast::operand const& op, std::string& result)
+        {
+            if (op.index() == 2)
+            {
+                // unary operations
+                ast::unary_expr const& ue = util::get<2>(op.get()).get();
+                if (ue.operator_ != ast::optoken::op_negative &&
+                    ue.operator_ != ast::optoken::op_not)
+                {
+                    return false;
+                }
+
+                std::string arg;
+                if (!lower_scalar_operand(data, ue.operand_, arg))
+                {
+                    return false;
+                }
+
+                result = new_scalar_temporary(data);
+                add_scalar_instruction(data,
+                    std::string(scalar_operator(ue.operator_)) + " " +
+                        result + " " + arg);
+                return true;
+            }
+
+            if (op.index() != 1)
+            {
+                return false;
+            }
+
+            ast::primary_expr const& pe = util::get<1>(op.get()).get();
+            switch (pe.index())
+            {
+            case 1: HPX_FALLTHROUGH;    // bool
+            case 2: HPX_FALLTHROUGH;    // phylanx::ir::node_data<double>
+            case 5: HPX_FALLTHROUGH;    // phylanx::ir::node_data<std::int64_t>
+            case 9:                     // phylanx::ir::node_data<std::uint8_t>
+                result = add_scalar_operand(data, ast::expression(op));
+                return true;
+
+            case 3:                     // identifier
+                {
+                    ast::expression expr(op);
+                    std::string name = ast::detail::identifier_name(expr);
+                    if (get_constants().find(name) != get_constants().end())
+                    {
+                        result = add_scalar_operand(data, std::move(expr));
+                        return true;
+                    }
+                    if (env_.find(name) == nullptr)
+                    {
+                        return false;
+                    }
+                    result = add_scalar_variable(data, name, expr);
+                    return true;
+                }
+
+            case 6:                     // parenthesized sub-expression
+                return lower_scalar_expression(
+                    data, util::get<6>(pe.get()).get(), result);
+
+            case 7:                     // function call
+                if (!ast::detail::function_attribute(op).empty())
+                {
+                    return false;
+                }
+                return lower_scalar_call(data, ast::detail::function_name(op),
+                    ast::detail::function_arguments(op), result);
+
+            default:
+                break;
+            }
+            return false;
+        }
+
+        bool lower_scalar_expression(scalar_loop_data& data,
+            ast::expression const& expr, std::string& result)
+        {
+            std::vector<std::string> regs;
+            std::vector<ast::optoken> ops;
+
+            auto apply = [&]()
+            {
+                std::string rhs = std::move(regs.back());
+                regs.pop_back();
+                std::string lhs = std::move(regs.back());
+                regs.pop_back();
+
+                std::string reg = new_scalar_temporary(data);
+                add_scalar_instruction(data,
+                    std::string(scalar_operator(ops.back())) + " " + reg +
+                        " " + lhs + " " + rhs);
+                ops.pop_back();
+                regs.push_back(std::move(reg));
+            };
+
+            std::string first;
+            if (!lower_scalar_operand(data, expr.first, first))
+            {
+                return false;
+            }
+            regs.push_back(std::move(first));
+
+            // all operators are left associative
+            for (auto const& op : expr.rest)
+            {
+                if (scalar_operator(op.operator_) == nullptr)
+                {
+                    return false;
+                }
+
+                int prec = ast::precedence_of(op.operator_);
+                while (!ops.empty() && ast::precedence_of(ops.back()) >= prec)
+                {
+                    apply();
+                }
+                ops.push_back(op.operator_);
+
+                std::string reg;
+                if (!lower_scalar_operand(data, op.operand_, reg))
+                {
+                    return false;
+                }
+                regs.push_back(std::move(reg));
+            }
+
+            while (!ops.empty())
+            {
+                apply();
+            }
+
+            result = std::move(regs.back());
+            return true;
+        }
+
+        bool lower_scalar_call(scalar_loop_data& data,
+            std::string const& name, std::vector<ast::expression> const& args,
+            std::string& result)
+        {
+            if (name == "store")
+            {
+                if (args.size() != 2 || !is_scalar_variable(args[0]))
+                {
+                    return false;
+                }
+
+                std::string value;
+                if (!lower_scalar_expression(data, args[1], value))
+                {
+                    return false;
+                }
+
+                std::string var = add_scalar_variable(
+                    data, ast::detail::identifier_name(args[0]), args[0]);
+                add_scalar_instruction(data, "mov " + var + " " + value);
+
+                result = "nil";
+                return true;
+            }
+
+            if (name == "block")
+            {
+                if (args.empty())
+                {
+                    return false;
+                }
+
+                for (auto const& arg : args)
+                {
+                    if (!lower_scalar_expression(data, arg, result))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            if (name == "if")
+            {
+                if (args.size() != 2 && args.size() != 3)
+                {
+                    return false;
+                }
+
+                std::string cond, value;
+                if (!lower_scalar_expression(data, args[0], cond))
+                {
+                    return false;
+                }
+
+                result = new_scalar_temporary(data);
+                std::size_t else_label = new_scalar_label(data);
+                std::size_t end_label = new_scalar_label(data);
+
+                add_scalar_instruction(data, "jz " + cond, else_label);
+                if (!lower_scalar_expression(data, args[1], value))
+                {
+                    return false;
+                }
+                add_scalar_instruction(data, "mov " + result + " " + value);
+                add_scalar_instruction(data, "jmp", end_label);
+
+                place_scalar_label(data, else_label);
+                if (args.size() == 3)
+                {
+                    if (!lower_scalar_expression(data, args[2], value))
+                    {
+                        return false;
+                    }
+                    add_scalar_instruction(
+                        data, "mov " + result + " " + value);
+                }
+                else
+                {
+                    add_scalar_instruction(data, "mov " + result + " nil");
+                }
+                place_scalar_label(data, end_label);
+                return true;
+            }
+
+            // while(cond, body) and for(init, cond, reinit, body)
+            bool is_for = name == "for";
+            if ((name != "while" || args.size() != 2) &&
+                (!is_for || args.size() != 4))
+            {
+                return false;
+            }
+
+            std::string cond, value, ignored;
+            if (is_for && !lower_scalar_expression(data, args[0], ignored))
+            {
+                return false;
+            }
+
+            result = new_scalar_temporary(data);
+            add_scalar_instruction(data, "mov " + result + " nil");
+
+            std::size_t loop_label = new_scalar_label(data);
+            std::size_t end_label = new_scalar_label(data);
+
+            place_scalar_label(data, loop_label);
+            if (!lower_scalar_expression(
+                    data, args[is_for ? 1 : 0], cond))
+            {
+                return false;
+            }
+            add_scalar_instruction(data, "jz " + cond, end_label);
+
+            if (!lower_scalar_expression(data, args[is_for ? 3 : 1], value))
+            {
+                return false;
+            }
+            add_scalar_instruction(data, "mov " + result + " " + value);
+
+            if (is_for && !lower_scalar_expression(data, args[2], ignored))
+            {
+                return false;
+            }
+            add_scalar_instruction(data, "jmp", loop_label);
+
+            place_scalar_label(data, end_label);
+            return true;
+        }
+
+        bool handle_scalar_loop(std::string const& function_name,
+            ast::expression const& expr, ast::tagged const& id,
+            function const& loop, function& f)
+        {
+            if (!scalar_loops_enabled())
+            {
+                return false;
+            }
+
+            scalar_loop_data data;
+            std::string result;
+            if (!ast::detail::function_attribute(expr).empty() ||
+                !lower_scalar_call(data, function_name,
+                    ast::detail::function_arguments(expr), result))
+            {
+                return false;
+            }
+            add_scalar_instruction(data, "ret " + result);
+
+            std::string name("__scalar_loop");
+            compiled_function* cf = env_.find(name);
+            if (cf == nullptr)
+            {
+                return false;
+            }
+
+            std::string program;
+            for (auto const& instr : data.program_)
+            {
+                if (!program.empty())
+                {
+                    program += "; ";
+                }
+                program += instr.text_;
+                if (instr.label_ != std::size_t(-1))
+                {
+                    program += " " + std::to_string(data.labels_[instr.label_]);
+                }
+            }
+
+            // add sequence number for this primitive component
+            std::size_t sequence_number = snippets_.sequence_numbers_[name]++;
+
+            // get global name of the component created
+            primitive_name_parts name_parts(name, sequence_number, id.id,
+                id.col, snippets_.compile_id_ - 1,
+                get_locality_id(default_locality_));
+
+            std::list<function> args;
+            args.push_back(
+                literal_value(primitive_argument_type{std::move(program)}));
+            args.push_back(loop);
+            for (auto const& arg : data.operands_)
+            {
+                args.push_back((*this)(arg));
+            }
+
+            f = (*cf)(std::move(args), std::move(name_parts), name_);
+            return true;
+        }
+
         // separate name from possible dtype
         static std::string extract_name_and_dtype(std::string const& fullname)
         {
@@ -1671,6 +2505,29 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                     //     }
                     // }
 
+                    // Handle while(_1, _2) and for(_1, _2, _3, _4)
+                    if (function_name == "while" || function_name == "for")
+                    {
+                        placeholder_map_type placeholders;
+                        if (ast::match_ast(expr, cit->second.pattern_ast_,
+                                ast::detail::on_placeholder_match{
+                                    placeholders}))
+                        {
+                            function loop = handle_placeholders(
+                                placeholders, function_name, id);
+
+                            // scalar loops are run by a separate interpreter,
+                            // if possible
+                            function lowered;
+                            if (handle_scalar_loop(
+                                    function_name, expr, id, loop, lowered))
+                            {
+                                return lowered;
+                            }
+                            return loop;
+                        }
+                    }
+
                     // handle all non-special functions
                     while (
                         cit != patterns_.end() && (*cit).first == function_name)
@@ -1695,6 +2552,13 @@ namespace phylanx { namespace execution_tree { namespace compiler {
             }
             else
             {
+                // element-wise operations are combined, if possible
+                function fused;
+                if (handle_fusion(expr, id, fused))
+                {
+                    return fused;
+                }
+
                 // this should handle all remaining constructs (non-function calls)
                 for (auto const& pattern : patterns_)
                 {
@@ -60,7 +60,9 @@ namespace phylanx { namespace execution_tree
             "phylanx::execution_tree::primitive",
             "hpx::shared_future<phylanx::execution_tree::primitive_argument_type>",
             "phylanx::ir::range",
-            "phylanx::ir::dictionary"
+            "phylanx::ir::dictionary",
+            "phylanx::ir::node_data<float>",
+            "phylanx::ir::node_data<std::int32_t>"
         };
 
         char const* get_primitive_argument_type_name(std::size_t index)
@@ -440,6 +442,8 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -497,6 +501,28 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case primitive_argument_type::float32_index:
+            {
+                auto const& v = util::get<9>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v.copy(), val.annotation()};
+                }
+                return primitive_argument_type{v, val.annotation()};
+            }
+            break;
+
+        case primitive_argument_type::int32_index:
+            {
+                auto const& v = util::get<10>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v.copy(), val.annotation()};
+                }
+                return primitive_argument_type{v, val.annotation()};
+            }
+            break;
+
         case primitive_argument_type::list_index:
             {
                 auto const& args = util::get<7>(val);
@@ -614,6 +640,28 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case primitive_argument_type::float32_index:
+            {
+                auto const& v = util::get<9>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v, val.annotation()};
+                }
+                return primitive_argument_type{v.ref(), val.annotation()};
+            }
+            break;
+
+        case primitive_argument_type::int32_index:
+            {
+                auto const& v = util::get<10>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v, val.annotation()};
+                }
+                return primitive_argument_type{v.ref(), val.annotation()};
+            }
+            break;
+
         default:
             break;
         }
@@ -644,6 +692,8 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index:
@@ -709,6 +759,28 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case primitive_argument_type::float32_index:
+            {
+                auto&& v = util::get<9>(std::move(val));
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v.copy(), val.annotation()};
+                }
+                return primitive_argument_type{std::move(v), val.annotation()};
+            }
+            break;
+
+        case primitive_argument_type::int32_index:
+            {
+                auto&& v = util::get<10>(std::move(val));
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v.copy(), val.annotation()};
+                }
+                return primitive_argument_type{std::move(v), val.annotation()};
+            }
+            break;
+
         case primitive_argument_type::list_index:
             {
                 auto ann = val.annotation();
@@ -778,6 +850,8 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -813,6 +887,12 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return util::get<4>(val).is_ref();
 
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).is_ref();
+
+        case primitive_argument_type::int32_index:
+            return util::get<10>(val).is_ref();
+
         case primitive_argument_type::list_index:
             return util::get<7>(val).is_ref();
 
@@ -851,6 +931,8 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index:
@@ -909,6 +991,28 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case primitive_argument_type::float32_index:
+            {
+                auto const& v = util::get<9>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v, val.annotation()};
+                }
+                return primitive_argument_type{v.ref(), val.annotation()};
+            }
+            break;
+
+        case primitive_argument_type::int32_index:
+            {
+                auto const& v = util::get<10>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v, val.annotation()};
+                }
+                return primitive_argument_type{v.ref(), val.annotation()};
+            }
+            break;
+
         case primitive_argument_type::list_index:
             {
                 auto const& r = util::get<7>(val);
@@ -959,6 +1063,8 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index:
@@ -992,6 +1098,8 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index:
             return true;
 
@@ -1021,7 +1129,13 @@ namespace phylanx { namespace execution_tree
             return ir::node_data<double>{util::get<2>(val).ref()};
 
         case primitive_argument_type::float64_index:
-            return util::get<4>(val).ref();
+            return util::get<4>(val).dense();
+
+        case primitive_argument_type::float32_index:
+            return ir::node_data<double>{util::get<9>(val).ref()};
+
+        case primitive_argument_type::int32_index:
+            return ir::node_data<double>{util::get<10>(val).ref()};
 
         case primitive_argument_type::future_index:
             return extract_numeric_value(
@@ -1052,7 +1166,11 @@ namespace phylanx { namespace execution_tree
         switch (val.index())
         {
         case primitive_argument_type::float64_index:
-            return util::get<4>(val).ref();
+            return util::get<4>(val).dense();
+
+        // single precision data is widened, it does not change its kind
+        case primitive_argument_type::float32_index:
+            return ir::node_data<double>{util::get<9>(val).dense()};
 
         case primitive_argument_type::future_index:
             return extract_numeric_value_strict(
@@ -1090,7 +1208,13 @@ namespace phylanx { namespace execution_tree
             return ir::node_data<double>{util::get<2>(std::move(val))};
 
         case primitive_argument_type::float64_index:
-            return util::get<4>(std::move(val));
+            return util::get<4>(std::move(val)).dense();
+
+        case primitive_argument_type::float32_index:
+            return ir::node_data<double>{util::get<9>(std::move(val))};
+
+        case primitive_argument_type::int32_index:
+            return ir::node_data<double>{util::get<10>(std::move(val))};
 
         case primitive_argument_type::future_index: {
             auto f = util::get<6>(val).get();
@@ -1137,6 +1261,16 @@ namespace phylanx { namespace execution_tree
                 return util::get<4>(val)[0];
             break;
 
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return double(util::get<9>(val)[0]);
+            break;
+
+        case primitive_argument_type::int32_index:
+            if (util::get<10>(val).num_dimensions() == 0)
+                return double(util::get<10>(val)[0]);
+            break;
+
         case primitive_argument_type::future_index:
             return extract_scalar_numeric_value(
                 util::get<6>(val).get().get(), name, codename);
@@ -1170,6 +1304,11 @@ namespace phylanx { namespace execution_tree
                 return util::get<4>(val)[0];
             break;
 
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return double(util::get<9>(val)[0]);
+            break;
+
         case primitive_argument_type::future_index:
             return extract_scalar_numeric_value_strict(
                 util::get<6>(val).get().get(), name, codename);
@@ -1215,6 +1354,16 @@ namespace phylanx { namespace execution_tree
                 return util::get<4>(std::move(val))[0];
             break;
 
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return double(util::get<9>(std::move(val))[0]);
+            break;
+
+        case primitive_argument_type::int32_index:
+            if (util::get<10>(val).num_dimensions() == 0)
+                return double(util::get<10>(std::move(val))[0]);
+            break;
+
         case primitive_argument_type::future_index: {
             auto f = util::get<6>(val).get();
             val = f.get();
@@ -1246,7 +1395,24 @@ namespace phylanx { namespace execution_tree
         switch (val.index())
         {
         case primitive_argument_type::float64_index:
-            return util::get<4>(std::move(val));
+            {
+                // sparse data is expanded in place as the result refers to it
+                auto& v = util::get<4>(val);
+                if (v.is_sparse())
+                {
+                    v = std::move(v).dense();
+                }
+                return std::move(v);
+            }
+
+        case primitive_argument_type::float32_index:
+            {
+                // single precision data is widened in place as the result
+                // refers to it
+                val = ir::node_data<double>{
+                    util::get<9>(std::move(val)).dense()};
+                return util::get<4>(std::move(val));
+            }
 
         case primitive_argument_type::future_index: {
             auto f = util::get<6>(val).get();
@@ -1284,6 +1450,11 @@ namespace phylanx { namespace execution_tree
                 return util::get<4>(std::move(val))[0];
             break;
 
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return double(util::get<9>(val)[0]);
+            break;
+
         case primitive_argument_type::future_index: {
             auto f = util::get<6>(val).get();
             val = f.get();
@@ -1318,6 +1489,8 @@ namespace phylanx { namespace execution_tree
         {
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index:
             return true;
 
@@ -1358,6 +1531,64 @@ namespace phylanx { namespace execution_tree
         return false;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    bool is_sparse_operand(primitive_argument_type const& val)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::float64_index:
+            return util::get<4>(val).is_sparse();
+
+        case primitive_argument_type::future_index:
+            return is_sparse_operand(util::get<6>(val).get().get());
+
+        default:
+            break;
+        }
+        return false;
+    }
+
+    ir::node_data<double> extract_sparse_numeric_value(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::float64_index:
+            return util::get<4>(val).ref();
+
+        case primitive_argument_type::future_index:
+            return extract_sparse_numeric_value(
+                util::get<6>(val).get().get(), name, codename);
+
+        default:
+            break;
+        }
+        return extract_numeric_value(val, name, codename);
+    }
+
+    ir::node_data<double> extract_sparse_numeric_value(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::float64_index:
+            return util::get<4>(std::move(val));
+
+        case primitive_argument_type::future_index: {
+            auto f = util::get<6>(val).get();
+            val = f.get();
+            return extract_sparse_numeric_value(
+                std::move(val), name, codename);
+        }
+
+        default:
+            break;
+        }
+        return extract_numeric_value(std::move(val), name, codename);
+    }
+
     std::size_t extract_numeric_value_dimension(
         primitive_argument_type const& val, std::string const& name,
         std::string const& codename)
@@ -1373,6 +1604,12 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return util::get<4>(val).num_dimensions();
 
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).num_dimensions();
+
+        case primitive_argument_type::int32_index:
+            return util::get<10>(val).num_dimensions();
+
         case primitive_argument_type::future_index:
             return extract_numeric_value_dimension(
                 util::get<6>(val).get().get(), name, codename);
@@ -1410,6 +1647,12 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return util::get<4>(val).size();
 
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).size();
+
+        case primitive_argument_type::int32_index:
+            return util::get<10>(val).size();
+
         case primitive_argument_type::future_index:
             return extract_numeric_value_size(
                 util::get<6>(val).get().get(), name, codename);
@@ -1438,21 +1681,436 @@ namespace phylanx { namespace execution_tree
     {
         switch (val.index())
         {
-        case primitive_argument_type::bool_index:
-            return util::get<1>(val).dimensions();
-
+        case primitive_argument_type::bool_index:
+            return util::get<1>(val).dimensions();
+
+        case primitive_argument_type::int64_index:
+            return util::get<2>(val).dimensions();
+
+        case primitive_argument_type::float64_index:
+            return util::get<4>(val).dimensions();
+
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).dimensions();
+
+        case primitive_argument_type::int32_index:
+            return util::get<10>(val).dimensions();
+
+        case primitive_argument_type::future_index:
+            return extract_numeric_value_dimensions(
+                util::get<6>(val).get().get(), name, codename);
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_numeric_value_dimensions",
+            util::generate_error_message(
+                "primitive_argument_type does not hold a numeric "
+                    "value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool is_boolean_data_operand(primitive_argument_type const& val)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::bool_index:
+            return true;
+
+        case primitive_argument_type::future_index:
+            return is_boolean_data_operand(util::get<6>(val).get().get());
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    ir::node_data<std::int64_t> extract_integer_value(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::bool_index:
+            return ir::node_data<std::int64_t>(util::get<1>(val).ref());
+
+        case primitive_argument_type::int64_index:
+            return util::get<2>(val).ref();
+
+        case primitive_argument_type::float64_index:
+            return ir::node_data<std::int64_t>(util::get<4>(val).dense());
+
+        case primitive_argument_type::int32_index:
+            return ir::node_data<std::int64_t>(util::get<10>(val).ref());
+
+        case primitive_argument_type::float32_index:
+            return ir::node_data<std::int64_t>(util::get<9>(val).dense());
+
+        case primitive_argument_type::future_index:
+            return extract_integer_value(
+                util::get<6>(val).get().get(), name, codename);
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_integer_value",
+            util::generate_error_message(
+                "primitive_argument_type does not hold an integer "
+                    "value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    ir::node_data<std::int64_t> extract_integer_value(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::bool_index:
+            return ir::node_data<std::int64_t>(util::get<1>(std::move(val)));
+
+        case primitive_argument_type::int64_index:
+            return util::get<2>(std::move(val));
+
+        case primitive_argument_type::float64_index:
+            return ir::node_data<std::int64_t>(
+                util::get<4>(std::move(val)).dense());
+
+        case primitive_argument_type::int32_index:
+            return ir::node_data<std::int64_t>(util::get<10>(std::move(val)));
+
+        case primitive_argument_type::float32_index:
+            return ir::node_data<std::int64_t>(
+                util::get<9>(std::move(val)).dense());
+
+        case primitive_argument_type::future_index:
+            return extract_integer_value(
+                util::get<6>(val).get().get(), name, codename);
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_integer_value",
+            util::generate_error_message(
+                "primitive_argument_type does not hold an integer "
+                    "value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    std::int64_t extract_scalar_integer_value(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::bool_index:
+            if (util::get<1>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<1>(val)[0]);
+            break;
+
+        case primitive_argument_type::int64_index:
+            if (util::get<2>(val).num_dimensions() == 0)
+                return util::get<2>(val)[0];
+            break;
+
+        case primitive_argument_type::float64_index:
+            if (util::get<4>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<4>(val)[0]);
+            break;
+
+        case primitive_argument_type::int32_index:
+            if (util::get<10>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<10>(val)[0]);
+            break;
+
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<9>(val)[0]);
+            break;
+
+        case primitive_argument_type::future_index:
+            return extract_scalar_integer_value(
+                util::get<6>(val).get().get(), name, codename);
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_scalar_integer_value",
+            util::generate_error_message(
+                "primitive_argument_type does not hold an integer "
+                "value type (type held: '" +
+                    type + "')",
+                name, codename));
+    }
+
+    std::int64_t extract_scalar_integer_value(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::bool_index:
+            if (util::get<1>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<1>(std::move(val))[0]);
+            break;
+
+        case primitive_argument_type::int64_index:
+            if (util::get<2>(val).num_dimensions() == 0)
+                return util::get<2>(std::move(val))[0];
+            break;
+
+        case primitive_argument_type::float64_index:
+            if (util::get<4>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<4>(std::move(val))[0]);
+            break;
+
+        case primitive_argument_type::int32_index:
+            if (util::get<10>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<10>(std::move(val))[0]);
+            break;
+
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<9>(std::move(val))[0]);
+            break;
+
+        case primitive_argument_type::future_index:
+            return extract_scalar_integer_value(
+                util::get<6>(val).get().get(), name, codename);
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_scalar_integer_value",
+            util::generate_error_message(
+                "primitive_argument_type does not hold an integer "
+                "value type (type held: '" +
+                    type + "')",
+                name, codename));
+    }
+
+    bool is_integer_operand(primitive_argument_type const& val)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int32_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float64_index:
+            return true;
+
+        case primitive_argument_type::future_index:
+            return is_integer_operand(util::get<6>(val).get().get());
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t extract_scalar_integer_value_strict(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::int64_index:
+            if (util::get<2>(val).num_dimensions() == 0)
+                return util::get<2>(val)[0];
+            break;
+
+        case primitive_argument_type::int32_index:
+            if (util::get<10>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<10>(val)[0]);
+            break;
+
+        case primitive_argument_type::future_index:
+            return extract_scalar_integer_value_strict(
+                util::get<6>(val).get().get(), name, codename);
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_scalar_integer_value_strict",
+            util::generate_error_message(
+                "primitive_argument_type does not hold an integer "
+                    "value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    std::int64_t extract_scalar_integer_value_strict(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::int64_index:
+            if (util::get<2>(val).num_dimensions() == 0)
+                return util::get<2>(std::move(val))[0];
+            break;
+
+        case primitive_argument_type::int32_index:
+            if (util::get<10>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<10>(val)[0]);
+            break;
+
+        case primitive_argument_type::future_index:
+            return extract_scalar_integer_value_strict(
+                util::get<6>(val).get().get(), name, codename);
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_scalar_integer_value_strict",
+            util::generate_error_message(
+                "primitive_argument_type does not hold an integer "
+                "value type (type held: '" +
+                    type + "')",
+                name, codename));
+    }
+
+    ir::node_data<std::int64_t> extract_integer_value_strict(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::int64_index:
+            return util::get<2>(val).ref();
+
+        // 32 bit integer data is widened, it does not change its kind
+        case primitive_argument_type::int32_index:
+            return ir::node_data<std::int64_t>{util::get<10>(val).ref()};
+
+        case primitive_argument_type::future_index:
+            return extract_integer_value_strict(
+                util::get<6>(val).get().get(), name, codename);
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_integer_value_strict",
+            util::generate_error_message(
+                "primitive_argument_type does not hold an integer "
+                "value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    ir::node_data<std::int64_t>&& extract_integer_value_strict(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        switch (val.index())
+        {
         case primitive_argument_type::int64_index:
-            return util::get<2>(val).dimensions();
+            return util::get<2>(std::move(val));
 
-        case primitive_argument_type::float64_index:
-            return util::get<4>(val).dimensions();
+        case primitive_argument_type::int32_index:
+            {
+                // 32 bit integer data is widened in place as the result
+                // refers to it
+                val = ir::node_data<std::int64_t>{
+                    util::get<10>(std::move(val))};
+                return util::get<2>(std::move(val));
+            }
 
-        case primitive_argument_type::future_index:
-            return extract_numeric_value_dimensions(
-                util::get<6>(val).get().get(), name, codename);
+        case primitive_argument_type::future_index: {
+            auto f = util::get<6>(val).get();
+            val = f.get();
+            return extract_integer_value_strict(std::move(val), name, codename);
+        }
 
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1462,26 +2120,25 @@ namespace phylanx { namespace execution_tree
 
         std::string type(detail::get_primitive_argument_type_name(val.index()));
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "phylanx::execution_tree::extract_numeric_value_dimensions",
+            "phylanx::execution_tree::extract_integer_value_strict",
             util::generate_error_message(
-                "primitive_argument_type does not hold a numeric "
-                    "value type (type held: '" + type + "')",
+                "primitive_argument_type does not hold an integer "
+                "value type (type held: '" + type + "')",
                 name, codename));
     }
 
-    ///////////////////////////////////////////////////////////////////////////
-    bool is_boolean_data_operand(primitive_argument_type const& val)
+    bool is_integer_operand_strict(primitive_argument_type const& val)
     {
         switch (val.index())
         {
-        case primitive_argument_type::bool_index:
+        case primitive_argument_type::int64_index:
             return true;
 
         case primitive_argument_type::future_index:
-            return is_boolean_data_operand(util::get<6>(val).get().get());
+            return is_integer_operand_strict(util::get<6>(val).get().get());
 
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
@@ -1490,27 +2147,31 @@ namespace phylanx { namespace execution_tree
         default:
             break;
         }
-        return false;
-    }
 
     ///////////////////////////////////////////////////////////////////////////
-    ir::node_data<std::int64_t> extract_integer_value(
+    ir::node_data<float> extract_float32_value(
         primitive_argument_type const& val, std::string const& name,
         std::string const& codename)
     {
         switch (val.index())
         {
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).ref();
+
         case primitive_argument_type::bool_index:
-            return ir::node_data<std::int64_t>(util::get<1>(val).ref());
+            return ir::node_data<float>(util::get<1>(val).ref());
 
         case primitive_argument_type::int64_index:
-            return util::get<2>(val).ref();
+            return ir::node_data<float>(util::get<2>(val).ref());
 
         case primitive_argument_type::float64_index:
-            return ir::node_data<std::int64_t>(util::get<4>(val).ref());
+            return ir::node_data<float>(util::get<4>(val).dense());
+
+        case primitive_argument_type::int32_index:
+            return ir::node_data<float>(util::get<10>(val).ref());
 
         case primitive_argument_type::future_index:
-            return extract_integer_value(
+            return extract_float32_value(
                 util::get<6>(val).get().get(), name, codename);
 
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
@@ -1524,30 +2185,36 @@ namespace phylanx { namespace execution_tree
 
         std::string type(detail::get_primitive_argument_type_name(val.index()));
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "phylanx::execution_tree::extract_integer_value",
+            "phylanx::execution_tree::extract_float32_value",
             util::generate_error_message(
-                "primitive_argument_type does not hold an integer "
+                "primitive_argument_type does not hold a float32 "
                     "value type (type held: '" + type + "')",
                 name, codename));
     }
 
-    ir::node_data<std::int64_t> extract_integer_value(
+    ir::node_data<float> extract_float32_value(
         primitive_argument_type&& val, std::string const& name,
         std::string const& codename)
     {
         switch (val.index())
         {
+        case primitive_argument_type::float32_index:
+            return util::get<9>(std::move(val));
+
         case primitive_argument_type::bool_index:
-            return ir::node_data<std::int64_t>(util::get<1>(std::move(val)));
+            return ir::node_data<float>(util::get<1>(std::move(val)));
 
         case primitive_argument_type::int64_index:
-            return util::get<2>(std::move(val));
+            return ir::node_data<float>(util::get<2>(std::move(val)));
 
         case primitive_argument_type::float64_index:
-            return ir::node_data<std::int64_t>(util::get<4>(std::move(val)));
+            return ir::node_data<float>(util::get<4>(std::move(val)).dense());
+
+        case primitive_argument_type::int32_index:
+            return ir::node_data<float>(util::get<10>(std::move(val)));
 
         case primitive_argument_type::future_index:
-            return extract_integer_value(
+            return extract_float32_value(
                 util::get<6>(val).get().get(), name, codename);
 
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
@@ -1561,36 +2228,46 @@ namespace phylanx { namespace execution_tree
 
         std::string type(detail::get_primitive_argument_type_name(val.index()));
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "phylanx::execution_tree::extract_integer_value",
+            "phylanx::execution_tree::extract_float32_value",
             util::generate_error_message(
-                "primitive_argument_type does not hold an integer "
+                "primitive_argument_type does not hold a float32 "
                     "value type (type held: '" + type + "')",
                 name, codename));
     }
 
-    std::int64_t extract_scalar_integer_value(
+    float extract_scalar_float32_value(
         primitive_argument_type const& val, std::string const& name,
         std::string const& codename)
     {
         switch (val.index())
         {
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return util::get<9>(val)[0];
+            break;
+
         case primitive_argument_type::bool_index:
             if (util::get<1>(val).num_dimensions() == 0)
-                return std::int64_t(util::get<1>(val)[0]);
+                return float(util::get<1>(val)[0]);
             break;
 
         case primitive_argument_type::int64_index:
             if (util::get<2>(val).num_dimensions() == 0)
-                return util::get<2>(val)[0];
+                return float(util::get<2>(val)[0]);
             break;
 
         case primitive_argument_type::float64_index:
             if (util::get<4>(val).num_dimensions() == 0)
-                return std::int64_t(util::get<4>(val)[0]);
+                return float(util::get<4>(val)[0]);
+            break;
+
+        case primitive_argument_type::int32_index:
+            if (util::get<10>(val).num_dimensions() == 0)
+                return float(util::get<10>(val)[0]);
             break;
 
         case primitive_argument_type::future_index:
-            return extract_scalar_integer_value(
+            return extract_scalar_float32_value(
                 util::get<6>(val).get().get(), name, codename);
 
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
@@ -1604,75 +2281,83 @@ namespace phylanx { namespace execution_tree
 
         std::string type(detail::get_primitive_argument_type_name(val.index()));
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "phylanx::execution_tree::extract_scalar_integer_value",
+            "phylanx::execution_tree::extract_scalar_float32_value",
             util::generate_error_message(
-                "primitive_argument_type does not hold an integer "
-                "value type (type held: '" +
-                    type + "')",
+                "primitive_argument_type does not hold a float32 "
+                    "value type (type held: '" + type + "')",
                 name, codename));
     }
 
-    std::int64_t extract_scalar_integer_value(
+    float extract_scalar_float32_value(
         primitive_argument_type&& val, std::string const& name,
         std::string const& codename)
+    {
+        return extract_scalar_float32_value(val, name, codename);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    ir::node_data<float> extract_float32_value_strict(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
     {
         switch (val.index())
         {
-        case primitive_argument_type::bool_index:
-            if (util::get<1>(val).num_dimensions() == 0)
-                return std::int64_t(util::get<1>(std::move(val))[0]);
-            break;
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).ref();
 
-        case primitive_argument_type::int64_index:
-            if (util::get<2>(val).num_dimensions() == 0)
-                return util::get<2>(std::move(val))[0];
-            break;
+        case primitive_argument_type::future_index:
+            return extract_float32_value_strict(
+                util::get<6>(val).get().get(), name, codename);
 
-        case primitive_argument_type::float64_index:
-            if (util::get<4>(val).num_dimensions() == 0)
-                return std::int64_t(util::get<4>(std::move(val))[0]);
+        default:
             break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_float32_value_strict",
+            util::generate_error_message(
+                "primitive_argument_type does not hold a float32 "
+                    "value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    ir::node_data<float> extract_float32_value_strict(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::float32_index:
+            return util::get<9>(std::move(val));
 
         case primitive_argument_type::future_index:
-            return extract_scalar_integer_value(
+            return extract_float32_value_strict(
                 util::get<6>(val).get().get(), name, codename);
 
-        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
         default:
             break;
         }
 
         std::string type(detail::get_primitive_argument_type_name(val.index()));
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "phylanx::execution_tree::extract_scalar_integer_value",
+            "phylanx::execution_tree::extract_float32_value_strict",
             util::generate_error_message(
-                "primitive_argument_type does not hold an integer "
-                "value type (type held: '" +
-                    type + "')",
+                "primitive_argument_type does not hold a float32 "
+                    "value type (type held: '" + type + "')",
                 name, codename));
     }
 
-    bool is_integer_operand(primitive_argument_type const& val)
+    bool is_float32_operand_strict(primitive_argument_type const& val)
     {
         switch (val.index())
         {
-        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::float64_index:
+        case primitive_argument_type::float32_index:
             return true;
 
         case primitive_argument_type::future_index:
-            return is_integer_operand(util::get<6>(val).get().get());
+            return is_float32_operand_strict(util::get<6>(val).get().get());
 
-        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
         default:
             break;
         }
@@ -1680,25 +2365,33 @@ namespace phylanx { namespace execution_tree
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    std::int64_t extract_scalar_integer_value_strict(
+    ir::node_data<std::int32_t> extract_int32_value(
         primitive_argument_type const& val, std::string const& name,
         std::string const& codename)
     {
         switch (val.index())
         {
+        case primitive_argument_type::int32_index:
+            return util::get<10>(val).ref();
+
+        case primitive_argument_type::bool_index:
+            return ir::node_data<std::int32_t>(util::get<1>(val).ref());
+
         case primitive_argument_type::int64_index:
-            if (util::get<2>(val).num_dimensions() == 0)
-                return util::get<2>(val)[0];
-            break;
+            return ir::node_data<std::int32_t>(util::get<2>(val).ref());
+
+        case primitive_argument_type::float64_index:
+            return ir::node_data<std::int32_t>(util::get<4>(val).dense());
+
+        case primitive_argument_type::float32_index:
+            return ir::node_data<std::int32_t>(util::get<9>(val).dense());
 
         case primitive_argument_type::future_index:
-            return extract_scalar_integer_value_strict(
+            return extract_int32_value(
                 util::get<6>(val).get().get(), name, codename);
 
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1708,32 +2401,42 @@ namespace phylanx { namespace execution_tree
 
         std::string type(detail::get_primitive_argument_type_name(val.index()));
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "phylanx::execution_tree::extract_scalar_integer_value_strict",
+            "phylanx::execution_tree::extract_int32_value",
             util::generate_error_message(
-                "primitive_argument_type does not hold an integer "
+                "primitive_argument_type does not hold an int32 "
                     "value type (type held: '" + type + "')",
                 name, codename));
     }
 
-    std::int64_t extract_scalar_integer_value_strict(
+    ir::node_data<std::int32_t> extract_int32_value(
         primitive_argument_type&& val, std::string const& name,
         std::string const& codename)
     {
         switch (val.index())
         {
+        case primitive_argument_type::int32_index:
+            return util::get<10>(std::move(val));
+
+        case primitive_argument_type::bool_index:
+            return ir::node_data<std::int32_t>(util::get<1>(std::move(val)));
+
         case primitive_argument_type::int64_index:
-            if (util::get<2>(val).num_dimensions() == 0)
-                return util::get<2>(std::move(val))[0];
-            break;
+            return ir::node_data<std::int32_t>(util::get<2>(std::move(val)));
+
+        case primitive_argument_type::float64_index:
+            return ir::node_data<std::int32_t>(
+                util::get<4>(std::move(val)).dense());
+
+        case primitive_argument_type::float32_index:
+            return ir::node_data<std::int32_t>(
+                util::get<9>(std::move(val)).dense());
 
         case primitive_argument_type::future_index:
-            return extract_scalar_integer_value_strict(
+            return extract_int32_value(
                 util::get<6>(val).get().get(), name, codename);
 
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1743,31 +2446,50 @@ namespace phylanx { namespace execution_tree
 
         std::string type(detail::get_primitive_argument_type_name(val.index()));
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "phylanx::execution_tree::extract_scalar_integer_value_strict",
+            "phylanx::execution_tree::extract_int32_value",
             util::generate_error_message(
-                "primitive_argument_type does not hold an integer "
-                "value type (type held: '" +
-                    type + "')",
+                "primitive_argument_type does not hold an int32 "
+                    "value type (type held: '" + type + "')",
                 name, codename));
     }
 
-    ir::node_data<std::int64_t> extract_integer_value_strict(
+    std::int32_t extract_scalar_int32_value(
         primitive_argument_type const& val, std::string const& name,
         std::string const& codename)
     {
         switch (val.index())
         {
+        case primitive_argument_type::int32_index:
+            if (util::get<10>(val).num_dimensions() == 0)
+                return util::get<10>(val)[0];
+            break;
+
+        case primitive_argument_type::bool_index:
+            if (util::get<1>(val).num_dimensions() == 0)
+                return std::int32_t(util::get<1>(val)[0]);
+            break;
+
         case primitive_argument_type::int64_index:
-            return util::get<2>(val).ref();
+            if (util::get<2>(val).num_dimensions() == 0)
+                return std::int32_t(util::get<2>(val)[0]);
+            break;
+
+        case primitive_argument_type::float64_index:
+            if (util::get<4>(val).num_dimensions() == 0)
+                return std::int32_t(util::get<4>(val)[0]);
+            break;
+
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return std::int32_t(util::get<9>(val)[0]);
+            break;
 
         case primitive_argument_type::future_index:
-            return extract_integer_value_strict(
+            return extract_scalar_int32_value(
                 util::get<6>(val).get().get(), name, codename);
 
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1777,70 +2499,90 @@ namespace phylanx { namespace execution_tree
 
         std::string type(detail::get_primitive_argument_type_name(val.index()));
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "phylanx::execution_tree::extract_integer_value_strict",
+            "phylanx::execution_tree::extract_scalar_int32_value",
             util::generate_error_message(
-                "primitive_argument_type does not hold an integer "
-                "value type (type held: '" + type + "')",
+                "primitive_argument_type does not hold an int32 "
+                    "value type (type held: '" + type + "')",
                 name, codename));
     }
 
-    ir::node_data<std::int64_t>&& extract_integer_value_strict(
+    std::int32_t extract_scalar_int32_value(
         primitive_argument_type&& val, std::string const& name,
         std::string const& codename)
+    {
+        return extract_scalar_int32_value(val, name, codename);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    ir::node_data<std::int32_t> extract_int32_value_strict(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
     {
         switch (val.index())
         {
-        case primitive_argument_type::int64_index:
-            return util::get<2>(std::move(val));
+        case primitive_argument_type::int32_index:
+            return util::get<10>(val).ref();
 
-        case primitive_argument_type::future_index: {
-            auto f = util::get<6>(val).get();
-            val = f.get();
-            return extract_integer_value_strict(std::move(val), name, codename);
+        case primitive_argument_type::future_index:
+            return extract_int32_value_strict(
+                util::get<6>(val).get().get(), name, codename);
+
+        default:
+            break;
         }
 
-        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_int32_value_strict",
+            util::generate_error_message(
+                "primitive_argument_type does not hold an int32 "
+                    "value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    ir::node_data<std::int32_t> extract_int32_value_strict(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::int32_index:
+            return util::get<10>(std::move(val));
+
+        case primitive_argument_type::future_index:
+            return extract_int32_value_strict(
+                util::get<6>(val).get().get(), name, codename);
+
         default:
             break;
         }
 
         std::string type(detail::get_primitive_argument_type_name(val.index()));
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "phylanx::execution_tree::extract_integer_value_strict",
+            "phylanx::execution_tree::extract_int32_value_strict",
             util::generate_error_message(
-                "primitive_argument_type does not hold an integer "
-                "value type (type held: '" + type + "')",
+                "primitive_argument_type does not hold an int32 "
+                    "value type (type held: '" + type + "')",
                 name, codename));
     }
 
-    bool is_integer_operand_strict(primitive_argument_type const& val)
+    bool is_int32_operand_strict(primitive_argument_type const& val)
     {
         switch (val.index())
         {
-        case primitive_argument_type::int64_index:
+        case primitive_argument_type::int32_index:
             return true;
 
         case primitive_argument_type::future_index:
-            return is_integer_operand_strict(util::get<6>(val).get().get());
+            return is_int32_operand_strict(util::get<6>(val).get().get());
 
-        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
-        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
         default:
             break;
         }
         return false;
     }
+        return false;
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     std::int64_t extract_scalar_positive_integer_value(
@@ -1982,7 +2724,13 @@ namespace phylanx { namespace execution_tree
             return ir::node_data<std::uint8_t>{util::get<2>(val).ref()};
 
         case primitive_argument_type::float64_index:
-            return ir::node_data<std::uint8_t>{util::get<4>(val).ref()};
+            return ir::node_data<std::uint8_t>{util::get<4>(val).dense()};
+
+        case primitive_argument_type::int32_index:
+            return ir::node_data<std::uint8_t>{util::get<10>(val).ref()};
+
+        case primitive_argument_type::float32_index:
+            return ir::node_data<std::uint8_t>{util::get<9>(val).dense()};
 
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
@@ -2045,7 +2793,15 @@ namespace phylanx { namespace execution_tree
             return ir::node_data<std::uint8_t>{util::get<2>(std::move(val))};
 
         case primitive_argument_type::float64_index:
-            return ir::node_data<std::uint8_t>{util::get<4>(std::move(val))};
+            return ir::node_data<std::uint8_t>{
+                util::get<4>(std::move(val)).dense()};
+
+        case primitive_argument_type::int32_index:
+            return ir::node_data<std::uint8_t>{util::get<10>(std::move(val))};
+
+        case primitive_argument_type::float32_index:
+            return ir::node_data<std::uint8_t>{
+                util::get<9>(std::move(val)).dense()};
 
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
@@ -2115,6 +2871,12 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return bool(util::get<4>(val));
 
+        case primitive_argument_type::float32_index:
+            return bool(util::get<9>(val));
+
+        case primitive_argument_type::int32_index:
+            return bool(util::get<10>(val));
+
         case primitive_argument_type::list_index:
             return !(util::get<7>(val).empty());
 
@@ -2154,6 +2916,12 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return bool(util::get<4>(std::move(val)));
 
+        case primitive_argument_type::float32_index:
+            return bool(util::get<9>(std::move(val)));
+
+        case primitive_argument_type::int32_index:
+            return bool(util::get<10>(std::move(val)));
+
         case primitive_argument_type::list_index:
             return !(util::get<7>(std::move(val)).empty());
 
@@ -2243,6 +3011,8 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index:
             return true;
@@ -4453,6 +5223,14 @@ namespace phylanx { namespace execution_tree
             ast::detail::to_string{os}(util::get<4>(val));
             break;
 
+        case primitive_argument_type::float32_index:
+            ast::detail::to_string{os}(util::get<9>(val));
+            break;
+
+        case primitive_argument_type::int32_index:
+            ast::detail::to_string{os}(util::get<10>(val));
+            break;
+
         case primitive_argument_type::primitive_index:
             break;
 
@@ -4585,6 +5363,14 @@ namespace std
             return phylanx::execution_tree::hash_node_data_zero_dim_value(
                 phylanx::util::get<4>(val));
 
+        case primitive_argument_type::float32_index:
+            return phylanx::execution_tree::hash_node_data_zero_dim_value(
+                phylanx::util::get<9>(val));
+
+        case primitive_argument_type::int32_index:
+            return phylanx::execution_tree::hash_node_data_zero_dim_value(
+                phylanx::util::get<10>(val));
+
         case primitive_argument_type::future_index:
             return (*this)(phylanx::util::get<6>(val).get().get());
 
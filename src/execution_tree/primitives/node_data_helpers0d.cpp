@@ -31,10 +31,18 @@ namespace phylanx { namespace execution_tree
         {
             result = node_data_type_bool;
         }
+        else if (spec == "int32")
+        {
+            result = node_data_type_int32;
+        }
         else if (spec.find("int") == 0)
         {
             result = node_data_type_int64;
         }
+        else if (spec == "float32")
+        {
+            result = node_data_type_float32;
+        }
         else if (spec.find("float") == 0)
         {
             result = node_data_type_double;
@@ -66,10 +74,18 @@ namespace phylanx { namespace execution_tree
         {
             result = node_data_type_double;
         }
+        else if (is_float32_operand_strict(arg))
+        {
+            result = node_data_type_float32;
+        }
         else if (is_integer_operand_strict(arg))
         {
             result = node_data_type_int64;
         }
+        else if (is_int32_operand_strict(arg))
+        {
+            result = node_data_type_int32;
+        }
         else if (is_boolean_operand_strict(arg))
         {
             result = node_data_type_bool;
@@ -84,21 +100,10 @@ namespace phylanx { namespace execution_tree
         node_data_type result = node_data_type_unknown;
         for (auto const& arg : args)
         {
-            if (is_numeric_operand_strict(arg))
+            result = common_data_type(result, extract_common_type(arg));
+            if (result == node_data_type_double)
             {
-                result = node_data_type_double;
-                break;
-            }
-            else if (is_integer_operand_strict(arg) &&
-                (result == node_data_type_unknown ||
-                    result == node_data_type_bool))
-            {
-                result = node_data_type_int64;
-            }
-            else if (is_boolean_operand_strict(arg) &&
-                result == node_data_type_unknown)
-            {
-                result = node_data_type_bool;
+                break;      // can't get more general than that
             }
         }
         return result;
@@ -354,6 +359,12 @@ namespace phylanx { namespace execution_tree
     template PHYLANX_EXPORT ir::node_data<std::uint8_t>
     extract_value_scalar<std::uint8_t>(primitive_argument_type const& val,
         std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_scalar<float>(primitive_argument_type const& val,
+        std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<std::int32_t>
+    extract_value_scalar<std::int32_t>(primitive_argument_type const& val,
+        std::string const& name, std::string const& codename);
 
     template PHYLANX_EXPORT ir::node_data<double>
     extract_value_scalar<double>(primitive_argument_type&& val,
@@ -364,4 +375,10 @@ namespace phylanx { namespace execution_tree
     template PHYLANX_EXPORT ir::node_data<std::uint8_t>
     extract_value_scalar<std::uint8_t>(primitive_argument_type&& val,
         std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_scalar<float>(primitive_argument_type&& val,
+        std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<std::int32_t>
+    extract_value_scalar<std::int32_t>(primitive_argument_type&& val,
+        std::string const& name, std::string const& codename);
 }}
@@ -214,6 +214,12 @@ namespace phylanx { namespace execution_tree
     template PHYLANX_EXPORT ir::node_data<std::uint8_t>
     extract_value_vector<std::uint8_t>(primitive_argument_type const& val,
         std::size_t size, std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_vector<float>(primitive_argument_type const& val,
+        std::size_t size, std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<std::int32_t>
+    extract_value_vector<std::int32_t>(primitive_argument_type const& val,
+        std::size_t size, std::string const& name, std::string const& codename);
 
     template PHYLANX_EXPORT ir::node_data<double>
     extract_value_vector<double>(primitive_argument_type&& val,
@@ -224,4 +230,10 @@ namespace phylanx { namespace execution_tree
     template PHYLANX_EXPORT ir::node_data<std::uint8_t>
     extract_value_vector<std::uint8_t>(primitive_argument_type&& val,
         std::size_t size, std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_vector<float>(primitive_argument_type&& val,
+        std::size_t size, std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<std::int32_t>
+    extract_value_vector<std::int32_t>(primitive_argument_type&& val,
+        std::size_t size, std::string const& name, std::string const& codename);
 }}
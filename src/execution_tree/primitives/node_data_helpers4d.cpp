@@ -727,6 +727,16 @@ namespace phylanx { namespace execution_tree
         std::size_t quats, std::size_t pages, std::size_t rows,
         std::size_t columns, std::string const& name,
         std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_quatern<float>(primitive_argument_type const& val,
+        std::size_t quats, std::size_t pages, std::size_t rows,
+        std::size_t columns, std::string const& name,
+        std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<std::int32_t>
+    extract_value_quatern<std::int32_t>(primitive_argument_type const& val,
+        std::size_t quats, std::size_t pages, std::size_t rows,
+        std::size_t columns, std::string const& name,
+        std::string const& codename);
 
     template PHYLANX_EXPORT ir::node_data<double> extract_value_quatern<double>(
         primitive_argument_type&& val, std::size_t quats, std::size_t pages,
@@ -742,5 +752,15 @@ namespace phylanx { namespace execution_tree
         std::size_t quats, std::size_t pages, std::size_t rows,
         std::size_t columns, std::string const& name,
         std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_quatern<float>(primitive_argument_type&& val,
+        std::size_t quats, std::size_t pages, std::size_t rows,
+        std::size_t columns, std::string const& name,
+        std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<std::int32_t>
+    extract_value_quatern<std::int32_t>(primitive_argument_type&& val,
+        std::size_t quats, std::size_t pages, std::size_t rows,
+        std::size_t columns, std::string const& name,
+        std::string const& codename);
 }}
 
@@ -16,6 +16,7 @@
 #include <hpx/modules/naming.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
@@ -45,6 +46,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
       , eval_count_(0ll)
       , eval_duration_(0ll)
       , execute_directly_(eval_direct ? 1 : -1)
+      , direct_execution_decisions_(0ll)
+      , eval_sample_countdown_(get_eval_sample_interval())
+      , eval_direct_(eval_direct)
       , measurements_enabled_(false)
     {
 #if defined(HPX_HAVE_APEX)
@@ -107,7 +111,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 #endif
 
         // perform measurements only when needed
-        bool enable_timer = measurements_enabled_ || (execute_directly_ == -1);
+        bool enable_timer = enable_eval_timer();
 
         util::scoped_timer<std::int64_t> timer(eval_duration_, enable_timer);
         if (enable_timer)
@@ -139,7 +143,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 #endif
 
         // perform measurements only when needed
-        bool enable_timer = measurements_enabled_ || (execute_directly_ == -1);
+        bool enable_timer = enable_eval_timer();
 
         util::scoped_timer<std::int64_t> timer(eval_duration_, enable_timer);
         if (enable_timer)
@@ -303,6 +307,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return hpx::util::get_and_reset_value(execute_directly_, reset);
     }
 
+    std::int64_t primitive_component_base::get_direct_execution_decisions(
+        bool reset) const
+    {
+        return hpx::util::get_and_reset_value(
+            direct_execution_decisions_, reset);
+    }
+
     std::int64_t primitive_component_base::get_transferred_bytes(bool reset) const
     {
         return 0;
@@ -377,6 +388,25 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return exec_lower_threshold;
     }
 
+    // enable the adaptive direct execution policy
+    bool primitive_component_base::get_adaptive_direct_execution()
+    {
+        static bool adaptive_direct_execution = hpx::get_config_entry(
+            "phylanx.adaptive_direct_execution", "1") == "1";
+        return adaptive_direct_execution;
+    }
+
+    // get the number of eval invocations between two measurements once the
+    // execution policy has been decided
+    std::int64_t primitive_component_base::get_eval_sample_interval()
+    {
+        static std::int64_t eval_sample_interval = (std::max)(
+            std::stoll(hpx::get_config_entry(
+                "phylanx.eval_sample_interval", "64")),
+            1ll);
+        return eval_sample_interval;
+    }
+
 #if defined(PHYLANX_HAVE_TASK_INLINING_POLICY) && defined(HPX_HAVE_APEX)
 
     hpx::launch
@@ -554,7 +584,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return hpx::launch::sync;
         }
 
-        if ((eval_count_ != 0 && measurements_enabled_) ||
+        if (get_adaptive_direct_execution())
+        {
+            if (!eval_direct_ && eval_count_ > get_ec_threshold())
+            {
+                update_direct_execution();
+            }
+        }
+        else if ((eval_count_ != 0 && measurements_enabled_) ||
             (eval_count_ > get_ec_threshold()))
         {
             // check whether execution status needs to be changed (with some
@@ -585,4 +622,76 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         return policy;
     }
+
+    bool primitive_component_base::enable_eval_timer() const
+    {
+        // Measure every invocation until decided, update_direct_execution
+        // settles on a decision after eval_sample_interval samples.
+        if (execute_directly_ == -1)
+        {
+            --eval_sample_countdown_;
+            return true;
+        }
+
+        if (measurements_enabled_)
+        {
+            return true;
+        }
+
+        // Once decided, measure only every n-th invocation. This keeps the
+        // overhead low while still allowing to revisit the decision.
+        if (!eval_direct_ && get_adaptive_direct_execution() &&
+            --eval_sample_countdown_ <= 0)
+        {
+            eval_sample_countdown_ = get_eval_sample_interval();
+            return true;
+        }
+        return false;
+    }
+
+    void primitive_component_base::update_direct_execution() const
+    {
+        std::int64_t exec_time = (eval_duration_ / eval_count_);
+
+        // Switch to direct execution only if eval is clearly cheaper than
+        // creating a new task (and vice versa). Execution times between both
+        // thresholds keep the current decision to avoid oscillation.
+        std::int64_t execute_directly = execute_directly_;
+        if (exec_time > get_exec_upper_threshold())
+        {
+            execute_directly = 0;
+        }
+        else if (exec_time < get_exec_lower_threshold())
+        {
+            execute_directly = 1;
+        }
+        else if (execute_directly == -1 && eval_sample_countdown_ <= 0)
+        {
+            // Still undecided after eval_sample_interval samples, settle
+            // on the mode closer to the measured execution time to stop
+            // timing every invocation.
+            std::int64_t midpoint =
+                (get_exec_lower_threshold() + get_exec_upper_threshold()) / 2;
+            execute_directly = exec_time < midpoint ? 1 : 0;
+        }
+
+        if (execute_directly != -1 && execute_directly_ == -1)
+        {
+            eval_sample_countdown_ = get_eval_sample_interval();
+        }
+
+        if (execute_directly != execute_directly_)
+        {
+            execute_directly_ = execute_directly;
+            ++direct_execution_decisions_;
+        }
+
+        // start a new measurement window, unless the values are being
+        // reported by the performance counters
+        if (!measurements_enabled_)
+        {
+            eval_count_ = 0;
+            eval_duration_ = 0;
+        }
+    }
 }}}
@@ -300,6 +300,35 @@ namespace phylanx { namespace ir
         increment_move_construction_count();
     }
 
+    /// Create node data for a sparse 1-dimensional or 2-dimensional value
+    template <typename T>
+    node_data<T>::node_data(sparse_storage1d_type const& values)
+      : data_(values)
+    {
+        increment_copy_construction_count();
+    }
+
+    template <typename T>
+    node_data<T>::node_data(sparse_storage1d_type&& values)
+      : data_(std::move(values))
+    {
+        increment_move_construction_count();
+    }
+
+    template <typename T>
+    node_data<T>::node_data(sparse_storage2d_type const& values)
+      : data_(values)
+    {
+        increment_copy_construction_count();
+    }
+
+    template <typename T>
+    node_data<T>::node_data(sparse_storage2d_type&& values)
+      : data_(std::move(values))
+    {
+        increment_move_construction_count();
+    }
+
     // conversion helpers for Python bindings and AST parsing
     template <typename T>
     node_data<T>::node_data(std::vector<T> const& values)
@@ -457,6 +486,14 @@ namespace phylanx { namespace ir
             }
             break;
 
+        case sparse_storage1d: HPX_FALLTHROUGH;
+        case sparse_storage2d:
+            {
+                increment_copy_construction_count();
+                return d.data_;
+            }
+            break;
+
         default:
             HPX_THROW_EXCEPTION(hpx::invalid_status,
                 "phylanx::ir::node_data<T>::node_data<T>",
@@ -635,6 +672,38 @@ namespace phylanx { namespace ir
         return *this;
     }
 
+    template <typename T>
+    node_data<T>& node_data<T>::operator=(sparse_storage1d_type const& val)
+    {
+        increment_copy_assignment_count();
+        data_ = val;
+        return *this;
+    }
+
+    template <typename T>
+    node_data<T>& node_data<T>::operator=(sparse_storage1d_type && val)
+    {
+        increment_move_assignment_count();
+        data_ = std::move(val);
+        return *this;
+    }
+
+    template <typename T>
+    node_data<T>& node_data<T>::operator=(sparse_storage2d_type const& val)
+    {
+        increment_copy_assignment_count();
+        data_ = val;
+        return *this;
+    }
+
+    template <typename T>
+    node_data<T>& node_data<T>::operator=(sparse_storage2d_type && val)
+    {
+        increment_move_assignment_count();
+        data_ = std::move(val);
+        return *this;
+    }
+
     // conversion helpers for Python bindings and AST parsing
     template <typename T>
     node_data<T>& node_data<T>::operator=(std::vector<T> const& values)
@@ -794,6 +863,14 @@ namespace phylanx { namespace ir
             }
             break;
 
+        case sparse_storage1d: HPX_FALLTHROUGH;
+        case sparse_storage2d:
+            {
+                increment_copy_assignment_count();
+                return d.data_;
+            }
+            break;
+
         default:
             HPX_THROW_EXCEPTION(hpx::invalid_status,
                 "phylanx::ir::node_data<T>::node_data<T>",
@@ -958,6 +1035,15 @@ namespace phylanx { namespace ir
                 return m(idx_m, idx_n);
             }
 
+        case sparse_storage1d:
+            return util::get<sparse_storage1d>(data_)[index];
+
+        case sparse_storage2d:
+            {
+                auto const& m = util::get<sparse_storage2d>(data_);
+                return m(index / m.columns(), index % m.columns());
+            }
+
         case storage3d:         HPX_FALLTHROUGH;
         case custom_storage3d:  HPX_FALLTHROUGH;
         case storage4d:         HPX_FALLTHROUGH;
@@ -1004,6 +1090,12 @@ namespace phylanx { namespace ir
         case custom_storage4d:
             return quatern()(indices[0], indices[1], indices[2], indices[3]);
 
+        case sparse_storage1d:
+            return util::get<sparse_storage1d>(data_)[indices[0]];
+
+        case sparse_storage2d:
+            return util::get<sparse_storage2d>(data_)(indices[0], indices[1]);
+
         default:
             break;
         }
@@ -1039,6 +1131,12 @@ namespace phylanx { namespace ir
         case custom_storage4d:
             return quatern()(index1, index2, index3, index4);
 
+        case sparse_storage1d:
+            return util::get<sparse_storage1d>(data_)[index1];
+
+        case sparse_storage2d:
+            return util::get<sparse_storage2d>(data_)(index1, index2);
+
         default:
             break;
         }
@@ -1082,6 +1180,15 @@ namespace phylanx { namespace ir
                 return q.quats() * q.pages() * q.rows() * q.columns() ;
             }
 
+        case sparse_storage1d:
+            return util::get<sparse_storage1d>(data_).size();
+
+        case sparse_storage2d:
+            {
+                auto const& m = util::get<sparse_storage2d>(data_);
+                return m.rows() * m.columns();
+            }
+
         default:
             break;
         }
@@ -2050,6 +2157,102 @@ namespace phylanx { namespace ir
         return *s;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    typename node_data<T>::sparse_storage1d_type& node_data<T>::sparse_vector()
+    {
+        sparse_storage1d_type* v = util::get_if<sparse_storage1d_type>(&data_);
+        if (v == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::sparse_vector()",
+                "node_data object does not hold a sparse vector");
+        }
+        return *v;
+    }
+
+    template <typename T>
+    typename node_data<T>::sparse_storage1d_type const&
+    node_data<T>::sparse_vector() const
+    {
+        sparse_storage1d_type const* v =
+            util::get_if<sparse_storage1d_type>(&data_);
+        if (v == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::sparse_vector()",
+                "node_data object does not hold a sparse vector");
+        }
+        return *v;
+    }
+
+    template <typename T>
+    typename node_data<T>::sparse_storage2d_type& node_data<T>::sparse_matrix()
+    {
+        sparse_storage2d_type* m = util::get_if<sparse_storage2d_type>(&data_);
+        if (m == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::sparse_matrix()",
+                "node_data object does not hold a sparse matrix");
+        }
+        return *m;
+    }
+
+    template <typename T>
+    typename node_data<T>::sparse_storage2d_type const&
+    node_data<T>::sparse_matrix() const
+    {
+        sparse_storage2d_type const* m =
+            util::get_if<sparse_storage2d_type>(&data_);
+        if (m == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::sparse_matrix()",
+                "node_data object does not hold a sparse matrix");
+        }
+        return *m;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    node_data<T> node_data<T>::dense() const&
+    {
+        switch (data_.index())
+        {
+        case sparse_storage1d:
+            return node_data<T>{
+                storage1d_type(util::get<sparse_storage1d>(data_))};
+
+        case sparse_storage2d:
+            return node_data<T>{
+                storage2d_type(util::get<sparse_storage2d>(data_))};
+
+        default:
+            break;
+        }
+        return ref();
+    }
+
+    template <typename T>
+    node_data<T> node_data<T>::dense() &&
+    {
+        switch (data_.index())
+        {
+        case sparse_storage1d:
+            return node_data<T>{
+                storage1d_type(util::get<sparse_storage1d>(data_))};
+
+        case sparse_storage2d:
+            return node_data<T>{
+                storage2d_type(util::get<sparse_storage2d>(data_))};
+
+        default:
+            break;
+        }
+        return std::move(*this);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// Extract the dimensionality of the underlying data array.
     template <typename T>
@@ -2069,6 +2272,12 @@ namespace phylanx { namespace ir
         case custom_storage2d:
             return 2;
 
+        case sparse_storage1d:
+            return 1;
+
+        case sparse_storage2d:
+            return 2;
+
         case storage3d:         HPX_FALLTHROUGH;
         case custom_storage3d:
             return 3;
@@ -2120,6 +2329,15 @@ namespace phylanx { namespace ir
                 return dimensions_type{
                     q.quats(), q.pages(), q.rows(), q.columns()};
             }
+
+        case sparse_storage1d:
+            return dimensions_type{util::get<sparse_storage1d>(data_).size()};
+
+        case sparse_storage2d:
+            {
+                auto const& m = util::get<sparse_storage2d>(data_);
+                return dimensions_type{m.rows(), m.columns()};
+            }
         default:
             break;
         }
@@ -2222,6 +2440,18 @@ namespace phylanx { namespace ir
                     break;
                 }
             }
+
+        case sparse_storage1d:  HPX_FALLTHROUGH;
+        case sparse_storage2d:
+            {
+                if (dim < 0 || std::size_t(dim) >= num_dimensions())
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::ir::node_data<T>::dimension()",
+                        "unknown dimension requested");
+                }
+                return dimensions()[dim];
+            }
         default:
             break;
         }
@@ -2256,7 +2486,9 @@ namespace phylanx { namespace ir
         case custom_storage1d: HPX_FALLTHROUGH;
         case custom_storage2d: HPX_FALLTHROUGH;
         case custom_storage3d: HPX_FALLTHROUGH;
-        case custom_storage4d:
+        case custom_storage4d:  HPX_FALLTHROUGH;
+        case sparse_storage1d:  HPX_FALLTHROUGH;
+        case sparse_storage2d:      // compressed data can't be referred to
             return *this;
 
         default:
@@ -2292,7 +2524,9 @@ namespace phylanx { namespace ir
         case custom_storage1d: HPX_FALLTHROUGH;
         case custom_storage2d: HPX_FALLTHROUGH;
         case custom_storage3d: HPX_FALLTHROUGH;
-        case custom_storage4d:
+        case custom_storage4d:  HPX_FALLTHROUGH;
+        case sparse_storage1d:  HPX_FALLTHROUGH;
+        case sparse_storage2d:      // compressed data can't be referred to
             return *this;
 
         default:
@@ -2330,7 +2564,9 @@ namespace phylanx { namespace ir
         case storage1d: HPX_FALLTHROUGH;
         case storage2d: HPX_FALLTHROUGH;
         case storage3d: HPX_FALLTHROUGH;
-        case storage4d:
+        case storage4d: HPX_FALLTHROUGH;
+        case sparse_storage1d: HPX_FALLTHROUGH;
+        case sparse_storage2d:
             return *this;
 
         case custom_storage0d:
@@ -2383,6 +2619,10 @@ namespace phylanx { namespace ir
         case custom_storage4d:
             return true;
 
+        case sparse_storage1d: HPX_FALLTHROUGH;
+        case sparse_storage2d:
+            return false;
+
         default:
             break;
         }
@@ -2405,6 +2645,9 @@ namespace phylanx { namespace ir
                 return std::vector<T>(v.begin(), v.end());
             }
 
+        case sparse_storage1d:
+            return dense().as_vector();
+
         case storage0d:         HPX_FALLTHROUGH;
         case storage2d:         HPX_FALLTHROUGH;
         case custom_storage0d:  HPX_FALLTHROUGH;
@@ -2440,6 +2683,9 @@ namespace phylanx { namespace ir
                 return result;
             }
 
+        case sparse_storage2d:
+            return dense().as_matrix();
+
         case storage0d:         HPX_FALLTHROUGH;
         case storage1d:         HPX_FALLTHROUGH;
         case custom_storage0d:  HPX_FALLTHROUGH;
@@ -2551,6 +2797,11 @@ namespace phylanx { namespace ir
             return false;
         }
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return lhs.dense() == rhs.dense();
+        }
+
         switch (lhs.index())
         {
         case node_data<double>::storage0d:          HPX_FALLTHROUGH;
@@ -2590,6 +2841,11 @@ namespace phylanx { namespace ir
             return false;
         }
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return lhs.dense() == rhs.dense();
+        }
+
         switch (lhs.index())
         {
         case node_data<std::uint8_t>::storage0d:          HPX_FALLTHROUGH;
@@ -2629,6 +2885,11 @@ namespace phylanx { namespace ir
             return false;
         }
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return lhs.dense() == rhs.dense();
+        }
+
         switch (lhs.index())
         {
         case node_data<std::int64_t>::storage0d:          HPX_FALLTHROUGH;
@@ -2659,6 +2920,60 @@ namespace phylanx { namespace ir
             "node_data object holds unsupported data type");
     }
 
+    namespace detail
+    {
+        template <typename T>
+        bool equal_node_data(node_data<T> const& lhs, node_data<T> const& rhs)
+        {
+            if (lhs.num_dimensions() != rhs.num_dimensions() ||
+                lhs.dimensions() != rhs.dimensions())
+            {
+                return false;
+            }
+
+            if (lhs.is_sparse() || rhs.is_sparse())
+            {
+                return lhs.dense() == rhs.dense();
+            }
+
+            switch (lhs.num_dimensions())
+            {
+            case 0:
+                return lhs.scalar() == rhs.scalar();
+
+            case 1:
+                return lhs.vector() == rhs.vector();
+
+            case 2:
+                return lhs.matrix() == rhs.matrix();
+
+            case 3:
+                return lhs.tensor() == rhs.tensor();
+
+            case 4:
+                return lhs.quatern() == rhs.quatern();
+
+            default:
+                break;
+            }
+
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::operator==()",
+                "node_data object holds unsupported data type");
+        }
+    }
+
+    bool operator==(node_data<float> const& lhs, node_data<float> const& rhs)
+    {
+        return detail::equal_node_data(lhs, rhs);
+    }
+
+    bool operator==(
+        node_data<std::int32_t> const& lhs, node_data<std::int32_t> const& rhs)
+    {
+        return detail::equal_node_data(lhs, rhs);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail
     {
@@ -2685,6 +3000,12 @@ namespace phylanx { namespace ir
             return false;
         }
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return allclose(
+                lhs.dense(), rhs.dense(), rtol, atol, equal_nan);
+        }
+
         auto isclose = detail::isclose{atol, rtol, equal_nan};
 
         switch (lhs.index())
@@ -2792,6 +3113,11 @@ namespace phylanx { namespace ir
     ///////////////////////////////////////////////////////////////////////////
     std::ostream& operator<<(std::ostream& out, node_data<double> const& nd)
     {
+        if (nd.is_sparse())
+        {
+            return out << nd.dense();
+        }
+
         auto f = [&]()
         {
             switch (nd.index())
@@ -2845,6 +3171,10 @@ namespace phylanx { namespace ir
     std::ostream& operator<<(
         std::ostream& out, node_data<std::int64_t> const& nd)
     {
+        if (nd.is_sparse())
+        {
+            return out << nd.dense();
+        }
 
         auto f = [&]()
         {
@@ -2901,6 +3231,11 @@ namespace phylanx { namespace ir
     std::ostream& operator<<(
         std::ostream& out, node_data<std::uint8_t> const& nd)
     {
+        if (nd.is_sparse())
+        {
+            return out << nd.dense();
+        }
+
         auto f = [&]()
         {
             switch (nd.index())
@@ -2953,6 +3288,67 @@ namespace phylanx { namespace ir
         return out;
     }
 
+    namespace detail
+    {
+        template <typename T>
+        std::ostream& print_node_data(std::ostream& out, node_data<T> const& nd)
+        {
+            if (nd.is_sparse())
+            {
+                return out << nd.dense();
+            }
+
+            switch (nd.num_dimensions())
+            {
+            case 0:
+                out << nd.scalar();
+                break;
+
+            case 1:
+                print_vector<T>(out, nd.vector(), nd.size());
+                break;
+
+            case 2:
+                {
+                    auto m = nd.matrix();
+                    print_matrix<T>(out, m, m.rows(), m.columns());
+                }
+                break;
+
+            case 3:
+                {
+                    auto t = nd.tensor();
+                    print_tensor<T>(out, t, t.pages(), t.rows(), t.columns());
+                }
+                break;
+
+            case 4:
+                {
+                    auto q = nd.quatern();
+                    print_quatern<T>(
+                        out, q, q.quats(), q.pages(), q.rows(), q.columns());
+                }
+                break;
+
+            default:
+                throw std::runtime_error("invalid dimensionality: " +
+                    std::to_string(nd.num_dimensions()));
+            }
+            return out;
+        }
+    }
+
+    std::ostream& operator<<(std::ostream& out, node_data<float> const& nd)
+    {
+        return detail::print_node_data(out, nd);
+    }
+
+    std::ostream& operator<<(
+        std::ostream& out, node_data<std::int32_t> const& nd)
+    {
+        return detail::print_node_data(out, nd);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     node_data<T>::operator bool() const
@@ -2978,6 +3374,12 @@ namespace phylanx { namespace ir
         case storage4d:          HPX_FALLTHROUGH;
         case custom_storage4d:
             return quatern().nonZeros() != 0;
+
+        case sparse_storage1d:
+            return blaze::nonZeros(util::get<sparse_storage1d>(data_)) != 0;
+
+        case sparse_storage2d:
+            return blaze::nonZeros(util::get<sparse_storage2d>(data_)) != 0;
         default:
             HPX_THROW_EXCEPTION(hpx::invalid_status,
                 "node_data<double>::operator bool",
@@ -3035,6 +3437,14 @@ namespace phylanx { namespace ir
         case custom_storage4d:
             ar << util::get<custom_storage4d>(data_);
             break;
+
+        case sparse_storage1d:
+            ar << util::get<sparse_storage1d>(data_);
+            break;
+
+        case sparse_storage2d:
+            ar << util::get<sparse_storage2d>(data_);
+            break;
         default:
             HPX_THROW_EXCEPTION(hpx::invalid_status,
                 "node_data<T>::serialize",
@@ -3095,6 +3505,22 @@ namespace phylanx { namespace ir
                 data_ = std::move(q);
             }
             break;
+
+        case sparse_storage1d:
+            {
+                sparse_storage1d_type v;
+                ar >> v;
+                data_ = std::move(v);
+            }
+            break;
+
+        case sparse_storage2d:
+            {
+                sparse_storage2d_type m;
+                ar >> m;
+                data_ = std::move(m);
+            }
+            break;
         default:
             HPX_THROW_EXCEPTION(hpx::invalid_status,
                 "node_data<T>::serialize",
@@ -3106,3 +3532,5 @@ namespace phylanx { namespace ir
 template class PHYLANX_EXPORT phylanx::ir::node_data<double>;
 template class PHYLANX_EXPORT phylanx::ir::node_data<std::uint8_t>;
 template class PHYLANX_EXPORT phylanx::ir::node_data<std::int64_t>;
+template class PHYLANX_EXPORT phylanx::ir::node_data<float>;
+template class PHYLANX_EXPORT phylanx::ir::node_data<std::int32_t>;
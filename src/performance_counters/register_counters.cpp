@@ -9,6 +9,7 @@
 #include <phylanx/execution_tree/compiler/primitive_name.hpp>
 #include <phylanx/execution_tree/primitives/primitive_component.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/util/serialization/blaze.hpp>
 
 #include <hpx/include/agas.hpp>
 #include <hpx/include/components.hpp>
@@ -239,6 +240,13 @@ namespace phylanx { namespace performance_counters {
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    // the value reported by a direct_execution_counter
+    enum class direct_execution_kind
+    {
+        state,        // current decision whether to execute eval directly
+        decisions     // number of times the decision has changed
+    };
+
     class direct_execution_counter
       : public hpx::performance_counters::base_performance_counter<
             direct_execution_counter>
@@ -246,14 +254,17 @@ namespace phylanx { namespace performance_counters {
     public:
         direct_execution_counter()
           : first_init_(false)
+          , decisions_counter_(false)
         {
         }
 
         direct_execution_counter(
-            hpx::performance_counters::counter_info const& info)
+            hpx::performance_counters::counter_info const& info,
+            direct_execution_kind kind)
           : hpx::performance_counters::base_performance_counter<
                 direct_execution_counter>(info)
           , first_init_(false)
+          , decisions_counter_(kind == direct_execution_kind::decisions)
         {
         }
 
@@ -280,7 +291,15 @@ namespace phylanx { namespace performance_counters {
             // Extract the values from instances_
             for (auto const& instance : instances_)
             {
-                result.push_back(instance->get_direct_execution(reset));
+                if (decisions_counter_)
+                {
+                    result.push_back(
+                        instance->get_direct_execution_decisions(reset));
+                }
+                else
+                {
+                    result.push_back(instance->get_direct_execution(reset));
+                }
             }
 
             value.values_ = std::move(result);
@@ -314,7 +333,14 @@ namespace phylanx { namespace performance_counters {
                 // Consider the reset flag
                 if (reset)
                 {
-                    instance->get_direct_execution(true);
+                    if (decisions_counter_)
+                    {
+                        instance->get_direct_execution_decisions(true);
+                    }
+                    else
+                    {
+                        instance->get_direct_execution(true);
+                    }
                 }
                 instances_sorted[instance_info.sequence_number] = instance;
             }
@@ -335,11 +361,12 @@ namespace phylanx { namespace performance_counters {
 
         std::vector<base_primitive_ptr> instances_;
         std::atomic<bool> first_init_;
+        bool decisions_counter_;
     };
 
     hpx::naming::gid_type direct_execution_counter_creator(
         hpx::performance_counters::counter_info const& info,
-        hpx::error_code& ec)
+        direct_execution_kind kind, hpx::error_code& ec)
     {
         namespace pc = hpx::performance_counters;
 
@@ -374,7 +401,7 @@ namespace phylanx { namespace performance_counters {
                     hpx::components::component<direct_execution_counter>;
 
                 id = hpx::components::server::construct<
-                    direct_execution_counter_type>(complemented_info);
+                    direct_execution_counter_type>(complemented_info, kind);
             }
             catch (hpx::exception const& e)
             {
@@ -395,6 +422,22 @@ namespace phylanx { namespace performance_counters {
         return hpx::naming::invalid_gid;
     }
 
+    hpx::naming::gid_type direct_execution_state_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        return direct_execution_counter_creator(
+            info, direct_execution_kind::state, ec);
+    }
+
+    hpx::naming::gid_type direct_execution_decisions_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        return direct_execution_counter_creator(
+            info, direct_execution_kind::decisions, ec);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     class transferred_bytes_counter
       : public hpx::performance_counters::base_performance_counter<
@@ -584,6 +627,25 @@ namespace phylanx { namespace performance_counters {
             "returns the current value of the move-assignment count of "
             "any node_data<double>");
 
+        hpx::performance_counters::install_counter_type(
+            "/phylanx/compiler/count/cache_hits",
+            &execution_tree::compile_cache_hits,
+            "returns the number of times compiled PhySL code was reused "
+            "instead of being compiled again");
+
+        hpx::performance_counters::install_counter_type(
+            "/phylanx/compiler/count/cache_misses",
+            &execution_tree::compile_cache_misses,
+            "returns the number of times PhySL code had to be compiled "
+            "because it was not found in the compile cache");
+
+        hpx::performance_counters::install_counter_type(
+            "/phylanx/serialization/count/zero_copy_bytes_sent",
+            &util::zero_copy_bytes_sent,
+            "returns the number of bytes of array data sent as zero-copy "
+            "chunks, i.e. without copying them into the parcel buffer",
+            "bytes");
+
         // Iterate and register a time and count performance counter per each
         // primitive
         namespace et = phylanx::execution_tree;
@@ -621,7 +683,19 @@ namespace phylanx { namespace performance_counters {
                 "the eval function for each " +
                     name +
                     " primitive was executed directly",
-                &direct_execution_counter_creator,
+                &direct_execution_state_counter_creator,
+                &hpx::performance_counters::locality_counter_discoverer);
+
+            // Register a performance counter for the number of changes of
+            // the direct execution decision
+            hpx::performance_counters::install_counter_type(
+                "/phylanx/primitives/" + name + "/count/eval_direct_decisions",
+                hpx::performance_counters::counter_raw_values,
+                "returns a list whose elements contain the number of times "
+                "the adaptive execution policy changed its decision whether "
+                "to execute the eval function directly for each " +
+                    name + " primitive",
+                &direct_execution_decisions_counter_creator,
                 &hpx::performance_counters::locality_counter_discoverer);
 
             // Register a transferred bytes performance counter
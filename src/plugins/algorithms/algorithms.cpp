@@ -17,3 +17,5 @@ PHYLANX_REGISTER_PLUGIN_FACTORY(kmeans_plugin,
     phylanx::execution_tree::primitives::kmeans::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(lra_plugin,
     phylanx::execution_tree::primitives::lra::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(lda_trainer_plugin,
+    phylanx::execution_tree::primitives::lda_trainer::match_data);
@@ -5,9 +5,11 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/plugins/algorithms/als.hpp>
+#include <phylanx/util/random.hpp>
 
 #include <hpx/iostream.hpp>
 #include <hpx/include/lcos.hpp>
+#include <hpx/include/parallel_for_loop.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/errors/throw_exception.hpp>
 
@@ -16,6 +18,7 @@
 #include <iostream>
 #include <memory>
 #include <numeric>
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
@@ -117,32 +120,55 @@ namespace phylanx { namespace execution_tree { namespace primitives
         matrix_type XtX(num_factors, num_factors);
         matrix_type YtY(num_factors, num_factors);
 
-        std::uint32_t seed_ = 0;
-        std::mt19937 rng_{seed_};
+        // initialize the factors with the same values as the first two
+        // invocations of random() after set_seed(0)
         std::normal_distribution<double> dist;
+        auto randomize = [&](matrix_type& m, util::random_stream stream) {
+            std::size_t const columns = m.columns();
+            util::random_for_each(m.rows() * columns, dist,
+                [&](std::normal_distribution<double>& d, std::size_t index) {
+                    m(index / columns, index % columns) =
+                        util::random_element(d, stream, index);
+                });
+        };
 
-        for (std::size_t row = 0; row != blaze::rows(X); ++row)
-        {
-            for (auto& val : blaze::row(X, row))
-            {
-                val = dist(rng_);
-            }
-        }
+        randomize(X, util::random_stream{0, 0});
+        randomize(Y, util::random_stream{0, 1});
 
-        for (std::size_t row = 0; row != blaze::rows(Y); ++row)
-        {
-            for (auto& val : blaze::row(Y, row))
+        blaze::IdentityMatrix<double> I_f(num_factors);
+
+        // Only the non-zero confidence values contribute to the factor
+        // systems: with C_u = I + diag(conf_u) we have
+        //
+        //      Y^T C_u Y = Y^T Y + Y^T (C_u - I) Y
+        //
+        // where Y^T Y is shared by all users and the second term involves
+        // only the items the user has interacted with (similarly for items).
+        blaze::CompressedMatrix<double> conf_users = conf;
+        blaze::CompressedMatrix<double, blaze::columnMajor> conf_items =
+            conf_users;
+
+        // solve (Y^T C_u Y + reg I) x_u = Y^T C_u p_u for a single user (or
+        // item) using a Cholesky factorization of the (small, symmetric
+        // positive definite) system matrix
+        auto solve_factors = [&](matrix_type const& factors,
+                                 matrix_type const& FtF, auto begin, auto end,
+                                 auto&& result) {
+            matrix_type A = FtF;
+            vector_type b(num_factors, 0.0);
+
+            for (auto it = begin; it != end; ++it)
             {
-                val = dist(rng_);
+                auto f = blaze::trans(blaze::row(factors, it->index()));
+                A += it->value() * (f * blaze::trans(f));
+                b += (it->value() + 1.0) * f;
             }
-        }
 
-        blaze::IdentityMatrix<double> I_f(num_factors);
-        blaze::IdentityMatrix<double> I_i(num_items);
-        blaze::IdentityMatrix<double> I_u(num_users);
+            blaze::potrf(A, 'L');
+            blaze::potrs(A, b, 'L');
 
-        blaze::DynamicMatrix<double> c_u(num_items, num_items, 0);
-        blaze::DynamicMatrix<double> c_i(num_users, num_users, 0);
+            result = blaze::trans(b);
+        };
 
         for (std::int64_t step = 0; step < iterations; ++step)
         {
@@ -155,31 +181,19 @@ namespace phylanx { namespace execution_tree { namespace primitives
                           << "\nY: " << Y << std::endl;
             }
 
-            for (std::int64_t u = 0; u < num_users; u++)
-            {
-                auto conf_u = blaze::trans(blaze::row(conf, u));
-                auto diag = blaze::band(c_u, 0);
-                diag = conf_u;
-                blaze::DynamicVector<double> p_u =
-                    blaze::map(conf_u, [&](double x) { return (x != 0.0); });
-                auto A = (blaze::trans(Y) * c_u) * Y + YtY;
-                auto b = (blaze::trans(Y) * (c_u + I_i)) * (p_u);
-                auto row_x = blaze::row(X, u);
-                row_x = (trans(b) * blaze::inv(A));
-            }
+            hpx::for_loop(hpx::execution::par, std::int64_t(0), num_users,
+                [&](std::int64_t u)
+                {
+                    solve_factors(Y, YtY, conf_users.cbegin(u),
+                        conf_users.cend(u), blaze::row(X, u));
+                });
 
-            for (std::int64_t i = 0; i < num_items; i++)
-            {
-                auto conf_i = blaze::column(conf, i);
-                auto diag = blaze::band(c_i, 0);
-                diag = conf_i;
-                blaze::DynamicVector<double> p_i =
-                    blaze::map(conf_i, [&](double x) { return (x != 0.0); });
-                auto A = (blaze::trans(X) * c_i) * X + XtX;
-                auto b = (blaze::trans(X) * (c_i + I_u)) * (p_i);
-                auto row_y = blaze::row(Y, i);
-                row_y = (trans(b) * blaze::inv(A));
-            }
+            hpx::for_loop(hpx::execution::par, std::int64_t(0), num_items,
+                [&](std::int64_t i)
+                {
+                    solve_factors(X, XtX, conf_items.cbegin(i),
+                        conf_items.cend(i), blaze::row(Y, i));
+                });
         }
 
         return primitive_argument_type
@@ -11,6 +11,7 @@
 
 #include <hpx/iostream.hpp>
 #include <hpx/include/lcos.hpp>
+#include <hpx/include/parallel_for_loop.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/errors/throw_exception.hpp>
 
@@ -18,6 +19,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <random>
 #include <string>
@@ -40,28 +42,37 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     __arg(_3_iterations, 10),
                     __arg(_4_show_result, false),
                     __arg(_5_seed, nil),
-                    __arg(_6_initial_centroids, nil)
+                    __arg(_6_initial_centroids, nil),
+                    __arg(_7_init, "random"),
+                    __arg(_8_tolerance, 0.0)
                 )
             )"},
             &create_kmeans, &create_primitive<kmeans>, R"(
             points, num_centroids, iterations, show_result, seed,
-            initial_centroids
+            initial_centroids, init, tolerance
 
             Args:
 
-                points (matrix): a matrix with any number of rows and two
-                    columns. Any data that can be represented by two features
-                    can create the point matrix.
+                points (matrix): a matrix with any number of rows and at least
+                    one column. Each row represents a point, each column
+                    represents a feature.
                 num_centroids (int, optional): the number of clusters in which
                     we need to break down the data. It sets to 3 by default
-                iterations (int, optional): the number of iterations. It sets
-                    to 10 by default.
+                iterations (int, optional): the maximal number of iterations.
+                    It sets to 10 by default.
                 show_result (bool, optional): defaults to false.
                 seed (int) : the seed of a random number generator.
                 initial_centroids (matrix): if not given, the centroids are
-                    initialized by num_centroids randomly chosen points. If
-                    given there is no use for a seed. The initial_centroids
-                    matrix should have num_centroids rows and 2 columns.
+                    initialized as specified by init. If given there is no use
+                    for a seed. The initial_centroids matrix should have
+                    num_centroids rows and as many columns as points.
+                init (string, optional): the method used to initialize the
+                    centroids, either 'random' (num_centroids randomly chosen
+                    points, the default) or 'k-means++'.
+                tolerance (float, optional): the iteration stops as soon as
+                    no centroid has moved by more than this distance. It sets
+                    to 0.0 by default, i.e. the iteration stops once the
+                    centroids do not change anymore.
 
             Returns:
 
@@ -75,13 +86,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
       : primitive_component_base(std::move(operands), name, codename)
     {}
 
-    ///////////////////////////////////////////////////////////////////////////
     // choose num_centroids random points as the initial centroids
     blaze::DynamicMatrix<double> kmeans::initialize_centroids(
-        blaze::DynamicMatrix<double> const& points, std::size_t num_points,
-        std::size_t num_centroids) const
+        points_type const& points, std::size_t num_centroids) const
     {
-        blaze::DynamicMatrix<double> centroids(num_centroids, 2);
+        std::size_t num_points = points.rows();
+
+        blaze::DynamicMatrix<double> centroids(
+            num_centroids, points.columns());
         std::uniform_int_distribution<std::int64_t> distribution(
             0, num_points - 1);
         std::vector<std::size_t> indices;
@@ -101,62 +113,50 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
             blaze::row(centroids, i) = blaze::row(points, rand_index);
         }
-        return std::move(centroids);
+        return centroids;
     }
 
-    // assign each point to its closest centroid
-    blaze::DynamicVector<std::size_t> kmeans::closest_centroids(
-        blaze::DynamicMatrix<double> const& points,
-        blaze::DynamicMatrix<double> const& centroids, std::size_t num_points,
-        std::size_t num_centroids) const
+    // k-means++: choose the first centroid randomly, every subsequent
+    // centroid is chosen with a probability proportional to the squared
+    // distance of a point to its closest centroid chosen so far
+    blaze::DynamicMatrix<double> kmeans::initialize_centroids_plusplus(
+        points_type const& points, std::size_t num_centroids) const
     {
-        auto points_x = blaze::column(points, 0);
-        auto points_y = blaze::column(points, 1);
-        auto centroids_x = blaze::column(centroids, 0);
-        auto centroids_y = blaze::column(centroids, 1);
-
-        // calculating the index for each row of points
-        blaze::DynamicVector<std::size_t> result(num_points);
-        for (std::size_t i = 0; i != num_points; ++i)
-        {
-            auto temp = blaze::DynamicVector<double>(num_centroids);
-            for (std::size_t j = 0; j != num_centroids; ++j)
-            {
-                temp[j] = blaze::sqrt(
-                    blaze::pow(points_x[i] - centroids_x[j], 2) +
-                    blaze::pow(points_y[i] - centroids_y[j], 2));
-            }
-            result[i] = blaze::argmin(temp);
-        }
-        return std::move(result);
-    }
+        std::size_t num_points = points.rows();
 
-    // generates new centroids as the centers of clusters
-    blaze::DynamicMatrix<double> kmeans::move_centroids(
-        blaze::DynamicMatrix<double> const& points,
-        blaze::DynamicVector<std::size_t>&& closest,
-        blaze::DynamicMatrix<double>&& centroids,
-        std::size_t num_points, std::size_t num_centroids) const
-    {
-        blaze::DynamicMatrix<double> result(num_centroids, 2, 0.0);
-        std::size_t count;
-        for (size_t k = 0; k != num_centroids; ++k)
+        blaze::DynamicMatrix<double> centroids(
+            num_centroids, points.columns());
+
+        std::uniform_int_distribution<std::size_t> first(0, num_points - 1);
+        blaze::row(centroids, 0) = blaze::row(points, first(util::rng_));
+
+        blaze::DynamicVector<double> distances(
+            num_points, (std::numeric_limits<double>::max)());
+        std::size_t num_blocks = (num_points + common::kmeans_block_size - 1) /
+            common::kmeans_block_size;
+
+        for (std::size_t k = 1; k != num_centroids; ++k)
         {
-            count = 0;
-            for (size_t i = 0; i != num_points; ++i)
-            {
-                if (closest[i] == k)
+            auto centroid = blaze::row(centroids, k - 1);
+            hpx::for_loop(hpx::execution::par, std::size_t(0), num_blocks,
+                [&](std::size_t block)
                 {
-                    blaze::row(result, k) += blaze::row(points, i);
-                    count += 1;
-                }
-            }
-            if (count != 0)
-            {
-                blaze::row(result, k) /= count;
-            }
+                    std::size_t begin = block * common::kmeans_block_size;
+                    std::size_t end = (std::min)(
+                        begin + common::kmeans_block_size, num_points);
+
+                    for (std::size_t i = begin; i != end; ++i)
+                    {
+                        distances[i] = (std::min)(distances[i],
+                            blaze::sqrNorm(blaze::row(points, i) - centroid));
+                    }
+                });
+
+            std::discrete_distribution<std::size_t> next(
+                distances.begin(), distances.end());
+            blaze::row(centroids, k) = blaze::row(points, next(util::rng_));
         }
-        return std::move(result);
+        return centroids;
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -173,12 +173,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     "argument, points, to represent a matrix"));
         }
         auto const points = arg0.matrix();
-        if (points.columns() != 2)
+        if (points.columns() == 0)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter, "kmeans::calculate_kmeans",
                 generate_error_message(
                     "the kmeans algorithm primitive requires for the first "
-                    "argument, points, to have exacty 2 columns"));
+                    "argument, points, to have at least one column"));
         }
 
         std::size_t num_centroids = 3;
@@ -210,7 +210,36 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
         util::set_seed(seed);
 
+        std::string init = "random";
+        if (valid(args[6]))
+        {
+            init = extract_string_value(std::move(args[6]), name_, codename_);
+            if (init != "random" && init != "k-means++")
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "kmeans::calculate_kmeans",
+                    generate_error_message(
+                        "the kmeans algorithm primitive requires for init "
+                        "to be either 'random' or 'k-means++'"));
+            }
+        }
+
+        double tolerance = 0.0;
+        if (valid(args[7]))
+        {
+            tolerance = extract_scalar_numeric_value(
+                std::move(args[7]), name_, codename_);
+        }
+
         std::size_t num_points = points.rows();
+        if (num_points < num_centroids)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "kmeans::calculate_kmeans",
+                generate_error_message(
+                    "the kmeans algorithm primitive requires at least "
+                    "num_centroids points"));
+        }
 
         // initializing the centroids
         blaze::DynamicMatrix<double> centroids;
@@ -227,34 +256,49 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         "initial_centroids to represent a matrix"));
             }
             centroids = arg5.matrix();
-            if (centroids.columns() != 2 || centroids.rows() != num_centroids)
+            if (centroids.columns() != points.columns() ||
+                centroids.rows() != num_centroids)
             {
                 HPX_THROW_EXCEPTION(hpx::bad_parameter,
                     "kmeans::calculate_kmeans",
                     generate_error_message(
                         "the kmeans algorithm primitive requires for the "
-                        "initial_centroids to have num_centroids rows and 2 "
-                        "columns"));
+                        "initial_centroids to have num_centroids rows and "
+                        "as many columns as the points"));
             }
         }
+        else if (init == "k-means++")
+        {
+            centroids = initialize_centroids_plusplus(points, num_centroids);
+        }
         else
         {
-            centroids = initialize_centroids(points, num_points, num_centroids);
+            centroids = initialize_centroids(points, num_centroids);
         }
 
         // kmeans calculations
-        blaze::DynamicVector<std::size_t> closest;
+        double const max_shift = tolerance * tolerance;
         for (std::size_t i = 0; i != iterations; ++i)
         {
-            closest =
-                closest_centroids(points, centroids, num_points, num_centroids);
-            centroids = move_centroids(points, std::move(closest),
-                std::move(centroids), num_points, num_centroids);
+            auto closest = common::kmeans_closest_centroids(points, centroids);
+            auto moved = common::kmeans_move_centroids(
+                common::kmeans_accumulate(points, closest, num_centroids),
+                centroids);
+
+            double shift = common::kmeans_max_shift(centroids, moved);
+
+            centroids = std::move(moved);
             if (show_result)
             {
                 std::cout << "centroids after iteration " << i << ": "
                           << centroids << std::endl;
             }
+
+            // stop early if the centroids have converged
+            if (shift <= max_shift)
+            {
+                break;
+            }
         }
 
         return primitive_argument_type{std::move(centroids)};
@@ -265,12 +309,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_arguments_type const& operands,
         primitive_arguments_type const& args, eval_context ctx) const
     {
-        if (operands.empty() || operands.size() > 6)
+        if (operands.empty() || operands.size() > 8)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter, "kmeans::eval",
                 generate_error_message(
                     "the kmeans algorithm primitive requires at least one and "
-                    "at most 6 operands"));
+                    "at most 8 operands"));
         }
 
         if (!valid(operands[0]))
@@ -64,14 +64,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         // extract arguments
         auto arg1 = extract_numeric_value(args[0], name_, codename_);
-        if (arg1.num_dimensions() != 2)
+        if (arg1.num_dimensions() != 0)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter, "lda_trainer::eval",
                 generate_error_message(
                     "the lda_trainer algorithm primitive requires for the first "
-                    "argument ('n_topics') to represent a matrix"));
+                    "argument ('n_topics') to represent a scalar"));
         }
-        auto topics = arg1.scalar();
+        auto topics = static_cast<std::int64_t>(arg1.scalar());
 
         auto arg2 = extract_numeric_value(args[1], name_, codename_);
         if (arg2.num_dimensions() != 0)
@@ -134,11 +134,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 */
 
-        if (arg5.num_dimensions() > 0)
+        if (arg5.num_dimensions() != 2)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter, "lda_trainer::eval",
                 generate_error_message(
-                    "the lda_trainer algorithm primitive requires for the second "
+                    "the lda_trainer algorithm primitive requires for the fifth "
                     "argument ('word_doc_mat') to represent a matrix"));
         }
         auto word_doc_mat = arg5.matrix();
@@ -162,7 +162,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<primitive_argument_type> lda_trainer::eval(
         primitive_arguments_type const& operands,
-        primitive_arguments_type const& args) const
+        primitive_arguments_type const& args, eval_context ctx) const
     {
         if (operands.size() != 5)
         {
@@ -200,7 +200,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     return this_->calculate_lda_trainer(std::move(args));
                 }),
             detail::map_operands(
-                operands, functional::value_operand{}, args, name_, codename_));
+                operands, functional::value_operand{}, args, name_, codename_,
+                std::move(ctx)));
     }
 
 /*
@@ -4,7 +4,15 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 #include "phylanx/plugins/algorithms/lda_trainer.hpp"
+#include <phylanx/util/random.hpp>
+
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/runtime.hpp>
+
+#include <cstddef>
 #include <cstdint>
+#include <random>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////
 REGISTER_DISTRIBUTED_MATRIX_DECLARATION(double);
@@ -12,102 +20,58 @@ REGISTER_DISTRIBUTED_MATRIX_DECLARATION(double);
 /////////////////////////////////////////////////////////////////////
 namespace phylanx { namespace execution_tree { namespace primitives {
 
-// https://bitbucket.org/blaze-lib/blaze/issues/158/random-number-distributions
+// Collapsed Gibbs sampling of the word instances of the documents
+// [part.first_doc, part.last_doc). The sampler uses (and updates) the
+// private word-topic and topic counts of the partition, the rows of dp
+// and the elements of z touched here are owned by this partition.
 //
-template< typename Rand    // Random number generator
-        , typename Dist >  // Random distribution
-decltype(auto) random( size_t size, Rand& rand, Dist& dist ) {
-  return blaze::generate( size, [&rand,&dist]( size_t ){
-     return dist( rand );
-  } );
-}
-
 void lda_trainer_impl::gibbs(
-    const blaze::DynamicMatrix<double> & word_doc_mat,
+    const corpus & docs,
     const double alpha,
     const double beta,
-    blaze::DynamicVector<std::int64_t> & z,
-    blaze::DynamicMatrix<double> & wp0,
-    blaze::DynamicMatrix<double> & dp,
-    blaze::DynamicVector<double, blaze::rowVector> & ztot) {
-
-    const std::int64_t D = word_doc_mat.rows();
-    const std::int64_t W = word_doc_mat.columns();
-    const std::int64_t T = z.size();
+    const std::int64_t W,
+    i64vector_t & z,
+    dmatrix_t & dp,
+    partition & part) {
 
+    const std::int64_t T = static_cast<std::int64_t>(part.ztot.size());
     const double wbeta = static_cast<double>(W) * beta;
-    blaze::DynamicMatrix<double> wp(W, T);
-    wp = wp0;
-
-    blaze::DynamicVector<double> lhs(T), rhs(T), zprob(T), probs(T);
-
-    using row_iterator =
-        blaze::DynamicMatrix<double, blaze::rowMajor>::Iterator;
-
-    using vec_iterator =
-        blaze::DynamicVector<double>::Iterator;
-
-    // N (total instance count of words) == sum(word_doc_mat)
-    std::int64_t n = 0;
-
-    for(std::int64_t d = 0; d < D; ++d) {
-        for(std::int64_t w = 0; w < W; ++w) {
 
-            const auto wdf =
-                static_cast<std::int64_t>(word_doc_mat(d, w));
-
-            if(wdf < 1) { continue; }
-
-            for(std::int64_t f = 0; f < wdf; ++f) {
-
-                std::int64_t t = z[n];
-                --ztot[t];
-                --wp(w, t);
-                --dp(d, t);
-
-                row_iterator wp_beg = wp.begin(w);
-                row_iterator wp_end = wp.end(w);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
 
-                std::transform(wp_beg, wp_end, lhs.begin(),
-                    [&beta](const auto& val) {
-                        return val + beta;
-                });
+    auto local_word = part.local_words.begin();
+    for(std::int64_t d = part.first_doc; d < part.last_doc; ++d) {
 
-                row_iterator dp_beg = dp.begin(d);
-                row_iterator dp_end = dp.end(d);
+        const std::int64_t first = docs.doc_offsets[d];
+        const std::int64_t last = docs.doc_offsets[d + 1];
 
-                std::transform(dp_beg, dp_end, rhs.begin(),
-                    [&alpha](const auto& val) {
-                        return val + alpha;
-                });
+        for(std::int64_t n = first; n < last; ++n, ++local_word) {
 
-                vec_iterator ztot_beg = ztot.begin();
-                vec_iterator ztot_end = ztot.end();
+            const std::int64_t w = *local_word;
+            std::int64_t t = z[n];
 
-                std::transform(ztot_beg, ztot_end, zprob.begin(),
-                    [&wbeta](const auto& val) {
-                        return val + wbeta;
-                });
+            --part.ztot[t];
+            --part.wp(w, t);
+            --dp(d, t);
 
-                probs = (lhs * ( rhs / zprob ));
-
-                double max_prob = std::abs(rand() / (RAND_MAX + 1.0)) *
-                    (*std::max_element(probs.begin(), probs.end())) * 2.0;
-
-                t = static_cast<std::int64_t>(
-                    std::abs(rand() / (RAND_MAX + 1.0)) * T);
+            // cumulative (unnormalized) probabilities of all topics
+            double total = 0.0;
+            for(std::int64_t k = 0; k < T; ++k) {
+                total += (part.wp(w, k) + beta) * (dp(d, k) + alpha) /
+                    (part.ztot[k] + wbeta);
+                part.probs[k] = total;
+            }
 
-                while(max_prob > 1e-10) {
-                    max_prob -= probs[t];
-                    t = ((t+1) % T);
-                }
+            const double u = dist(part.rng) * total;
+            t = static_cast<std::int64_t>(
+                std::upper_bound(part.probs.begin(), part.probs.end(), u) -
+                part.probs.begin());
+            if(t == T) { t = T - 1; }
 
-                z[n] = t;
-                ++ztot[t];
-                ++wp(w, t);
-                ++dp(d, t);
-                ++n;
-            }
+            z[n] = t;
+            ++part.ztot[t];
+            ++part.wp(w, t);
+            ++dp(d, t);
         }
     }
 }
@@ -123,65 +87,133 @@ std::tuple<dmatrix_t, dmatrix_t> lda_trainer_impl::operator()(
 
     const std::int64_t D = word_doc_mat.rows();
     const std::int64_t W = word_doc_mat.columns();
-    const std::int64_t N =
-        static_cast<std::int64_t>(blaze::sum(word_doc_mat));
 
-    dmatrix_t wp(W, T); // this component stores information that
-                            // contains a distributed reduce and scatter
-                            //
-    dmatrix_t dp(D, T); // this component is distributed, but unchanging
-    i64vector_t z(N);
+    // collect the word instances only once, this way the sampler never
+    // visits zero entries of the word-document matrix
+    corpus docs;
+    docs.doc_offsets.reserve(D + 1);
+    docs.doc_offsets.push_back(0);
+    for(std::int64_t d = 0; d < D; ++d) {
+        for(std::int64_t w = 0; w < W; ++w) {
+            const auto wdf =
+                static_cast<std::int64_t>(word_doc_mat(d, w));
+            for(std::int64_t f = 0; f < wdf; ++f) {
+                docs.words.push_back(w);
+            }
+        }
+        docs.doc_offsets.push_back(
+            static_cast<std::int64_t>(docs.words.size()));
+    }
 
+    const std::int64_t N = static_cast<std::int64_t>(docs.words.size());
+
+    // split the documents into blocks of roughly the same number of word
+    // instances, one for each HPX worker thread
+    std::vector<partition> parts;
     {
-        // values near the mean are the most likely
-        // standard deviation affects the dispersion of generated values from the mean
-        {
-            std::random_device rd{};
-            std::default_random_engine eng{rd()};
-            std::uniform_int_distribution<> dist(0, T-1);
-            z = random(N, eng, dist);
+        const std::int64_t num_threads =
+            static_cast<std::int64_t>(hpx::get_os_thread_count());
+        const std::int64_t num_parts =
+            (std::max)(std::int64_t(1), (std::min)(D, num_threads));
+        const std::int64_t part_size =
+            (std::max)(std::int64_t(1), (N + num_parts - 1) / num_parts);
+
+        std::int64_t first_doc = 0;
+        for(std::int64_t d = 0; d < D; ++d) {
+            const std::int64_t size =
+                docs.doc_offsets[d + 1] - docs.doc_offsets[first_doc];
+            if(size >= part_size || d == D - 1) {
+                partition part;
+                part.first_doc = first_doc;
+                part.last_doc = d + 1;
+                parts.push_back(std::move(part));
+                first_doc = d + 1;
+            }
         }
+    }
+
+    // every partition gets its own random number engine, the seeds are
+    // derived from the global generator to honor set_seed()
+    for(partition & part : parts) {
+        part.rng.seed(util::rng_());
+    }
+
+    dmatrix_t wp(W, T, 0.0);
+    dmatrix_t dp(D, T, 0.0);
+    i64vector_t z(N);
 
-        blaze::DynamicVector<double, blaze::columnwise> word_index_pos;
-        blaze::DynamicVector<double, blaze::rowwise> doc_index_pos;
+    hpx::for_loop(hpx::execution::par, std::size_t(0), parts.size(),
+        [&](std::size_t p) {
+            partition & part = parts[p];
 
-        word_index_pos = blaze::sum<blaze::rowwise>(word_doc_mat);
-        doc_index_pos = blaze::sum<blaze::columnwise>(word_doc_mat);
+            std::int64_t const first = docs.doc_offsets[part.first_doc];
+            std::int64_t const last = docs.doc_offsets[part.last_doc];
 
-        // word and doc topic updates are parallel blocks
-        {
-            std::int64_t k = 0;
-            for(std::int64_t i = 0; i < W; ++i) {
-                for(std::int64_t j = 0; j < word_index_pos[i]; ++j) {
-                    wp(i, z[k]) += 1.0;
-                    ++k;
+            // assign random topics to the word instances
+            std::uniform_int_distribution<std::int64_t> dist(0, T - 1);
+            for(std::int64_t d = part.first_doc; d < part.last_doc; ++d) {
+                for(std::int64_t n = docs.doc_offsets[d];
+                    n < docs.doc_offsets[d + 1]; ++n) {
+                    z[n] = dist(part.rng);
+                    ++dp(d, z[n]);
                 }
             }
-        }
 
-        {
-            std::int64_t k = 0;
-            for(std::int64_t i = 0; i < D; ++i) {
-                for(std::int64_t j = 0; j < doc_index_pos[i]; ++j) {
-                    dp(i, z[k]) += 1.0;
-                    ++k;
+            // map the words of this partition onto the rows of its
+            // private word-topic counts
+            std::vector<std::int64_t> local_index(W, -1);
+            part.local_words.resize(last - first);
+            for(std::int64_t n = first; n < last; ++n) {
+                const std::int64_t w = docs.words[n];
+                if(local_index[w] < 0) {
+                    local_index[w] =
+                        static_cast<std::int64_t>(part.vocabulary.size());
+                    part.vocabulary.push_back(w);
                 }
+                part.local_words[n - first] = local_index[w];
             }
-        }
-    }
 
-    blaze::DynamicMatrix<double> wp0(W, T);
-    blaze::DynamicVector<double, blaze::rowVector> ztot0; //(T);
+            part.wp.resize(part.vocabulary.size(), T, false);
+            part.ztot.resize(T, false);
+            part.probs.resize(T, false);
+        });
 
+    for(std::int64_t n = 0; n < N; ++n) {
+        ++wp(docs.words[n], z[n]);
+    }
+
+    rowvector_t ztot;
     for(std::int64_t i = 0; i < iter; ++i) {
-        wp0 = wp;
-        ztot0 = blaze::eval( blaze::sum<blaze::columnwise>(wp0) );
-        // parallel portion
-        //
-        // z, wp, dp
-        //
-        gibbs(word_doc_mat, alpha, beta, z, wp, dp, ztot0);
-        wp = wp0 + (wp - wp0);
+        ztot = blaze::sum<blaze::columnwise>(wp);
+
+        // AD-LDA: every partition samples its documents based on a private
+        // copy of the global counts ...
+        hpx::for_loop(hpx::execution::par, std::size_t(0), parts.size(),
+            [&](std::size_t p) {
+                partition & part = parts[p];
+
+                for(std::size_t r = 0; r < part.vocabulary.size(); ++r) {
+                    blaze::row(part.wp, r) =
+                        blaze::row(wp, part.vocabulary[r]);
+                }
+                part.ztot = ztot;
+
+                gibbs(docs, alpha, beta, W, z, dp, part);
+
+                // turn the local counts into the changes made by this
+                // partition
+                for(std::size_t r = 0; r < part.vocabulary.size(); ++r) {
+                    blaze::row(part.wp, r) -=
+                        blaze::row(wp, part.vocabulary[r]);
+                }
+            });
+
+        // ... and the changes of all partitions are merged afterwards
+        for(partition & part : parts) {
+            for(std::size_t r = 0; r < part.vocabulary.size(); ++r) {
+                blaze::row(wp, part.vocabulary[r]) += blaze::row(part.wp, r);
+            }
+        }
     }
 
     return std::make_tuple(wp, dp);
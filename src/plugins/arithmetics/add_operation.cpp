@@ -25,6 +25,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         struct add_op
         {
+            // adding zeros gives zero, sparse operands stay sparse
+            static constexpr bool sparse_operands = true;
+
             template <typename T1, typename T2>
             auto operator()(T1 const& t1, T2 const& t2) const
             ->  decltype(t1 + t2)
@@ -19,6 +19,8 @@ PHYLANX_REGISTER_PLUGIN_FACTORY(cumprod_operation_plugin,
     phylanx::execution_tree::primitives::cumprod::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(div_operation_plugin,
     phylanx::execution_tree::primitives::div_operation::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(fused_elementwise_plugin,
+    phylanx::execution_tree::primitives::fused_elementwise::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(maximum_plugin,
     phylanx::execution_tree::primitives::maximum::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(minimum_plugin,
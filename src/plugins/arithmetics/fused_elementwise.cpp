@@ -0,0 +1,879 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/compile.hpp>
+#include <phylanx/execution_tree/compiler/primitive_name.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/arithmetics/fused_elementwise.hpp>
+
+#include <hpx/assert.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/util.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const fused_elementwise::match_data =
+    {
+        match_pattern_type{"__fused_elementwise",
+            std::vector<std::string>{"__fused_elementwise(_1, __2)"},
+            &create_fused_elementwise, &create_primitive<fused_elementwise>,
+            R"(
+            program, args
+            Args:
+
+                program (string): the element-wise operations to perform in
+                    postfix notation, integer tokens refer to the arguments
+                    (starting at 1)
+               *args (arg list): the arguments of the operations
+
+            Returns:
+
+            The result of evaluating the given program. This primitive is
+            generated by the compiler for trees of element-wise arithmetic,
+            comparison, and logical operations.)"
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        struct fused_operation
+        {
+            char const* token_;
+            char const* primitive_type_;
+            std::size_t arity_;
+        };
+
+        // this has to be in sync with fused_opcode
+        static fused_operation const fused_operations[] =
+        {
+            {"", "", 0},
+            {"+", "__add", 2}, {"-", "__sub", 2},
+            {"*", "__mul", 2}, {"/", "__div", 2},
+            {"<", "__lt", 2}, {"<=", "__le", 2},
+            {">", "__gt", 2}, {">=", "__ge", 2},
+            {"==", "__eq", 2}, {"!=", "__ne", 2},
+            {"&&", "__and", 2}, {"||", "__or", 2},
+            {"neg", "__minus", 1}, {"!", "__not", 1}
+        };
+
+        constexpr std::size_t num_fused_operations =
+            sizeof(fused_operations) / sizeof(fused_operations[0]);
+
+        inline fused_operation const& get_fused_operation(fused_opcode op)
+        {
+            return fused_operations[static_cast<std::size_t>(op)];
+        }
+
+        // the factory functions of the primitives implementing the operations
+        // are needed only if the fused evaluation can't be applied
+        std::vector<primitive_factory_function_type> init_fused_factories()
+        {
+            std::vector<primitive_factory_function_type> factories(
+                num_fused_operations, nullptr);
+
+            for (auto const& pattern : get_all_known_patterns())
+            {
+                for (std::size_t i = 1; i != num_fused_operations; ++i)
+                {
+                    if (pattern.data_.primitive_type_ ==
+                        fused_operations[i].primitive_type_)
+                    {
+                        factories[i] = pattern.data_.create_instance_;
+                    }
+                }
+            }
+            return factories;
+        }
+
+        primitive_factory_function_type get_fused_factory(fused_opcode op)
+        {
+            static std::vector<primitive_factory_function_type> factories =
+                init_fused_factories();
+            return factories[static_cast<std::size_t>(op)];
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // number of elements of each row evaluated at once
+        constexpr std::size_t fused_block_size = 256;
+
+        // minimal number of elements for which the evaluation is parallelized
+        constexpr std::size_t fused_min_parallel_size = 65536;
+
+        using fused_dimensions_type = ir::node_data<double>::dimensions_type;
+
+        enum class fused_kind : std::uint8_t
+        {
+            numeric_scalar,
+            boolean_scalar,
+            numeric_array,
+            boolean_array
+        };
+
+        // an argument of the fused expression, arrays are accessed as a
+        // sequence of rows (a vector has exactly one row)
+        struct fused_leaf
+        {
+            fused_kind kind_ = fused_kind::numeric_scalar;
+            double scalar_ = 0.0;
+            double const* data_ = nullptr;
+            std::uint8_t const* bool_data_ = nullptr;
+            std::size_t stride_ = 0;
+        };
+
+        // an element of the evaluation stack, either a block of values or
+        // a scalar
+        struct fused_value
+        {
+            double const* data_;
+            double scalar_;
+        };
+
+        template <typename T>
+        bool extract_fused_array(ir::node_data<T> const& nd,
+            std::size_t& ndim, fused_dimensions_type& dims, T const*& data,
+            std::size_t& stride)
+        {
+            std::size_t nd_ndim = nd.num_dimensions();
+            switch (nd_ndim)
+            {
+            case 1:
+                {
+                    auto v = nd.vector();
+                    data = v.data();
+                    stride = v.size();
+                }
+                break;
+
+            case 2:
+                {
+                    auto m = nd.matrix();
+                    data = m.data();
+                    stride = m.spacing();
+                }
+                break;
+
+            case 3:
+                {
+                    auto t = nd.tensor();
+                    data = t.data();
+                    stride = t.spacing();
+                }
+                break;
+
+            default:
+                return false;
+            }
+
+            // all arrays have to have the same shape, no broadcasting is
+            // performed
+            if (ndim == 0)
+            {
+                ndim = nd_ndim;
+                dims = nd.dimensions();
+                return true;
+            }
+            return ndim == nd_ndim && dims == nd.dimensions();
+        }
+
+        bool extract_fused_leaf(primitive_argument_type const& arg,
+            fused_leaf& leaf, std::size_t& ndim, fused_dimensions_type& dims)
+        {
+            if (arg.has_annotation())
+            {
+                return false;
+            }
+
+            if (auto const* d =
+                    util::get_if<ir::node_data<double>>(&arg.variant()))
+            {
+                if (d->num_dimensions() == 0)
+                {
+                    leaf.kind_ = fused_kind::numeric_scalar;
+                    leaf.scalar_ = d->scalar();
+                    return true;
+                }
+                leaf.kind_ = fused_kind::numeric_array;
+                return extract_fused_array(
+                    *d, ndim, dims, leaf.data_, leaf.stride_);
+            }
+
+            if (auto const* b =
+                    util::get_if<ir::node_data<std::uint8_t>>(&arg.variant()))
+            {
+                if (b->num_dimensions() == 0)
+                {
+                    leaf.kind_ = fused_kind::boolean_scalar;
+                    leaf.scalar_ = b->scalar() != 0 ? 1.0 : 0.0;
+                    return true;
+                }
+                leaf.kind_ = fused_kind::boolean_array;
+                return extract_fused_array(
+                    *b, ndim, dims, leaf.bool_data_, leaf.stride_);
+            }
+
+            // integer scalars are converted to double by the arithmetic
+            // operations anyways, integer arrays are not handled
+            if (auto const* i =
+                    util::get_if<ir::node_data<std::int64_t>>(&arg.variant()))
+            {
+                if (i->num_dimensions() == 0)
+                {
+                    leaf.kind_ = fused_kind::numeric_scalar;
+                    leaf.scalar_ = double(i->scalar());
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // verify that the fused evaluation produces the same result as the
+        // separate primitives would, return the kind of the result
+        bool check_fused_program(std::vector<fused_instruction> const& program,
+            std::vector<fused_leaf> const& leaves, fused_kind& result)
+        {
+            std::vector<fused_kind> stack;
+            for (auto const& instr : program)
+            {
+                switch (instr.opcode_)
+                {
+                case fused_opcode::operand:
+                    stack.push_back(leaves[instr.operand_].kind_);
+                    break;
+
+                case fused_opcode::negate:
+                    if (stack.back() != fused_kind::numeric_array)
+                    {
+                        return false;
+                    }
+                    break;
+
+                case fused_opcode::logical_not:
+                    if (stack.back() != fused_kind::boolean_array)
+                    {
+                        return false;
+                    }
+                    break;
+
+                case fused_opcode::logical_and: HPX_FALLTHROUGH;
+                case fused_opcode::logical_or:
+                    {
+                        fused_kind rhs = stack.back();
+                        stack.pop_back();
+                        fused_kind lhs = stack.back();
+
+                        if ((lhs != fused_kind::boolean_array &&
+                                lhs != fused_kind::boolean_scalar) ||
+                            (rhs != fused_kind::boolean_array &&
+                                rhs != fused_kind::boolean_scalar) ||
+                            (lhs != fused_kind::boolean_array &&
+                                rhs != fused_kind::boolean_array))
+                        {
+                            return false;
+                        }
+                        stack.back() = fused_kind::boolean_array;
+                    }
+                    break;
+
+                default:
+                    {
+                        // arithmetic operations and comparisons
+                        fused_kind rhs = stack.back();
+                        stack.pop_back();
+                        fused_kind lhs = stack.back();
+
+                        if ((lhs != fused_kind::numeric_array &&
+                                lhs != fused_kind::numeric_scalar) ||
+                            (rhs != fused_kind::numeric_array &&
+                                rhs != fused_kind::numeric_scalar) ||
+                            (lhs != fused_kind::numeric_array &&
+                                rhs != fused_kind::numeric_array))
+                        {
+                            return false;
+                        }
+
+                        stack.back() = instr.opcode_ <= fused_opcode::div ?
+                            fused_kind::numeric_array :
+                            fused_kind::boolean_array;
+                    }
+                    break;
+                }
+            }
+
+            result = stack.back();
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename F>
+        void fused_apply(fused_value const& lhs, fused_value const& rhs,
+            double* out, std::size_t n, F&& f)
+        {
+            if (lhs.data_ != nullptr && rhs.data_ != nullptr)
+            {
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    out[i] = f(lhs.data_[i], rhs.data_[i]);
+                }
+            }
+            else if (lhs.data_ != nullptr)
+            {
+                double const r = rhs.scalar_;
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    out[i] = f(lhs.data_[i], r);
+                }
+            }
+            else
+            {
+                double const l = lhs.scalar_;
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    out[i] = f(l, rhs.data_[i]);
+                }
+            }
+        }
+
+        void fused_binary(fused_opcode op, fused_value const& lhs,
+            fused_value const& rhs, double* out, std::size_t n)
+        {
+            switch (op)
+            {
+            case fused_opcode::add:
+                fused_apply(lhs, rhs, out, n,
+                    [](double l, double r) { return l + r; });
+                break;
+
+            case fused_opcode::sub:
+                fused_apply(lhs, rhs, out, n,
+                    [](double l, double r) { return l - r; });
+                break;
+
+            case fused_opcode::mul:
+                fused_apply(lhs, rhs, out, n,
+                    [](double l, double r) { return l * r; });
+                break;
+
+            case fused_opcode::div:
+                fused_apply(lhs, rhs, out, n,
+                    [](double l, double r) { return l / r; });
+                break;
+
+            case fused_opcode::less:
+                fused_apply(lhs, rhs, out, n,
+                    [](double l, double r) { return l < r ? 1.0 : 0.0; });
+                break;
+
+            case fused_opcode::less_equal:
+                fused_apply(lhs, rhs, out, n,
+                    [](double l, double r) { return l <= r ? 1.0 : 0.0; });
+                break;
+
+            case fused_opcode::greater:
+                fused_apply(lhs, rhs, out, n,
+                    [](double l, double r) { return l > r ? 1.0 : 0.0; });
+                break;
+
+            case fused_opcode::greater_equal:
+                fused_apply(lhs, rhs, out, n,
+                    [](double l, double r) { return l >= r ? 1.0 : 0.0; });
+                break;
+
+            case fused_opcode::equal:
+                fused_apply(lhs, rhs, out, n,
+                    [](double l, double r) { return l == r ? 1.0 : 0.0; });
+                break;
+
+            case fused_opcode::not_equal:
+                fused_apply(lhs, rhs, out, n,
+                    [](double l, double r) { return l != r ? 1.0 : 0.0; });
+                break;
+
+            case fused_opcode::logical_and:
+                fused_apply(lhs, rhs, out, n, [](double l, double r) {
+                    return (l != 0.0 && r != 0.0) ? 1.0 : 0.0;
+                });
+                break;
+
+            case fused_opcode::logical_or:
+                fused_apply(lhs, rhs, out, n, [](double l, double r) {
+                    return (l != 0.0 || r != 0.0) ? 1.0 : 0.0;
+                });
+                break;
+
+            default:
+                HPX_ASSERT(false);
+                break;
+            }
+        }
+
+        // evaluate the program for the elements [col, col + n) of the given
+        // row, the scratch space holds one block for each level of the
+        // evaluation stack
+        double const* fused_evaluate_block(
+            std::vector<fused_instruction> const& program,
+            std::vector<fused_leaf> const& leaves, std::size_t row,
+            std::size_t col, std::size_t n, std::vector<fused_value>& stack,
+            double* scratch)
+        {
+            stack.clear();
+            for (auto const& instr : program)
+            {
+                switch (instr.opcode_)
+                {
+                case fused_opcode::operand:
+                    {
+                        fused_leaf const& leaf = leaves[instr.operand_];
+                        if (leaf.kind_ == fused_kind::numeric_array)
+                        {
+                            stack.push_back(fused_value{
+                                leaf.data_ + row * leaf.stride_ + col, 0.0});
+                        }
+                        else if (leaf.kind_ == fused_kind::boolean_array)
+                        {
+                            double* out =
+                                scratch + stack.size() * fused_block_size;
+                            std::uint8_t const* data =
+                                leaf.bool_data_ + row * leaf.stride_ + col;
+                            for (std::size_t i = 0; i != n; ++i)
+                            {
+                                out[i] = data[i] != 0 ? 1.0 : 0.0;
+                            }
+                            stack.push_back(fused_value{out, 0.0});
+                        }
+                        else
+                        {
+                            stack.push_back(fused_value{nullptr, leaf.scalar_});
+                        }
+                    }
+                    break;
+
+                case fused_opcode::negate:
+                    {
+                        fused_value& v = stack.back();
+                        double* out =
+                            scratch + (stack.size() - 1) * fused_block_size;
+                        for (std::size_t i = 0; i != n; ++i)
+                        {
+                            out[i] = -v.data_[i];
+                        }
+                        v.data_ = out;
+                    }
+                    break;
+
+                case fused_opcode::logical_not:
+                    {
+                        fused_value& v = stack.back();
+                        double* out =
+                            scratch + (stack.size() - 1) * fused_block_size;
+                        for (std::size_t i = 0; i != n; ++i)
+                        {
+                            out[i] = v.data_[i] == 0.0 ? 1.0 : 0.0;
+                        }
+                        v.data_ = out;
+                    }
+                    break;
+
+                default:
+                    {
+                        fused_value rhs = stack.back();
+                        stack.pop_back();
+
+                        fused_value& lhs = stack.back();
+                        double* out =
+                            scratch + (stack.size() - 1) * fused_block_size;
+
+                        fused_binary(instr.opcode_, lhs, rhs, out, n);
+                        lhs.data_ = out;
+                    }
+                    break;
+                }
+            }
+
+            return stack.back().data_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // create the result array and invoke f(data, stride, rows, columns)
+        template <typename T, typename F>
+        primitive_argument_type fused_result(
+            std::size_t ndim, fused_dimensions_type const& dims, F&& f)
+        {
+            switch (ndim)
+            {
+            case 1:
+                {
+                    blaze::DynamicVector<T> result(dims[0]);
+                    f(result.data(), result.size(), std::size_t(1), dims[0]);
+                    return primitive_argument_type{
+                        ir::node_data<T>{std::move(result)}};
+                }
+
+            case 2:
+                {
+                    blaze::DynamicMatrix<T> result(dims[0], dims[1]);
+                    f(result.data(), result.spacing(), dims[0], dims[1]);
+                    return primitive_argument_type{
+                        ir::node_data<T>{std::move(result)}};
+                }
+
+            case 3:
+                {
+                    blaze::DynamicTensor<T> result(dims[0], dims[1], dims[2]);
+                    f(result.data(), result.spacing(), dims[0] * dims[1],
+                        dims[2]);
+                    return primitive_argument_type{
+                        ir::node_data<T>{std::move(result)}};
+                }
+
+            default:
+                break;
+            }
+
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::execution_tree::primitives::detail::fused_result",
+                "unsupported number of dimensions");
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    fused_elementwise::fused_elementwise(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+    {
+        if (operands_.size() < 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "fused_elementwise::fused_elementwise",
+                generate_error_message(
+                    "the fused_elementwise primitive requires at least two "
+                    "operands"));
+        }
+
+        parse_program(extract_string_value(operands_[0], name_, codename_));
+        create_fallback();
+    }
+
+    // create the primitives implementing the separate operations once, those
+    // are invoked whenever the fused evaluation can't be applied
+    void fused_elementwise::create_fallback()
+    {
+        compiler::primitive_name_parts name_parts;
+        bool has_name_parts =
+            compiler::parse_primitive_name(name_, name_parts);
+
+        fallback_.resize(program_.size());
+        for (std::size_t i = 0; i != program_.size(); ++i)
+        {
+            detail::fused_opcode opcode = program_[i].opcode_;
+            if (opcode == detail::fused_opcode::operand)
+            {
+                continue;
+            }
+
+            detail::fused_operation const& op =
+                detail::get_fused_operation(opcode);
+
+            primitive_factory_function_type create_instance =
+                detail::get_fused_factory(opcode);
+            if (create_instance == nullptr)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "fused_elementwise::create_fallback",
+                    generate_error_message(
+                        std::string("couldn't find the primitive '") +
+                        op.primitive_type_ + "'"));
+            }
+
+            std::string name = op.primitive_type_;
+            if (has_name_parts)
+            {
+                name_parts.primitive = op.primitive_type_;
+                name = compiler::compose_primitive_name(name_parts);
+            }
+
+            fallback_[i] =
+                create_instance(primitive_arguments_type{}, name, codename_);
+        }
+    }
+
+    void fused_elementwise::parse_program(std::string const& program)
+    {
+        uses_.resize(operands_.size(), 0);
+
+        std::size_t depth = 0;
+        std::istringstream strm(program);
+        std::string token;
+        while (strm >> token)
+        {
+            detail::fused_instruction instr{detail::fused_opcode::operand, 0};
+
+            auto const* begin = std::begin(detail::fused_operations) + 1;
+            auto const* end = std::end(detail::fused_operations);
+            auto const* it = std::find_if(begin, end,
+                [&](detail::fused_operation const& op)
+                {
+                    return token == op.token_;
+                });
+
+            if (it != end)
+            {
+                instr.opcode_ = static_cast<detail::fused_opcode>(
+                    std::distance(std::begin(detail::fused_operations), it));
+                if (depth < it->arity_)
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "fused_elementwise::parse_program",
+                        generate_error_message(
+                            "missing arguments for operation '" + token +
+                            "' in program: " + program));
+                }
+                depth -= it->arity_ - 1;
+            }
+            else
+            {
+                std::size_t pos = 0;
+                try
+                {
+                    instr.operand_ = std::stoul(token, &pos);
+                }
+                catch (std::exception const&)
+                {
+                    pos = 0;
+                }
+
+                if (pos != token.size() || instr.operand_ == 0 ||
+                    instr.operand_ >= operands_.size())
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "fused_elementwise::parse_program",
+                        generate_error_message("invalid token '" + token +
+                            "' in program: " + program));
+                }
+
+                ++uses_[instr.operand_];
+                max_depth_ = (std::max)(max_depth_, ++depth);
+            }
+
+            program_.push_back(instr);
+        }
+
+        if (depth != 1)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "fused_elementwise::parse_program",
+                generate_error_message(
+                    "the given program does not produce exactly one "
+                    "result: " + program));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool fused_elementwise::evaluate_fused(
+        primitive_arguments_type const& ops,
+        primitive_argument_type& result) const
+    {
+        std::size_t ndim = 0;
+        detail::fused_dimensions_type dims{};
+
+        std::vector<detail::fused_leaf> leaves(ops.size());
+        for (std::size_t i = 1; i != ops.size(); ++i)
+        {
+            if (uses_[i] != 0 &&
+                !detail::extract_fused_leaf(ops[i], leaves[i], ndim, dims))
+            {
+                return false;
+            }
+        }
+
+        // scalar expressions are left to the separate primitives
+        detail::fused_kind kind;
+        if (ndim == 0 || !detail::check_fused_program(program_, leaves, kind))
+        {
+            return false;
+        }
+
+        auto evaluate = [&](auto* out, std::size_t out_stride,
+                            std::size_t rows, std::size_t columns)
+        {
+            std::size_t blocks_per_row =
+                (columns + detail::fused_block_size - 1) /
+                detail::fused_block_size;
+            std::size_t num_blocks = rows * blocks_per_row;
+
+            auto evaluate_blocks = [&](std::size_t first, std::size_t last)
+            {
+                std::vector<double> scratch(
+                    max_depth_ * detail::fused_block_size);
+                std::vector<detail::fused_value> stack;
+                stack.reserve(max_depth_);
+
+                for (std::size_t block = first; block != last; ++block)
+                {
+                    std::size_t row = block / blocks_per_row;
+                    std::size_t col =
+                        (block % blocks_per_row) * detail::fused_block_size;
+                    std::size_t n =
+                        (std::min)(detail::fused_block_size, columns - col);
+
+                    double const* values = detail::fused_evaluate_block(
+                        program_, leaves, row, col, n, stack, scratch.data());
+
+                    auto* dest = out + row * out_stride + col;
+                    for (std::size_t i = 0; i != n; ++i)
+                    {
+                        dest[i] = static_cast<
+                            typename std::decay<decltype(*dest)>::type>(
+                            values[i]);
+                    }
+                }
+            };
+
+            if (rows * columns < detail::fused_min_parallel_size)
+            {
+                evaluate_blocks(0, num_blocks);
+                return;
+            }
+
+            std::size_t num_tasks = (std::min)(num_blocks,
+                4 * std::size_t(hpx::get_os_thread_count()));
+
+            hpx::for_loop(hpx::execution::par, std::size_t(0), num_tasks,
+                [&](std::size_t task)
+                {
+                    evaluate_blocks(task * num_blocks / num_tasks,
+                        (task + 1) * num_blocks / num_tasks);
+                });
+        };
+
+        if (kind == detail::fused_kind::boolean_array)
+        {
+            result = detail::fused_result<std::uint8_t>(ndim, dims, evaluate);
+        }
+        else
+        {
+            result = detail::fused_result<double>(ndim, dims, evaluate);
+        }
+        return true;
+    }
+
+    // evaluate all operations separately using the corresponding primitives
+    hpx::future<primitive_argument_type> fused_elementwise::evaluate_generic(
+        primitive_arguments_type&& ops, eval_context ctx) const
+    {
+        std::vector<hpx::future<primitive_argument_type>> stack;
+        stack.reserve(max_depth_);
+
+        for (std::size_t i = 0; i != program_.size(); ++i)
+        {
+            detail::fused_instruction const& instr = program_[i];
+            if (instr.opcode_ == detail::fused_opcode::operand)
+            {
+                // arguments that are used more than once are passed by
+                // reference to avoid them being modified in place
+                if (uses_[instr.operand_] == 1)
+                {
+                    stack.push_back(
+                        hpx::make_ready_future(std::move(ops[instr.operand_])));
+                }
+                else
+                {
+                    stack.push_back(hpx::make_ready_future(extract_ref_value(
+                        ops[instr.operand_], name_, codename_)));
+                }
+                continue;
+            }
+
+            std::size_t arity =
+                detail::get_fused_operation(instr.opcode_).arity_;
+
+            std::vector<hpx::future<primitive_argument_type>> args(
+                std::make_move_iterator(stack.end() - arity),
+                std::make_move_iterator(stack.end()));
+            stack.erase(stack.end() - arity, stack.end());
+
+            stack.push_back(hpx::dataflow(hpx::launch::sync,
+                [p = fallback_[i], ctx](
+                    std::vector<hpx::future<primitive_argument_type>>&& args)
+                -> hpx::future<primitive_argument_type>
+                {
+                    // the operands are referenced by the primitive until its
+                    // evaluation has finished
+                    auto values = std::make_shared<primitive_arguments_type>();
+                    values->reserve(args.size());
+                    for (auto& arg : args)
+                    {
+                        values->push_back(arg.get());
+                    }
+
+                    return p->eval(*values, primitive_arguments_type{}, ctx)
+                        .then(hpx::launch::sync,
+                            [values](
+                                hpx::future<primitive_argument_type>&& f)
+                            {
+                                return f.get();
+                            });
+                },
+                std::move(args)));
+        }
+
+        return std::move(stack.back());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> fused_elementwise::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() != uses_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "fused_elementwise::eval",
+                generate_error_message(
+                    "the fused_elementwise primitive was invoked with an "
+                    "unexpected number of operands",
+                    std::move(ctx)));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync, hpx::unwrapping(
+            [this_ = std::move(this_), ctx](primitive_arguments_type&& ops)
+            ->  hpx::future<primitive_argument_type>
+            {
+                primitive_argument_type result;
+                if (this_->evaluate_fused(ops, result))
+                {
+                    return hpx::make_ready_future(std::move(result));
+                }
+                return this_->evaluate_generic(std::move(ops), ctx);
+            }),
+            detail::map_operands(
+                operands, functional::value_operand{}, args,
+                name_, codename_, ctx));
+    }
+}}}
@@ -152,16 +152,25 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         if (t == node_data_type_unknown)
         {
-            t = retain_argument_type_ ? extract_common_type(op) :
-                                        node_data_type_double;
+            // single precision arguments are never widened
+            t = extract_common_type(op);
+            if (!retain_argument_type_ && t != node_data_type_float32)
+            {
+                t = node_data_type_double;
+            }
         }
 
         switch (t)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return generic0d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32:
+            return generic0d(
+                extract_float32_value(std::move(op), name_, codename_));
+
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -179,16 +188,25 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         if (t == node_data_type_unknown)
         {
-            t = retain_argument_type_ ? extract_common_type(op) :
-                                        node_data_type_double;
+            // single precision arguments are never widened
+            t = extract_common_type(op);
+            if (!retain_argument_type_ && t != node_data_type_float32)
+            {
+                t = node_data_type_double;
+            }
         }
 
         switch (t)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return generic1d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32:
+            return generic1d(
+                extract_float32_value(std::move(op), name_, codename_));
+
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -206,16 +224,25 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         if (t == node_data_type_unknown)
         {
-            t = retain_argument_type_ ? extract_common_type(op) :
-                                        node_data_type_double;
+            // single precision arguments are never widened
+            t = extract_common_type(op);
+            if (!retain_argument_type_ && t != node_data_type_float32)
+            {
+                t = node_data_type_double;
+            }
         }
 
         switch (t)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return generic2d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32:
+            return generic2d(
+                extract_float32_value(std::move(op), name_, codename_));
+
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -233,16 +260,25 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         if (t == node_data_type_unknown)
         {
-            t = retain_argument_type_ ? extract_common_type(op) :
-                                        node_data_type_double;
+            // single precision arguments are never widened
+            t = extract_common_type(op);
+            if (!retain_argument_type_ && t != node_data_type_float32)
+            {
+                t = node_data_type_double;
+            }
         }
 
         switch (t)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return generic3d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32:
+            return generic3d(
+                extract_float32_value(std::move(op), name_, codename_));
+
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -0,0 +1,31 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+
+#include <phylanx/plugins/arithmetics/generic_operation.hpp>
+#include <phylanx/plugins/arithmetics/generic_operation_3d.hpp>
+#include <phylanx/plugins/arithmetics/generic_operation_3d_definitions.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    GENERIC_OPERATION_3D_INSTANTIATION(abs, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(floor, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(ceil, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(trunc, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(round, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(conj, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(real, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(imag, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(sqrt, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(invsqrt, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(cbrt, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(invcbrt, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(exp, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(exp2, float);
+    GENERIC_OPERATION_3D_INSTANTIATION(exp10, float);
+}}}
+
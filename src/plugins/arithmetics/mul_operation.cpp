@@ -28,6 +28,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
         // scalars need 't1 * t2', vectors and matrices use blaze::map()
         struct mul_op
         {
+            // multiplying by zero gives zero, sparse operands stay sparse
+            static constexpr bool sparse_operands = true;
+
             ///////////////////////////////////////////////////////////////////
             template <typename T1, typename T2>
             typename std::enable_if<
@@ -50,6 +53,20 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 return blaze::map(t1, t2, util::detail::mulndnd_simd{});
             }
 
+            // blaze::map() is not available for sparse vectors, but the
+            // product of two (column) vectors is computed element-wise
+            template <typename T1, typename T2>
+            typename std::enable_if<
+                traits::is_vector<T1>::value && traits::is_vector<T2>::value &&
+                    (blaze::IsSparseVector<T1>::value ||
+                        blaze::IsSparseVector<T2>::value),
+                decltype(std::declval<T1>() * std::declval<T2>())
+            >::type
+            operator()(T1 const& t1, T2 const& t2) const
+            {
+                return t1 * t2;
+            }
+
             template <typename T1, typename T2>
             typename std::enable_if<
                 traits::is_matrix<T1>::value && traits::is_matrix<T2>::value,
@@ -160,6 +177,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
     template primitive_argument_type
     mul_operation::handle_numeric_operands_helper<double>(
         primitive_arguments_type&& ops) const;
+    template primitive_argument_type
+    mul_operation::handle_numeric_operands_helper<float>(
+        primitive_arguments_type&& ops) const;
+    template primitive_argument_type
+    mul_operation::handle_numeric_operands_helper<std::int32_t>(
+        primitive_arguments_type&& ops) const;
 
     template <typename T>
     primitive_argument_type mul_operation::handle_numeric_operands_helper(
@@ -178,4 +201,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
     template primitive_argument_type
     mul_operation::handle_numeric_operands_helper<double>(
         primitive_argument_type&& op1, primitive_argument_type&& op2) const;
+    template primitive_argument_type
+    mul_operation::handle_numeric_operands_helper<float>(
+        primitive_argument_type&& op1, primitive_argument_type&& op2) const;
+    template primitive_argument_type
+    mul_operation::handle_numeric_operands_helper<std::int32_t>(
+        primitive_argument_type&& op1, primitive_argument_type&& op2) const;
 }}}
@@ -21,8 +21,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         struct sub_op
         {
+            // subtracting zeros gives zero, sparse operands stay sparse
+            static constexpr bool sparse_operands = true;
+
             template <typename T1, typename T2>
             auto operator()(T1 const& t1, T2 const& t2) const
+            ->  decltype(t1 - t2)
             {
                 return t1 - t2;
             }
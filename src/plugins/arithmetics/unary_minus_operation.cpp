@@ -129,11 +129,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return neg0d(extract_value_scalar<std::uint8_t>(
                 std::move(op), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return neg0d(extract_value_scalar<std::int64_t>(
                 std::move(op), name_, codename_));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return neg0d(
                 extract_value_scalar<double>(std::move(op), name_, codename_));
@@ -163,11 +165,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return neg1d(extract_value_vector<std::uint8_t>(
                 std::move(op), sizes[0], name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return neg1d(extract_value_vector<std::int64_t>(
                 std::move(op), sizes[0], name_, codename_));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return neg1d(extract_value_vector<double>(
                 std::move(op), sizes[0], name_, codename_));
@@ -197,11 +201,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return neg2d(extract_value_matrix<std::uint8_t>(
                 std::move(op), sizes[0], sizes[1], name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return neg2d(extract_value_matrix<std::int64_t>(
                 std::move(op), sizes[0], sizes[1], name_, codename_));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return neg2d(extract_value_matrix<double>(
                 std::move(op), sizes[0], sizes[1], name_, codename_));
@@ -231,11 +237,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return neg3d(extract_value_matrix<std::uint8_t>(
                 std::move(op), sizes[0], sizes[1], name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return neg3d(extract_value_matrix<std::int64_t>(
                 std::move(op), sizes[0], sizes[1], name_, codename_));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return neg3d(extract_value_matrix<double>(
                 std::move(op), sizes[0], sizes[1], name_, codename_));
@@ -469,10 +469,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 return that_.where_elements<std::uint8_t>(
                     std::move(op), std::move(lhs_), std::move(rhs_));
 
+            case node_data_type_int32: HPX_FALLTHROUGH;
             case node_data_type_int64:
                 return that_.where_elements<std::int64_t>(
                     std::move(op), std::move(lhs_), std::move(rhs_));
 
+            case node_data_type_float32: HPX_FALLTHROUGH;
             case node_data_type_double:
                 return that_.where_elements<double>(
                     std::move(op), std::move(lhs_), std::move(rhs_));
@@ -0,0 +1,387 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/conv_gemm.hpp>
+#include <phylanx/plugins/common/export_definitions.hpp>
+
+#include <hpx/include/parallel_for_loop.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace common {
+
+    namespace detail
+    {
+        // Return the position in a dimension of the given size that is
+        // touched by the filter tap 'tap' when computing the output element
+        // 'pos', or -1 if the tap falls into the (zero-)padding.
+        inline std::int64_t tap_position(std::int64_t pos, std::int64_t tap,
+            std::int64_t pad, std::int64_t stride, std::int64_t dilation,
+            std::int64_t size)
+        {
+            std::int64_t result = pos * stride - pad + tap * dilation;
+            return (result >= 0 && result < size) ? result : -1;
+        }
+
+        // The output channels are split into blocks of this size, the
+        // blocks are computed concurrently (in addition to the batch items).
+        constexpr std::size_t out_channel_block_size = 16;
+
+        // Invoke f(first, count) concurrently for all blocks of output
+        // channels.
+        template <typename F>
+        void for_each_out_channel_block(std::size_t out_channels, F&& f)
+        {
+            std::size_t const blocks =
+                (out_channels + out_channel_block_size - 1) /
+                out_channel_block_size;
+
+            hpx::for_loop(hpx::execution::par, std::size_t(0), blocks,
+                [&](std::size_t block)
+                {
+                    std::size_t const first = block * out_channel_block_size;
+                    f(first,
+                        (std::min)(
+                            out_channel_block_size, out_channels - first));
+                });
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    blaze::DynamicArray<4UL, double> conv2d_gemm(
+        ir::node_data<double> const& arg, ir::node_data<double> const& kernel,
+        std::size_t res_height, std::size_t res_width,
+        conv_geometry const& geometry)
+    {
+        auto x = arg.quatern();
+        auto k = kernel.quatern();
+
+        std::size_t batch = x.quats();
+        auto in_height = static_cast<std::int64_t>(x.pages());
+        auto in_width = static_cast<std::int64_t>(x.rows());
+        std::size_t in_channels = x.columns();
+        std::size_t filter_height = k.quats();
+        std::size_t filter_width = k.pages();
+        std::size_t out_channels = k.columns();
+
+        std::size_t patch_size = filter_height * filter_width * in_channels;
+
+        // flatten the kernel into a (patch_size x out_channels) matrix
+        blaze::DynamicMatrix<double> kmat(patch_size, out_channels);
+        for (std::size_t p = 0; p != filter_height; ++p)
+        {
+            for (std::size_t q = 0; q != filter_width; ++q)
+            {
+                std::size_t base = (p * filter_width + q) * in_channels;
+                for (std::size_t c = 0; c != in_channels; ++c)
+                {
+                    for (std::size_t o = 0; o != out_channels; ++o)
+                    {
+                        kmat(base + c, o) = k(p, q, c, o);
+                    }
+                }
+            }
+        }
+
+        blaze::DynamicArray<4UL, double> result(
+            batch, res_height, res_width, out_channels);
+
+        hpx::for_loop(hpx::execution::par, std::size_t(0), batch,
+            [&](std::size_t l)
+            {
+                // each row of 'patches' holds the input elements seen by the
+                // filter for one output element
+                blaze::DynamicMatrix<double> patches(
+                    res_height * res_width, patch_size, 0.0);
+
+                for (std::size_t i = 0; i != res_height; ++i)
+                {
+                    for (std::size_t p = 0; p != filter_height; ++p)
+                    {
+                        std::int64_t y = detail::tap_position(i, p,
+                            geometry.pad_top, geometry.stride_height,
+                            geometry.dilation_height, in_height);
+                        if (y < 0)
+                            continue;
+
+                        for (std::size_t j = 0; j != res_width; ++j)
+                        {
+                            std::size_t row = i * res_width + j;
+                            for (std::size_t q = 0; q != filter_width; ++q)
+                            {
+                                std::int64_t z = detail::tap_position(j, q,
+                                    geometry.pad_left, geometry.stride_width,
+                                    geometry.dilation_width, in_width);
+                                if (z < 0)
+                                    continue;
+
+                                std::size_t base =
+                                    (p * filter_width + q) * in_channels;
+                                for (std::size_t c = 0; c != in_channels; ++c)
+                                {
+                                    patches(row, base + c) = x(l, y, z, c);
+                                }
+                            }
+                        }
+                    }
+                }
+
+                detail::for_each_out_channel_block(out_channels,
+                    [&](std::size_t first, std::size_t count)
+                    {
+                        blaze::DynamicMatrix<double> r = patches *
+                            blaze::submatrix(kmat, 0, first, patch_size, count);
+
+                        for (std::size_t i = 0; i != res_height; ++i)
+                        {
+                            for (std::size_t j = 0; j != res_width; ++j)
+                            {
+                                std::size_t row = i * res_width + j;
+                                for (std::size_t o = 0; o != count; ++o)
+                                {
+                                    result(l, i, j, first + o) = r(row, o);
+                                }
+                            }
+                        }
+                    });
+            });
+
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    blaze::DynamicArray<4UL, double> conv2d_transpose_gemm(
+        ir::node_data<double> const& arg, ir::node_data<double> const& kernel,
+        std::size_t res_height, std::size_t res_width,
+        conv_geometry const& geometry)
+    {
+        auto x = arg.quatern();
+        auto k = kernel.quatern();
+
+        std::size_t batch = x.quats();
+        std::size_t in_height = x.pages();
+        std::size_t in_width = x.rows();
+        std::size_t in_channels = x.columns();
+        std::size_t filter_height = k.quats();
+        std::size_t filter_width = k.pages();
+        std::size_t out_channels = k.rows();
+
+        // flatten the kernel into a (in_channels x patch_size) matrix
+        std::size_t patch_size = filter_height * filter_width * out_channels;
+
+        blaze::DynamicMatrix<double> kmat(in_channels, patch_size);
+        for (std::size_t p = 0; p != filter_height; ++p)
+        {
+            for (std::size_t q = 0; q != filter_width; ++q)
+            {
+                std::size_t base = (p * filter_width + q) * out_channels;
+                for (std::size_t o = 0; o != out_channels; ++o)
+                {
+                    for (std::size_t c = 0; c != in_channels; ++c)
+                    {
+                        kmat(c, base + o) = k(p, q, o, c);
+                    }
+                }
+            }
+        }
+
+        blaze::DynamicArray<4UL, double> result(blaze::init_from_value, 0.0,
+            batch, res_height, res_width, out_channels);
+
+        hpx::for_loop(hpx::execution::par, std::size_t(0), batch,
+            [&](std::size_t l)
+            {
+                blaze::DynamicMatrix<double> input(
+                    in_height * in_width, in_channels);
+                for (std::size_t i = 0; i != in_height; ++i)
+                {
+                    for (std::size_t j = 0; j != in_width; ++j)
+                    {
+                        std::size_t row = i * in_width + j;
+                        for (std::size_t c = 0; c != in_channels; ++c)
+                        {
+                            input(row, c) = x(l, i, j, c);
+                        }
+                    }
+                }
+
+                // each row of 'patches' holds the contributions of one input
+                // element to all output elements it is scattered to (col2im)
+                blaze::DynamicMatrix<double> patches = input * kmat;
+
+                for (std::size_t i = 0; i != in_height; ++i)
+                {
+                    for (std::size_t p = 0; p != filter_height; ++p)
+                    {
+                        std::int64_t y = detail::tap_position(i, p,
+                            geometry.pad_top, geometry.stride_height,
+                            geometry.dilation_height, res_height);
+                        if (y < 0)
+                            continue;
+
+                        for (std::size_t j = 0; j != in_width; ++j)
+                        {
+                            std::size_t row = i * in_width + j;
+                            for (std::size_t q = 0; q != filter_width; ++q)
+                            {
+                                std::int64_t z = detail::tap_position(j, q,
+                                    geometry.pad_left, geometry.stride_width,
+                                    geometry.dilation_width, res_width);
+                                if (z < 0)
+                                    continue;
+
+                                std::size_t base =
+                                    (p * filter_width + q) * out_channels;
+                                for (std::size_t o = 0; o != out_channels; ++o)
+                                {
+                                    result(l, y, z, o) +=
+                                        patches(row, base + o);
+                                }
+                            }
+                        }
+                    }
+                }
+            });
+
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    blaze::DynamicTensor<double> conv1d_gemm(ir::node_data<double> const& arg,
+        ir::node_data<double> const& kernel, std::size_t res_length,
+        std::int64_t pad_left, std::int64_t strides,
+        std::int64_t dilation_rate)
+    {
+        auto a = arg.tensor();
+        auto k = kernel.tensor();
+
+        std::size_t batch = a.pages();
+        auto data_length = static_cast<std::int64_t>(a.rows());
+        std::size_t in_channels = a.columns();
+        std::size_t filter_length = k.pages();
+        std::size_t out_channels = k.columns();
+
+        std::size_t patch_size = filter_length * in_channels;
+
+        // the kernel is already laid out as a (patch_size x out_channels)
+        // matrix, only the padding of the tensor has to be removed
+        blaze::DynamicMatrix<double> kmat(patch_size, out_channels);
+        for (std::size_t p = 0; p != filter_length; ++p)
+        {
+            blaze::submatrix(kmat, p * in_channels, 0, in_channels,
+                out_channels) = blaze::pageslice(k, p);
+        }
+
+        blaze::DynamicTensor<double> result(batch, res_length, out_channels);
+
+        hpx::for_loop(hpx::execution::par, std::size_t(0), batch,
+            [&](std::size_t l)
+            {
+                blaze::DynamicMatrix<double> patches(
+                    res_length, patch_size, 0.0);
+
+                auto aslice = blaze::pageslice(a, l);
+                for (std::size_t i = 0; i != res_length; ++i)
+                {
+                    for (std::size_t p = 0; p != filter_length; ++p)
+                    {
+                        std::int64_t y = detail::tap_position(i, p, pad_left,
+                            strides, dilation_rate, data_length);
+                        if (y < 0)
+                            continue;
+
+                        blaze::subvector(blaze::row(patches, i),
+                            p * in_channels, in_channels) =
+                            blaze::row(aslice, y);
+                    }
+                }
+
+                detail::for_each_out_channel_block(out_channels,
+                    [&](std::size_t first, std::size_t count)
+                    {
+                        blaze::submatrix(blaze::pageslice(result, l), 0, first,
+                            res_length, count) = patches *
+                            blaze::submatrix(kmat, 0, first, patch_size, count);
+                    });
+            });
+
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    blaze::DynamicTensor<double> separable_conv1d_gemm(
+        ir::node_data<double> const& arg,
+        ir::node_data<double> const& depth_kernel,
+        ir::node_data<double> const& point_kernel, std::size_t res_length,
+        std::int64_t pad_left, std::int64_t strides,
+        std::int64_t dilation_rate)
+    {
+        auto a = arg.tensor();
+        auto dk = depth_kernel.tensor();
+        auto pk = point_kernel.tensor();
+
+        std::size_t batch = a.pages();
+        auto data_length = static_cast<std::int64_t>(a.rows());
+        std::size_t in_channels = a.columns();
+        std::size_t filter_length = dk.pages();
+        std::size_t depth_multiplier = dk.columns();
+        std::size_t pk_out_channels = pk.columns();
+
+        // depthwise step: every input channel is convolved separately, the
+        // rows of 'depthwise' correspond to (batch, position) pairs
+        blaze::DynamicMatrix<double> depthwise(
+            batch * res_length, in_channels * depth_multiplier);
+
+        hpx::for_loop(hpx::execution::par, std::size_t(0), in_channels,
+            [&](std::size_t c)
+            {
+                auto column = blaze::columnslice(a, c);    // batch x length
+
+                blaze::DynamicMatrix<double> patches(
+                    batch * res_length, filter_length, 0.0);
+                for (std::size_t l = 0; l != batch; ++l)
+                {
+                    for (std::size_t i = 0; i != res_length; ++i)
+                    {
+                        std::size_t row = l * res_length + i;
+                        for (std::size_t p = 0; p != filter_length; ++p)
+                        {
+                            std::int64_t y = detail::tap_position(i, p,
+                                pad_left, strides, dilation_rate, data_length);
+                            if (y >= 0)
+                                patches(row, p) = column(l, y);
+                        }
+                    }
+                }
+
+                // rowslice(dk, c) is (depth_multiplier x filter_length)
+                blaze::submatrix(depthwise, 0, c * depth_multiplier,
+                    batch * res_length, depth_multiplier) =
+                    patches * blaze::trans(blaze::rowslice(dk, c));
+            });
+
+        // pointwise step: a single matrix multiplication
+        blaze::DynamicMatrix<double> pointwise =
+            depthwise * blaze::pageslice(pk, 0);
+
+        blaze::DynamicTensor<double> result(
+            batch, res_length, pk_out_channels);
+        for (std::size_t l = 0; l != batch; ++l)
+        {
+            blaze::pageslice(result, l) = blaze::submatrix(
+                pointwise, l * res_length, 0, res_length, pk_out_channels);
+        }
+
+        return result;
+    }
+}}
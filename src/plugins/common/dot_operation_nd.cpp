@@ -36,12 +36,19 @@ namespace phylanx { namespace common
                 extract_boolean_value(std::move(rhs), name, codename),
                 name, codename);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dot0d(
                 extract_integer_value(std::move(lhs), name, codename),
                 extract_integer_value(std::move(rhs), name, codename),
                 name, codename);
 
+        case node_data_type_float32:
+            return dot0d(
+                extract_float32_value(std::move(lhs), name, codename),
+                extract_float32_value(std::move(rhs), name, codename),
+                name, codename);
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot0d(
@@ -75,12 +82,19 @@ namespace phylanx { namespace common
                 extract_boolean_value(std::move(rhs), name, codename),
                 name, codename);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dot1d(
                 extract_integer_value(std::move(lhs), name, codename),
                 extract_integer_value(std::move(rhs), name, codename),
                 name, codename);
 
+        case node_data_type_float32:
+            return dot1d(
+                extract_float32_value(std::move(lhs), name, codename),
+                extract_float32_value(std::move(rhs), name, codename),
+                name, codename);
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot1d(
@@ -114,12 +128,19 @@ namespace phylanx { namespace common
                 extract_boolean_value(std::move(rhs), name, codename),
                 name, codename);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dot2d(
                 extract_integer_value(std::move(lhs), name, codename),
                 extract_integer_value(std::move(rhs), name, codename),
                 name, codename);
 
+        case node_data_type_float32:
+            return dot2d(
+                extract_float32_value(std::move(lhs), name, codename),
+                extract_float32_value(std::move(rhs), name, codename),
+                name, codename);
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot2d(
@@ -153,12 +174,19 @@ namespace phylanx { namespace common
                 extract_boolean_value(std::move(rhs), name, codename),
                 name, codename);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dot3d(
                 extract_integer_value(std::move(lhs), name, codename),
                 extract_integer_value(std::move(rhs), name, codename),
                 name, codename);
 
+        case node_data_type_float32:
+            return dot3d(
+                extract_float32_value(std::move(lhs), name, codename),
+                extract_float32_value(std::move(rhs), name, codename),
+                name, codename);
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot3d(
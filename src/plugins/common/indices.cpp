@@ -74,11 +74,13 @@ namespace phylanx { namespace common {
             *shape.begin(), name, codename);
         switch (dtype)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return indices1d_helper<std::int64_t>(size);
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return indices1d_helper<double>(size);
 
@@ -143,11 +145,13 @@ namespace phylanx { namespace common {
 
         switch (dtype)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return indices2d_helper<std::int64_t>(rows, columns);
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return indices2d_helper<double>(rows, columns);
 
@@ -220,11 +224,13 @@ namespace phylanx { namespace common {
 
         switch (dtype)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return indices3d_helper<std::int64_t>(pages, rows, columns);
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return indices3d_helper<double>(pages, rows, columns);
 
@@ -310,11 +316,13 @@ namespace phylanx { namespace common {
 
         switch (dtype)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return indices4d_helper<std::int64_t>(quats, pages, rows, columns);
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return indices4d_helper<double>(quats, pages, rows, columns);
 
@@ -418,11 +426,13 @@ namespace phylanx { namespace common {
             *shape.begin(), name, codename);
         switch (dtype)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return sparse_indices1d_helper<std::int64_t>(size);
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return sparse_indices1d_helper<double>(size);
 
@@ -485,11 +495,13 @@ namespace phylanx { namespace common {
 
         switch (dtype)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return sparse_indices2d_helper<std::int64_t>(rows, columns);
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return sparse_indices2d_helper<double>(rows, columns);
 
@@ -559,11 +571,13 @@ namespace phylanx { namespace common {
 
         switch (dtype)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return sparse_indices3d_helper<std::int64_t>(pages, rows, columns);
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return sparse_indices3d_helper<double>(pages, rows, columns);
 
@@ -646,12 +660,14 @@ namespace phylanx { namespace common {
 
         switch (dtype)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return sparse_indices4d_helper<std::int64_t>(
                 quats, pages, rows, columns);
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return sparse_indices4d_helper<double>(quats, pages, rows, columns);
 
@@ -0,0 +1,159 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/export_definitions.hpp>
+#include <phylanx/plugins/common/kmeans_operations.hpp>
+
+#include <hpx/include/parallel_for_loop.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace common {
+
+    namespace detail
+    {
+        std::size_t kmeans_num_blocks(std::size_t num_points)
+        {
+            return (num_points + kmeans_block_size - 1) / kmeans_block_size;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    blaze::DynamicVector<std::size_t> kmeans_closest_centroids(
+        kmeans_points_type const& points,
+        blaze::DynamicMatrix<double> const& centroids)
+    {
+        std::size_t num_points = points.rows();
+        std::size_t num_features = points.columns();
+        std::size_t num_centroids = centroids.rows();
+
+        blaze::DynamicVector<double> centroid_norms(num_centroids);
+        for (std::size_t j = 0; j != num_centroids; ++j)
+        {
+            centroid_norms[j] = blaze::sqrNorm(blaze::row(centroids, j));
+        }
+
+        blaze::DynamicVector<std::size_t> result(num_points);
+        hpx::for_loop(hpx::execution::par, std::size_t(0),
+            detail::kmeans_num_blocks(num_points), [&](std::size_t block)
+            {
+                std::size_t begin = block * kmeans_block_size;
+                std::size_t size =
+                    (std::min)(kmeans_block_size, num_points - begin);
+
+                blaze::DynamicMatrix<double> products =
+                    blaze::submatrix(points, begin, 0, size, num_features) *
+                    blaze::trans(centroids);
+
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    std::size_t closest = 0;
+                    double min_distance =
+                        centroid_norms[0] - 2.0 * products(i, 0);
+                    for (std::size_t j = 1; j != num_centroids; ++j)
+                    {
+                        double distance =
+                            centroid_norms[j] - 2.0 * products(i, j);
+                        if (distance < min_distance)
+                        {
+                            min_distance = distance;
+                            closest = j;
+                        }
+                    }
+                    result[begin + i] = closest;
+                }
+            });
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    blaze::DynamicMatrix<double> kmeans_accumulate(
+        kmeans_points_type const& points,
+        blaze::DynamicVector<std::size_t> const& closest,
+        std::size_t num_centroids)
+    {
+        std::size_t num_points = points.rows();
+        std::size_t num_features = points.columns();
+        std::size_t num_blocks = detail::kmeans_num_blocks(num_points);
+
+        // accumulate partial sums for each block of points, the partial sums
+        // are combined in a fixed order to make the result deterministic
+        std::vector<blaze::DynamicMatrix<double>> sums(num_blocks);
+
+        hpx::for_loop(hpx::execution::par, std::size_t(0), num_blocks,
+            [&](std::size_t block)
+            {
+                std::size_t begin = block * kmeans_block_size;
+                std::size_t end =
+                    (std::min)(begin + kmeans_block_size, num_points);
+
+                auto& sum = sums[block];
+                sum.resize(num_centroids, num_features + 1, false);
+                sum = 0.0;
+
+                for (std::size_t i = begin; i != end; ++i)
+                {
+                    blaze::subvector(blaze::row(sum, closest[i]), 0,
+                        num_features) += blaze::row(points, i);
+                    sum(closest[i], num_features) += 1.0;
+                }
+            });
+
+        blaze::DynamicMatrix<double> result(
+            num_centroids, num_features + 1, 0.0);
+        for (auto const& sum : sums)
+        {
+            result += sum;
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    blaze::DynamicMatrix<double> kmeans_move_centroids(
+        blaze::DynamicMatrix<double> const& sums,
+        blaze::DynamicMatrix<double> const& centroids)
+    {
+        std::size_t num_centroids = centroids.rows();
+        std::size_t num_features = centroids.columns();
+
+        blaze::DynamicMatrix<double> result(num_centroids, num_features);
+        for (std::size_t k = 0; k != num_centroids; ++k)
+        {
+            double count = sums(k, num_features);
+            if (count != 0.0)
+            {
+                blaze::row(result, k) =
+                    blaze::subvector(blaze::row(sums, k), 0, num_features) /
+                    count;
+            }
+            else
+            {
+                blaze::row(result, k) = blaze::row(centroids, k);
+            }
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    double kmeans_max_shift(blaze::DynamicMatrix<double> const& centroids,
+        blaze::DynamicMatrix<double> const& moved)
+    {
+        double shift = 0.0;
+        for (std::size_t k = 0; k != centroids.rows(); ++k)
+        {
+            shift = (std::max)(shift,
+                blaze::sqrNorm(
+                    blaze::row(moved, k) - blaze::row(centroids, k)));
+        }
+        return shift;
+    }
+}}
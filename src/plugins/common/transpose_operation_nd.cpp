@@ -59,11 +59,13 @@ namespace phylanx { namespace common
             return transpose2d(
                 extract_boolean_value_strict(std::move(arg), name, codename));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return transpose2d(
                 extract_integer_value_strict(std::move(arg), name, codename));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose2d(
                 extract_numeric_value(std::move(arg), name, codename));
@@ -110,6 +112,7 @@ namespace phylanx { namespace common
                 extract_boolean_value_strict(std::move(arg), name, codename),
                 std::move(axes));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return transpose2d(
                 extract_integer_value_strict(std::move(arg), name, codename),
@@ -117,6 +120,7 @@ namespace phylanx { namespace common
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose2d(
                 extract_numeric_value(std::move(arg), name, codename),
@@ -210,11 +214,13 @@ namespace phylanx { namespace common
             return transpose3d(
                 extract_boolean_value_strict(std::move(arg), name, codename));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return transpose3d(
                 extract_integer_value_strict(std::move(arg), name, codename));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose3d(
                 extract_numeric_value(std::move(arg), name, codename));
@@ -269,6 +275,7 @@ namespace phylanx { namespace common
                 extract_boolean_value_strict(std::move(arg), name, codename),
                 std::move(axes));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return transpose3d(
                 extract_integer_value_strict(std::move(arg), name, codename),
@@ -276,6 +283,7 @@ namespace phylanx { namespace common
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose3d(
                 extract_numeric_value(std::move(arg), name, codename),
@@ -488,11 +496,13 @@ namespace phylanx { namespace common
             return transpose4d(
                 extract_boolean_value_strict(std::move(arg), name, codename));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return transpose4d(
                 extract_integer_value_strict(std::move(arg), name, codename));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose4d(
                 extract_numeric_value(std::move(arg), name, codename));
@@ -630,6 +640,7 @@ namespace phylanx { namespace common
                 extract_boolean_value_strict(std::move(arg), name, codename),
                 std::move(axes));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return transpose4d(
                 extract_integer_value_strict(std::move(arg), name, codename),
@@ -637,6 +648,7 @@ namespace phylanx { namespace common
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose4d(
                 extract_numeric_value(std::move(arg), name, codename),
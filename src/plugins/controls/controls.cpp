@@ -39,6 +39,8 @@ PHYLANX_REGISTER_PLUGIN_FACTORY(parallel_map_operation_plugin,
     phylanx::execution_tree::primitives::parallel_map_operation::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(range_operation_plugin,
     phylanx::execution_tree::primitives::range_operation::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(scalar_loop_plugin,
+    phylanx::execution_tree::primitives::scalar_loop::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(while_operation_plugin,
     phylanx::execution_tree::primitives::while_operation::match_data);
 
@@ -285,6 +285,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_node_data<std::uint8_t>(std::move(data)),
                 std::move(ctx));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return fold_right_array_helper(std::move(bound_func),
                 std::move(initial),
@@ -292,6 +293,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 std::move(ctx));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return fold_right_array_helper(std::move(bound_func),
                 std::move(initial), extract_node_data<double>(std::move(data)),
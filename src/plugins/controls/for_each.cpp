@@ -98,6 +98,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                     std::move(value), name_, codename_),
                 std::move(ctx), name_, codename_);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return detail::iterate_over_array_vector_helper(p,
                 extract_integer_value_strict(
@@ -106,6 +107,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return detail::iterate_over_array_vector_helper(p,
                 extract_numeric_value_strict(
@@ -167,6 +169,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                     std::move(value), name_, codename_),
                 std::move(ctx), name_, codename_);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return detail::iterate_over_array_matrix_helper(p,
                 extract_integer_value_strict(
@@ -175,6 +178,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return detail::iterate_over_array_matrix_helper(p,
                 extract_numeric_value_strict(
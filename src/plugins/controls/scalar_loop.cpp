@@ -0,0 +1,674 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/controls/scalar_loop.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/util.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const scalar_loop::match_data =
+    {
+        match_pattern_type{"__scalar_loop",
+            std::vector<std::string>{"__scalar_loop(_1, _2, __3)"},
+            &create_scalar_loop, &create_primitive<scalar_loop>,
+            R"(
+            program, loop, args
+            Args:
+
+                program (string): the three-address instructions that
+                    implement the loop, registers 'a<n>' refer to the
+                    arguments (starting at 0)
+                loop (statement): the original loop, evaluated if any of the
+                    arguments is not a scalar
+               *args (arg list): the variables and literals used by the loop
+
+            Returns:
+
+            The value returned from the last iteration, `nil` otherwise. This
+            primitive is generated by the compiler for while() and for()
+            loops operating on scalar values only.)"
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        struct scalar_register
+        {
+            enum kind_type : std::uint8_t
+            {
+                nil, boolean, integer, real
+            };
+
+            kind_type kind_ = nil;
+            std::int64_t i_ = 0;        // boolean and integer values
+            double d_ = 0.0;
+        };
+
+        struct scalar_operation
+        {
+            char const* token_;
+            scalar_opcode opcode_;
+            std::size_t arity_;         // number of register arguments
+        };
+
+        static scalar_operation const scalar_operations[] =
+        {
+            {"mov", scalar_opcode::mov, 2},
+            {"add", scalar_opcode::add, 3},
+            {"sub", scalar_opcode::sub, 3},
+            {"mul", scalar_opcode::mul, 3},
+            {"div", scalar_opcode::div, 3},
+            {"lt", scalar_opcode::less, 3},
+            {"le", scalar_opcode::less_equal, 3},
+            {"gt", scalar_opcode::greater, 3},
+            {"ge", scalar_opcode::greater_equal, 3},
+            {"eq", scalar_opcode::equal, 3},
+            {"ne", scalar_opcode::not_equal, 3},
+            {"and", scalar_opcode::logical_and, 3},
+            {"or", scalar_opcode::logical_or, 3},
+            {"neg", scalar_opcode::negate, 2},
+            {"not", scalar_opcode::logical_not, 2},
+            {"jmp", scalar_opcode::jump, 0},
+            {"jz", scalar_opcode::jump_if_false, 1},
+            {"ret", scalar_opcode::ret, 1}
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        static bool load_register(
+            primitive_argument_type const& val, scalar_register& reg)
+        {
+            switch (val.index())
+            {
+            case primitive_argument_type::bool_index:
+                {
+                    auto const& nd =
+                        util::get<ir::node_data<std::uint8_t>>(val);
+                    if (nd.num_dimensions() != 0)
+                    {
+                        return false;
+                    }
+                    reg.kind_ = scalar_register::boolean;
+                    reg.i_ = nd.scalar() != 0;
+                    return true;
+                }
+
+            case primitive_argument_type::int64_index:
+                {
+                    auto const& nd =
+                        util::get<ir::node_data<std::int64_t>>(val);
+                    if (nd.num_dimensions() != 0)
+                    {
+                        return false;
+                    }
+                    reg.kind_ = scalar_register::integer;
+                    reg.i_ = nd.scalar();
+                    return true;
+                }
+
+            case primitive_argument_type::float64_index:
+                {
+                    auto const& nd =
+                        util::get<ir::node_data<double>>(val);
+                    if (nd.num_dimensions() != 0)
+                    {
+                        return false;
+                    }
+                    reg.kind_ = scalar_register::real;
+                    reg.d_ = nd.scalar();
+                    return true;
+                }
+
+            default:
+                break;
+            }
+            return false;
+        }
+
+        static primitive_argument_type store_register(
+            scalar_register const& reg)
+        {
+            switch (reg.kind_)
+            {
+            case scalar_register::boolean:
+                return primitive_argument_type{reg.i_ != 0};
+
+            case scalar_register::integer:
+                return primitive_argument_type{reg.i_};
+
+            case scalar_register::real:
+                return primitive_argument_type{reg.d_};
+
+            default:
+                break;
+            }
+            return primitive_argument_type{};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        inline bool is_number(scalar_register const& reg)
+        {
+            return reg.kind_ == scalar_register::integer ||
+                reg.kind_ == scalar_register::real;
+        }
+
+        inline double as_double(scalar_register const& reg)
+        {
+            return reg.kind_ == scalar_register::real ? reg.d_ : double(reg.i_);
+        }
+
+        // same semantics as extract_scalar_boolean_value
+        inline bool as_boolean(scalar_register const& reg, bool& result)
+        {
+            switch (reg.kind_)
+            {
+            case scalar_register::boolean: HPX_FALLTHROUGH;
+            case scalar_register::integer:
+                result = reg.i_ != 0;
+                return true;
+
+            case scalar_register::real:
+                result = reg.d_ != 0.0;
+                return true;
+
+            default:
+                break;
+            }
+            return false;
+        }
+
+        // integer operands give integer results, mixed operands are
+        // converted to double (like for the arithmetic primitives)
+        static bool arithmetic(scalar_opcode op, scalar_register const& lhs,
+            scalar_register const& rhs, scalar_register& dest)
+        {
+            if (lhs.kind_ == scalar_register::integer &&
+                rhs.kind_ == scalar_register::integer)
+            {
+                std::int64_t l = lhs.i_;
+                std::int64_t r = rhs.i_;
+                switch (op)
+                {
+                case scalar_opcode::add: dest.i_ = l + r; break;
+                case scalar_opcode::sub: dest.i_ = l - r; break;
+                case scalar_opcode::mul: dest.i_ = l * r; break;
+                case scalar_opcode::div:
+                    if (r == 0)
+                    {
+                        return false;   // let the primitives report this
+                    }
+                    dest.i_ = l / r;
+                    break;
+                default:
+                    return false;
+                }
+                dest.kind_ = scalar_register::integer;
+                return true;
+            }
+
+            if (!is_number(lhs) || !is_number(rhs))
+            {
+                return false;
+            }
+
+            double l = as_double(lhs);
+            double r = as_double(rhs);
+            switch (op)
+            {
+            case scalar_opcode::add: dest.d_ = l + r; break;
+            case scalar_opcode::sub: dest.d_ = l - r; break;
+            case scalar_opcode::mul: dest.d_ = l * r; break;
+            case scalar_opcode::div: dest.d_ = l / r; break;
+            default:
+                return false;
+            }
+            dest.kind_ = scalar_register::real;
+            return true;
+        }
+
+        template <typename T>
+        static bool compare(scalar_opcode op, T l, T r)
+        {
+            switch (op)
+            {
+            case scalar_opcode::less:          return l < r;
+            case scalar_opcode::less_equal:    return l <= r;
+            case scalar_opcode::greater:       return l > r;
+            case scalar_opcode::greater_equal: return l >= r;
+            case scalar_opcode::equal:         return l == r;
+            case scalar_opcode::not_equal:     return l != r;
+            default:
+                break;
+            }
+            return false;
+        }
+
+        static bool comparison(scalar_opcode op, scalar_register const& lhs,
+            scalar_register const& rhs, scalar_register& dest)
+        {
+            bool result = false;
+            if (lhs.kind_ == scalar_register::integer &&
+                rhs.kind_ == scalar_register::integer)
+            {
+                result = compare(op, lhs.i_, rhs.i_);
+            }
+            else if (is_number(lhs) && is_number(rhs))
+            {
+                result = compare(op, as_double(lhs), as_double(rhs));
+            }
+            else if (lhs.kind_ == scalar_register::boolean &&
+                rhs.kind_ == scalar_register::boolean &&
+                (op == scalar_opcode::equal || op == scalar_opcode::not_equal))
+            {
+                result = compare(op, lhs.i_, rhs.i_);
+            }
+            else
+            {
+                return false;
+            }
+
+            dest.kind_ = scalar_register::boolean;
+            dest.i_ = result;
+            return true;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    scalar_loop::scalar_loop(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+    {
+        if (operands_.size() < 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "scalar_loop::scalar_loop",
+                generate_error_message(
+                    "the scalar_loop primitive requires at least two "
+                    "operands"));
+        }
+
+        num_operands_ = operands_.size() - 2;
+        parse_program(extract_string_value(operands_[0], name_, codename_));
+    }
+
+    // Registers are numbered such that the operands come first, followed
+    // by a register that always holds nil, followed by the temporaries.
+    void scalar_loop::parse_program(std::string const& program)
+    {
+        num_registers_ = num_operands_ + 1;
+
+        auto parse_number = [&](std::string const& token, std::size_t offset)
+            -> std::size_t
+        {
+            std::size_t pos = 0;
+            std::size_t result = 0;
+            try
+            {
+                result = std::stoul(token.substr(offset), &pos);
+            }
+            catch (std::exception const&)
+            {
+                pos = 0;
+            }
+
+            if (pos == 0 || pos != token.size() - offset)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "scalar_loop::parse_program",
+                    generate_error_message("invalid token '" + token +
+                        "' in program: " + program));
+            }
+            return result;
+        };
+
+        auto parse_register = [&](std::string const& token) -> std::size_t
+        {
+            if (token == "nil")
+            {
+                return num_operands_;
+            }
+
+            if (!token.empty() && token[0] == 'a')
+            {
+                std::size_t reg = parse_number(token, 1);
+                if (reg >= num_operands_)
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "scalar_loop::parse_program",
+                        generate_error_message("invalid operand '" + token +
+                            "' in program: " + program));
+                }
+                return reg;
+            }
+
+            if (!token.empty() && token[0] == 't')
+            {
+                std::size_t reg = num_operands_ + 1 + parse_number(token, 1);
+                num_registers_ = (std::max)(num_registers_, reg + 1);
+                return reg;
+            }
+
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "scalar_loop::parse_program",
+                generate_error_message("invalid register '" + token +
+                    "' in program: " + program));
+        };
+
+        std::istringstream instructions(program);
+        std::string instruction;
+        while (std::getline(instructions, instruction, ';'))
+        {
+            std::istringstream strm(instruction);
+            std::vector<std::string> tokens{
+                std::istream_iterator<std::string>(strm),
+                std::istream_iterator<std::string>()};
+
+            if (tokens.empty())
+            {
+                continue;
+            }
+
+            auto const* begin = std::begin(detail::scalar_operations);
+            auto const* end = std::end(detail::scalar_operations);
+            auto const* it = std::find_if(begin, end,
+                [&](detail::scalar_operation const& op)
+                {
+                    return tokens[0] == op.token_;
+                });
+
+            // jumps have an additional target argument
+            std::size_t num_args = it == end ? 0 : it->arity_;
+            if (it != end && (it->opcode_ == detail::scalar_opcode::jump ||
+                    it->opcode_ == detail::scalar_opcode::jump_if_false))
+            {
+                ++num_args;
+            }
+
+            if (it == end || tokens.size() != num_args + 1)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "scalar_loop::parse_program",
+                    generate_error_message("invalid instruction '" +
+                        instruction + "' in program: " + program));
+            }
+
+            detail::scalar_instruction instr{it->opcode_, 0, 0, 0};
+            switch (it->opcode_)
+            {
+            case detail::scalar_opcode::jump:
+                instr.dest_ = parse_number(tokens[1], 0);
+                break;
+
+            case detail::scalar_opcode::jump_if_false:
+                instr.lhs_ = parse_register(tokens[1]);
+                instr.dest_ = parse_number(tokens[2], 0);
+                break;
+
+            case detail::scalar_opcode::ret:
+                instr.lhs_ = parse_register(tokens[1]);
+                break;
+
+            default:
+                instr.dest_ = parse_register(tokens[1]);
+                instr.lhs_ = parse_register(tokens[2]);
+                if (it->arity_ == 3)
+                {
+                    instr.rhs_ = parse_register(tokens[3]);
+                }
+
+                if (instr.dest_ == num_operands_ ||
+                    (instr.dest_ < num_operands_ &&
+                        it->opcode_ != detail::scalar_opcode::mov))
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "scalar_loop::parse_program",
+                        generate_error_message("invalid target register in "
+                            "instruction '" + instruction + "' in program: " +
+                            program));
+                }
+
+                // remember the variables that have to be written back
+                if (instr.dest_ < num_operands_ &&
+                    std::find(stored_.begin(), stored_.end(), instr.dest_) ==
+                        stored_.end())
+                {
+                    stored_.push_back(instr.dest_);
+                }
+                break;
+            }
+
+            program_.push_back(instr);
+        }
+
+        if (program_.empty() ||
+            program_.back().opcode_ != detail::scalar_opcode::ret)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "scalar_loop::parse_program",
+                generate_error_message(
+                    "the program has to end with a 'ret' instruction: " +
+                    program));
+        }
+
+        for (auto const& instr : program_)
+        {
+            if ((instr.opcode_ == detail::scalar_opcode::jump ||
+                    instr.opcode_ == detail::scalar_opcode::jump_if_false) &&
+                instr.dest_ >= program_.size())
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "scalar_loop::parse_program",
+                    generate_error_message(
+                        "invalid jump target in program: " + program));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Execute the program on the given registers, returns false if the
+    // program encountered values or operations it can't handle. As all
+    // variables are written back only after the program has finished, the
+    // original loop can be evaluated from scratch in this case.
+    bool scalar_loop::run(std::vector<detail::scalar_register>& regs,
+        std::size_t& result) const
+    {
+        using detail::scalar_opcode;
+        using detail::scalar_register;
+
+        std::size_t pc = 0;
+        while (true)
+        {
+            detail::scalar_instruction const& instr = program_[pc++];
+            switch (instr.opcode_)
+            {
+            case scalar_opcode::mov:
+                if (instr.dest_ < num_operands_ &&
+                    regs[instr.lhs_].kind_ == scalar_register::nil)
+                {
+                    return false;   // can't assign nil to a variable
+                }
+                regs[instr.dest_] = regs[instr.lhs_];
+                break;
+
+            case scalar_opcode::add: HPX_FALLTHROUGH;
+            case scalar_opcode::sub: HPX_FALLTHROUGH;
+            case scalar_opcode::mul: HPX_FALLTHROUGH;
+            case scalar_opcode::div:
+                if (!detail::arithmetic(instr.opcode_, regs[instr.lhs_],
+                        regs[instr.rhs_], regs[instr.dest_]))
+                {
+                    return false;
+                }
+                break;
+
+            case scalar_opcode::less: HPX_FALLTHROUGH;
+            case scalar_opcode::less_equal: HPX_FALLTHROUGH;
+            case scalar_opcode::greater: HPX_FALLTHROUGH;
+            case scalar_opcode::greater_equal: HPX_FALLTHROUGH;
+            case scalar_opcode::equal: HPX_FALLTHROUGH;
+            case scalar_opcode::not_equal:
+                if (!detail::comparison(instr.opcode_, regs[instr.lhs_],
+                        regs[instr.rhs_], regs[instr.dest_]))
+                {
+                    return false;
+                }
+                break;
+
+            case scalar_opcode::logical_and: HPX_FALLTHROUGH;
+            case scalar_opcode::logical_or:
+                {
+                    scalar_register const& lhs = regs[instr.lhs_];
+                    scalar_register const& rhs = regs[instr.rhs_];
+                    if (lhs.kind_ != scalar_register::boolean ||
+                        rhs.kind_ != scalar_register::boolean)
+                    {
+                        return false;
+                    }
+
+                    bool value = instr.opcode_ == scalar_opcode::logical_and ?
+                        (lhs.i_ && rhs.i_) : (lhs.i_ || rhs.i_);
+
+                    regs[instr.dest_].kind_ = scalar_register::boolean;
+                    regs[instr.dest_].i_ = value;
+                }
+                break;
+
+            case scalar_opcode::negate:
+                {
+                    scalar_register const& arg = regs[instr.lhs_];
+                    scalar_register& dest = regs[instr.dest_];
+                    if (arg.kind_ == scalar_register::integer)
+                    {
+                        dest.kind_ = scalar_register::integer;
+                        dest.i_ = -arg.i_;
+                    }
+                    else if (arg.kind_ == scalar_register::real)
+                    {
+                        dest.kind_ = scalar_register::real;
+                        dest.d_ = -arg.d_;
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                }
+                break;
+
+            case scalar_opcode::logical_not:
+                {
+                    scalar_register const& arg = regs[instr.lhs_];
+                    if (arg.kind_ != scalar_register::boolean)
+                    {
+                        return false;
+                    }
+                    regs[instr.dest_].kind_ = scalar_register::boolean;
+                    regs[instr.dest_].i_ = !arg.i_;
+                }
+                break;
+
+            case scalar_opcode::jump:
+                pc = instr.dest_;
+                break;
+
+            case scalar_opcode::jump_if_false:
+                {
+                    bool cond = false;
+                    if (!detail::as_boolean(regs[instr.lhs_], cond))
+                    {
+                        return false;
+                    }
+                    if (!cond)
+                    {
+                        pc = instr.dest_;
+                    }
+                }
+                break;
+
+            case scalar_opcode::ret:
+                result = instr.lhs_;
+                return true;
+
+            default:
+                return false;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> scalar_loop::eval(
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        primitive_arguments_type const& params =
+            this->no_operands() ? noargs : args;
+
+        // load the current values of all variables and literals into the
+        // register file
+        std::vector<detail::scalar_register> regs(num_registers_);
+        bool scalar = true;
+        for (std::size_t i = 0; i != num_operands_; ++i)
+        {
+            auto val = value_operand_sync(
+                operands_[i + 2], params, name_, codename_, ctx);
+            if (!detail::load_register(val, regs[i]))
+            {
+                scalar = false;
+                break;
+            }
+        }
+
+        std::size_t result = 0;
+        if (!scalar || !run(regs, result))
+        {
+            // evaluate the original loop instead
+            return value_operand(
+                operands_[1], params, name_, codename_, std::move(ctx));
+        }
+
+        // write back the variables that were assigned to
+        if (!stored_.empty())
+        {
+            primitive_arguments_type store_args;
+            if (!params.empty())
+            {
+                store_args.reserve(params.size());
+                for (auto const& arg : params)
+                {
+                    store_args.emplace_back(
+                        extract_value(arg, name_, codename_));
+                }
+            }
+
+            for (std::size_t i : stored_)
+            {
+                auto p = primitive_operand(
+                    extract_ref_value(operands_[i + 2], name_, codename_),
+                    name_, codename_);
+
+                p.store(hpx::launch::sync, detail::store_register(regs[i]),
+                    primitive_arguments_type(store_args), ctx);
+            }
+        }
+
+        return hpx::make_ready_future(detail::store_register(regs[result]));
+    }
+}}}
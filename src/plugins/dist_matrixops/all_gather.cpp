@@ -290,6 +290,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_boolean_value_strict(std::move(arr), name_, codename_),
                 std::move(locs));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return all_gather2d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
@@ -300,6 +301,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_numeric_value(std::move(arr), name_, codename_),
                 std::move(locs));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return all_gather2d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
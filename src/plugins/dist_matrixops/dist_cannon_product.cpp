@@ -94,6 +94,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                 extract_boolean_value(std::move(rhs), name_, codename_),
                 std::move(lhs_localities), rhs_localities);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dot2d2d(
                 extract_integer_value(std::move(lhs), name_, codename_),
@@ -102,6 +103,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot2d2d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
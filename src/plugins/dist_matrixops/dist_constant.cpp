@@ -175,12 +175,14 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 tile_idx, numtiles, std::move(given_name), intersection,
                 std::move(ctx));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return constant1d_helper<std::int64_t>(std::move(value), dims[0],
                 tile_idx, numtiles, std::move(given_name), intersection,
                 std::move(ctx));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return constant1d_helper<double>(std::move(value), dims[0],
                 tile_idx, numtiles, std::move(given_name), intersection,
@@ -279,12 +281,14 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 tile_idx, numtiles, std::move(given_name), tiling_type,
                 intersections, std::move(ctx));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return constant2d_helper<std::int64_t>(std::move(value), dims,
                 tile_idx, numtiles, std::move(given_name), tiling_type,
                 intersections, std::move(ctx));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return constant2d_helper<double>(std::move(value), dims, tile_idx,
                 numtiles, std::move(given_name), tiling_type, intersections,
@@ -390,12 +394,14 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 tile_idx, numtiles, std::move(given_name), tiling_type,
                 intersections, std::move(ctx));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return constant3d_helper<std::int64_t>(std::move(value), dims,
                 tile_idx, numtiles, std::move(given_name), tiling_type,
                 intersections, std::move(ctx));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return constant3d_helper<double>(std::move(value), dims, tile_idx,
                 numtiles, std::move(given_name), tiling_type, intersections,
@@ -384,6 +384,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                 k, tiling_type, tile_idx, numtiles, std::move(arr_localities),
                 std::move(ctx));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dist_diag1d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
@@ -396,6 +397,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                 tiling_type, tile_idx, numtiles, std::move(arr_localities),
                 std::move(ctx));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dist_diag1d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
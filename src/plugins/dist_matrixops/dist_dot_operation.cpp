@@ -82,12 +82,14 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_boolean_value(std::move(lhs), name_, codename_),
                 extract_boolean_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dot0d(
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot0d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -129,6 +131,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_boolean_value(std::move(rhs), name_, codename_),
                 std::move(lhs_localities), rhs_localities);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dot1d(
                 extract_integer_value(std::move(lhs), name_, codename_),
@@ -136,6 +139,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 std::move(lhs_localities), rhs_localities);
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot1d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -178,6 +182,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_boolean_value(std::move(rhs), name_, codename_),
                 std::move(lhs_localities), rhs_localities);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dot2d(
                 extract_integer_value(std::move(lhs), name_, codename_),
@@ -185,6 +190,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 std::move(lhs_localities), rhs_localities);
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot2d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -227,6 +233,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_boolean_value(std::move(rhs), name_, codename_),
                 lhs_localities, rhs_localities);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dot3d(
                 extract_integer_value(std::move(lhs), name_, codename_),
@@ -234,6 +241,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 lhs_localities, rhs_localities);
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot3d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
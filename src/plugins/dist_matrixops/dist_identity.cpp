@@ -176,12 +176,14 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
             return dist_identity_helper<std::uint8_t>(sz, tile_idx, numtiles,
                 std::move(given_name), tiling_type, std::move(ctx));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dist_identity_helper<std::int64_t>(sz, tile_idx, numtiles,
                 std::move(given_name), tiling_type, std::move(ctx));
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dist_identity_helper<double>(sz, tile_idx, numtiles,
                 std::move(given_name), tiling_type, std::move(ctx));
@@ -1,5 +1,5 @@
 // Copyright (c) 2020 Rory Hector
-// Copyright (c) 2018-2020 Hartmut Kaiser
+// Copyright (c) 2018-2021 Hartmut Kaiser
 //
 // Distributed under the Boost Software License, Version 1.0. (See accompanying
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
@@ -13,14 +13,16 @@
 #include <phylanx/execution_tree/tiling_annotations.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/dist_matrixops/dist_inverse_operation.hpp>
-#include <phylanx/plugins/dist_matrixops/tile_calculation_helper.hpp>
-#include <phylanx/util/detail/bad_swap.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+#include <phylanx/util/serialization/blaze.hpp>
 
 #include <hpx/errors/throw_exception.hpp>
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
 
 #include <algorithm>
 #include <cmath>
@@ -32,33 +34,79 @@
 #include <vector>
 
 #include <blaze/Math.h>
-#include <blaze_tensor/Math.h>
-
-#include <phylanx/util/distributed_matrix.hpp>
 
 namespace phylanx { namespace dist_matrixops { namespace primitives {
 
-    constexpr char const* const help_string = R"(
-        inverse_d(matrix)
-        Args:
-            blaze dynamic matrix
-        Returns:
-            the inverse of the matrix
-        )";
-
-    execution_tree::match_pattern_type const dist_inverse::match_data = {
-        hpx::make_tuple("inverse_d", std::vector<std::string>{R"(
-              inverse_d(
-                 _1_matrix
-              ))"},
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<execution_tree::match_pattern_type> const
+        dist_inverse::match_data =
+    {
+        execution_tree::match_pattern_type{"inverse_d",
+            std::vector<std::string>{R"(
+                inverse_d(
+                    _1_matrix
+                )
+            )"},
             &create_dist_inverse,
-            &execution_tree::create_primitive<dist_inverse>, help_string)};
+            &execution_tree::create_primitive<dist_inverse>, R"(
+            matrix
+            Args:
+
+                matrix (array) : a square matrix tiled by columns, every
+                    locality holds all rows of its columns
+
+            Returns:
+
+                The columns of the inverse of the matrix held by this
+                locality, tiled in the same way as the argument.)"
+        },
+        execution_tree::match_pattern_type{"linear_solver_lu_d",
+            std::vector<std::string>{R"(
+                linear_solver_lu_d(
+                    _1_matrix,
+                    _2_rhs
+                )
+            )"},
+            &create_dist_inverse,
+            &execution_tree::create_primitive<dist_inverse>, R"(
+            matrix, rhs
+            Args:
+
+                matrix (array) : a square matrix tiled by columns, every
+                    locality holds all rows of its columns
+                rhs (array) : the right hand side, either a vector or a
+                    matrix available on all localities or a matrix tiled by
+                    columns
+
+            Returns:
+
+                The solution x of matrix * x = rhs. If the right hand side
+                is tiled by columns the result is tiled in the same way.)"
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        dist_inverse::inverse_mode extract_inverse_mode(std::string const& name)
+        {
+            dist_inverse::inverse_mode result =
+                dist_inverse::inverse_mode_inverse;
+
+            if (name.find("linear_solver_lu_d") != std::string::npos)
+            {
+                result = dist_inverse::inverse_mode_solve;
+            }
+            return result;
+        }
+    }
 
     dist_inverse::dist_inverse(
         execution_tree::primitive_arguments_type&& operands,
         std::string const& name, std::string const& codename)
       : primitive_component_base(std::move(operands), name, codename)
       , transferred_bytes_(0)
+      , mode_(detail::extract_inverse_mode(name_))
     {
     }
 
@@ -67,288 +115,531 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
         return hpx::util::get_and_reset_value(transferred_bytes_, reset);
     }
 
-    // find the first column belonging to a locality
-    std::size_t getStartCol(std::size_t id, std::size_t n, std::size_t numLocs)
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
     {
-        std::size_t startCol =
-            id * (n / numLocs) + ((id < n % numLocs) ? id : (n % numLocs));
-        return startCol;
-    }
+        // maximal number of columns factorized at once
+        std::size_t lu_block_size()
+        {
+            static std::size_t block_size = (std::max)(std::size_t(1),
+                std::size_t(std::stoul(hpx::get_config_entry(
+                    "phylanx.inverse_d_block_size", "64"))));
+            return block_size;
+        }
 
-    // find the final column belonging to a locality
-    std::size_t getEndCol(std::size_t id, std::size_t n, std::size_t numLocs)
-    {
-        std::size_t endCol;
-        if (id == numLocs - 1)
-            endCol = n;
-        else
-            endCol = getStartCol(id + 1, n, numLocs);
-        return endCol;
-    }
+        // consecutive columns of the matrix owned by one locality
+        struct column_panel
+        {
+            std::size_t start_;
+            std::size_t stop_;
+            std::uint32_t owner_;
+        };
 
-    // find the locality who holds a given column locally
-    std::size_t findOwningLoc(
-        std::size_t n, std::size_t numLocs, std::size_t col)
-    {
-        std::size_t id;
-        if (col < (n % numLocs) * (n / numLocs + 1))
-            id = col / ((n / numLocs) + 1);
-        else
-            id = (n % numLocs) +
-                ((col - (n % numLocs) * (n / numLocs + 1)) / (n / numLocs));
-        return id;
-    }
+        // data sent by the owner of a panel to all localities
+        struct panel_data
+        {
+            blaze::DynamicMatrix<double> data_;
+            blaze::DynamicVector<std::int64_t> pivots_;
 
-    // This is where the computation of the inverse is performed.
-    template <typename T>
-    execution_tree::primitive_argument_type dist_inverse::distGaussInv(
-        ir::node_data<T>&& arg,
-        execution_tree::localities_information&& lhs_localities) const
-    {
-        if (lhs_localities.num_dimensions() != 2)
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & data_ & pivots_;
+                // clang-format on
+            }
+        };
+
+        // split the column tiles of all localities into panels of at most
+        // lu_block_size() columns, ordered by their first column
+        std::vector<column_panel> column_panels(
+            execution_tree::localities_information const& locs,
+            std::size_t n, std::string const& name,
+            std::string const& codename)
         {
-            HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "dist_inverse::distGaussInv",
-                generate_error_message("the input must be a 2d matrix"));
-        }
+            std::size_t const block_size = lu_block_size();
 
-        std::size_t thisLocalityID = lhs_localities.locality_.locality_id_;
-        std::size_t numLocalities = lhs_localities.locality_.num_localities_;
-
-        util::distributed_matrix<T> lhs_data(lhs_localities.annotation_.name_,
-            arg.matrix(), lhs_localities.locality_.num_localities_,
-            lhs_localities.locality_.locality_id_, &transferred_bytes_);
-
-        auto myMatrix = arg.matrix();
-        std::size_t numRows = myMatrix.rows();
-        std::size_t numCols = myMatrix.columns();
-
-        // Define some additional information on where
-        // columns lie in the full input
-        std::size_t startCol = thisLocalityID * (numRows / numLocalities) +
-            ((thisLocalityID < (numRows % numLocalities)) ?
-                    thisLocalityID :
-                    (numRows % numLocalities));
-        std::size_t endCol = startCol + numCols - 1;
-
-        // Definition of this loc's part of a nxn double row-major identity matrix
-        blaze::DynamicMatrix<double> invMatrix =
-            blaze::submatrix(blaze::IdentityMatrix<double>(numRows), 0,
-                startCol, arg.matrix().rows(), arg.matrix().columns());
-
-            // Do gaussian elimination to get upper triangular
-            // matrix with 1's across diagonal
-            for (std::size_t current_row = 0; current_row != numRows;
-                 current_row++)
+            std::vector<column_panel> panels;
+            for (std::uint32_t loc = 0; loc != locs.tiles_.size(); ++loc)
             {
-                // Find the locality that owns the pivot element then get the pivot
-                std::size_t ownid1 =
-                    findOwningLoc(numRows, numLocalities, current_row);
+                if (locs.tiles_[loc].dimension() == 0)
+                {
+                    continue;   // this locality does not hold any columns
+                }
 
-                std::size_t localIndexOffset =
-                    current_row - getStartCol(ownid1, numRows, numLocalities);
-                auto pulledColumn =
-                    lhs_data
-                        .fetch(ownid1, current_row, localIndexOffset, numRows,
-                            localIndexOffset + 1)
-                        .get();
-                double pivot = pulledColumn(0, 0);
+                execution_tree::tiling_information_2d tile(
+                    locs.tiles_[loc], name, codename);
 
+                if (tile.spans_[0].start_ != 0 ||
+                    tile.spans_[0].stop_ != std::int64_t(n))
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "dist_inverse::column_panels",
+                        util::generate_error_message(
+                            "the matrix must be tiled by columns, every "
+                            "locality has to hold all rows of its columns",
+                            name, codename));
+                }
 
-                if (numLocalities > 1)
+                std::size_t const stop = tile.spans_[1].stop_;
+                for (std::size_t start = tile.spans_[1].start_; start < stop;
+                     start += block_size)
                 {
-                    hpx::lcos::barrier b2(
-                        "barrierb_" + lhs_localities.annotation_.name_,
-                        lhs_localities.locality_.num_localities_,
-                        lhs_localities.locality_.locality_id_);
-                    b2.wait();
+                    panels.push_back(column_panel{
+                        start, (std::min)(start + block_size, stop), loc});
                 }
+            }
 
-                // Swaps current row with nearest subsequent row such that
-                // after swapping A[current_row][current_row] != 0.
-                if (pivot == 0)
+            std::sort(panels.begin(), panels.end(),
+                [](column_panel const& lhs, column_panel const& rhs) {
+                    return lhs.start_ < rhs.start_;
+                });
+
+            std::size_t expected_start = 0;
+            for (auto const& panel : panels)
+            {
+                if (panel.start_ != expected_start)
                 {
-                    bool rowFound = false;
-                    std::size_t checkOffset = 1;
-                    while (current_row + checkOffset != numRows && !rowFound)
-                    {
-                        pivot = pulledColumn(checkOffset, 0);
-                        if (pivot != 0)
-                        {
-                            std::size_t checkRow =
-                                (current_row + checkOffset) % numRows;
-
-                            for (std::size_t swapCol = 0; swapCol!=numCols; swapCol++)
-                            {
-                                auto temp = (*lhs_data)(current_row, swapCol);
-                                (*lhs_data)(current_row, swapCol) =
-                                    (*lhs_data)(checkRow, swapCol);
-                                (*lhs_data)(checkRow, swapCol) = temp;
-
-                                auto invtemp = invMatrix(current_row, swapCol);
-                                invMatrix(current_row, swapCol) =
-                                    invMatrix(checkRow, swapCol);
-                                invMatrix(checkRow, swapCol) = invtemp;
-                            }
-                            rowFound = true;
-                        }
-                        else
-                            checkOffset++;
-                    }
-                    // swap row with nearest subsequent row such that after
-                    // swapping A[i][i] != 0
-                    // if fails, inverse does not exist
-                    if (!rowFound)
+                    break;
+                }
+                expected_start = panel.stop_;
+            }
+
+            if (expected_start != n)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_inverse::column_panels",
+                    util::generate_error_message(
+                        "the column tiles must cover the matrix without "
+                        "overlapping",
+                        name, codename));
+            }
+
+            return panels;
+        }
+
+        // Factorize the panel p (holding the rows k...n of the panel columns)
+        // using partial pivoting. The L part (unit diagonal) and the U part
+        // are stored in place, pivots receives the global indices of the
+        // rows swapped with the rows k...k+w. Returns false if the matrix is
+        // singular.
+        template <typename Matrix>
+        bool factorize_panel(Matrix&& p,
+            blaze::DynamicVector<std::int64_t>& pivots, std::size_t k)
+        {
+            std::size_t const m = p.rows();
+            std::size_t const w = p.columns();
+
+            pivots.resize(w);
+            for (std::size_t j = 0; j != w; ++j)
+            {
+                std::size_t pivot_row = j;
+                double max_value = std::abs(p(j, j));
+                for (std::size_t i = j + 1; i != m; ++i)
+                {
+                    if (std::abs(p(i, j)) > max_value)
                     {
-                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                            "dist_inverse::distGaussInv",
-                            generate_error_message("inverse does not exist"));
+                        max_value = std::abs(p(i, j));
+                        pivot_row = i;
                     }
-                    current_row--;    // After swapping, make sure to retry this row
                 }
-                else    // the inversion has not already failed
+
+                if (max_value == 0.0)
                 {
-                    for (std::size_t col = 0; col != numCols; col++)
-                    {
+                    return false;
+                }
 
-                        (*lhs_data)(current_row, col) =
-                            (*lhs_data)(current_row, col) / pivot;
-                        invMatrix(current_row, col) =
-                            invMatrix(current_row, col) / pivot;
-                    }
-                    if (current_row < numRows - 1)
+                pivots[j] = std::int64_t(k + pivot_row);
+                if (pivot_row != j)
+                {
+                    for (std::size_t c = 0; c != w; ++c)
                     {
-                        for (std::size_t nextRow = current_row + 1;
-                             nextRow != numRows; nextRow++)
-                        {
-                            // Find the locality that owns the pivot element
-                            // then get the pivot
-                            std::size_t ownid2 = findOwningLoc(
-                                numRows, numLocalities, current_row);
-                            std::size_t localIndexOffset2 = current_row -
-                                getStartCol(ownid2, numRows, numLocalities);
-                            auto pulledElement =
-                                lhs_data
-                                    .fetch(ownid2, nextRow, localIndexOffset2,
-                                         nextRow + 1,
-                                         localIndexOffset2 + 1)
-                                    .get();
-                            double factor = pulledElement(0, 0);
-
-                            // Removing this barrier causes errors
-                            if (numLocalities > 1)
-                            {
-                                hpx::lcos::barrier b5("barriere_" +
-                                        lhs_localities.annotation_.name_,
-                                    lhs_localities.locality_.num_localities_,
-                                    lhs_localities.locality_.locality_id_);
-                                b5.wait();
-                            }
-
-
-                            for (std::size_t nextCol = 0;
-                                 nextCol != numCols; nextCol++)
-                            {
-                                (*lhs_data)(nextRow, nextCol) =
-                                    (*lhs_data)(nextRow, nextCol) -
-                                    (factor *
-                                        (*lhs_data)(current_row, nextCol));
-                                invMatrix(nextRow, nextCol) =
-                                    invMatrix(nextRow, nextCol) -
-                                    (factor * invMatrix(current_row, nextCol));
-                            }
-                        }
+                        std::swap(p(j, c), p(pivot_row, c));
                     }
                 }
+
+                double const pivot = p(j, j);
+                for (std::size_t i = j + 1; i != m; ++i)
+                {
+                    p(i, j) /= pivot;
+                }
+
+                if (j + 1 != w && j + 1 != m)
+                {
+                    blaze::submatrix(p, j + 1, j + 1, m - j - 1, w - j - 1) -=
+                        blaze::subvector(blaze::column(p, j), j + 1, m - j - 1) *
+                        blaze::subvector(blaze::row(p, j), j + 1, w - j - 1);
+                }
             }
+            return true;
+        }
 
+        // Apply the factorized panel starting at row (and column) k to the
+        // columns a (all rows): swap the rows, compute U12 = L11^-1 * A12,
+        // and update A22 -= L21 * U12.
+        template <typename Matrix>
+        void apply_panel(
+            Matrix&& a, panel_data const& panel, std::size_t k)
+        {
+            std::size_t const n = a.rows();
+            std::size_t const cols = a.columns();
+            std::size_t const w = panel.pivots_.size();
+
+            if (cols == 0)
+            {
+                return;
+            }
 
-            // Back substitution phase, going from bottom to top
-            // in matrix zeroing out columns except diagonal
-            for (std::size_t zeroCol = numRows - 1; zeroCol != 0; zeroCol--)
+            for (std::size_t j = 0; j != w; ++j)
             {
-                for (std::int64_t row = zeroCol - 1; row != -1; row--)
+                std::size_t const pivot_row = panel.pivots_[j];
+                if (pivot_row != k + j)
                 {
-                    // Find the locality that owns the pivot element then get the pivot
-                    std::size_t ownid3 =
-                        findOwningLoc(numRows, numLocalities, zeroCol);
-                    std::size_t localIndexOffset3 =
-                        zeroCol -
-                        getStartCol(ownid3, numRows, numLocalities);
-                    auto pulledElement =
-                        lhs_data
-                            .fetch(ownid3, row, localIndexOffset3, row + 1,
-                                localIndexOffset3 + 1)
-                            .get();
-                    double factor = pulledElement(0, 0);
-
-                    // Removing this barrier causes errors
-                    if (numLocalities > 1)
+                    for (std::size_t c = 0; c != cols; ++c)
                     {
-                        hpx::lcos::barrier b8(
-                            "barrierg_" + lhs_localities.annotation_.name_,
-                            lhs_localities.locality_.num_localities_,
-                            lhs_localities.locality_.locality_id_);
-                        b8.wait();
+                        std::swap(a(k + j, c), a(pivot_row, c));
                     }
+                }
+            }
 
+            auto a12 = blaze::submatrix(a, k, 0, w, cols);
+            for (std::size_t i = 1; i != w; ++i)
+            {
+                for (std::size_t j = 0; j != i; ++j)
+                {
+                    blaze::row(a12, i) -= panel.data_(i, j) * blaze::row(a12, j);
+                }
+            }
 
-                    for (std::size_t col = 0; col != numCols; col++)
-                    {
-                        myMatrix(row, col) = myMatrix(row, col) -
-                            (factor * myMatrix(zeroCol, col));
-                        invMatrix(row, col) = invMatrix(row, col) -
-                            (factor * invMatrix(zeroCol, col));
-                    }
+            if (k + w != n)
+            {
+                blaze::submatrix(a, k + w, 0, n - k - w, cols) -=
+                    blaze::submatrix(panel.data_, w, 0, n - k - w, w) * a12;
+            }
+        }
+
+        // Apply the column panel u of U (rows 0...k+w of the columns
+        // k...k+w) to the right hand side y: solve X = U11^-1 * Y1 and
+        // update Y0 -= U01 * X.
+        template <typename Matrix>
+        void apply_upper_panel(Matrix&& y,
+            blaze::DynamicMatrix<double> const& u, std::size_t k)
+        {
+            std::size_t const cols = y.columns();
+            std::size_t const w = u.columns();
+
+            if (cols == 0)
+            {
+                return;
+            }
+
+            auto x = blaze::submatrix(y, k, 0, w, cols);
+            for (std::size_t i = w; i-- != 0;)
+            {
+                for (std::size_t j = i + 1; j != w; ++j)
+                {
+                    blaze::row(x, i) -= u(k + i, j) * blaze::row(x, j);
+                }
+                blaze::row(x, i) /= u(k + i, i);
+            }
+
+            if (k != 0)
+            {
+                blaze::submatrix(y, 0, 0, k, cols) -=
+                    blaze::submatrix(u, 0, 0, k, w) * x;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void dist_inverse::lu_solve(blaze::DynamicMatrix<double>& a,
+        blaze::DynamicMatrix<double>& b,
+        execution_tree::localities_information const& lhs_localities) const
+    {
+        using panel_future = hpx::future<std::vector<detail::panel_data>>;
+
+        std::size_t const n = lhs_localities.rows(name_, codename_);
+        if (lhs_localities.columns(name_, codename_) != n)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, "dist_inverse::lu_solve",
+                generate_error_message("the matrix must be square"));
+        }
+        if (b.rows() != n)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, "dist_inverse::lu_solve",
+                generate_error_message("the number of rows of the right hand "
+                    "side must match the size of the matrix"));
+        }
+
+        std::vector<detail::column_panel> const panels =
+            detail::column_panels(lhs_localities, n, name_, codename_);
+        std::size_t const num_panels = panels.size();
+        if (num_panels == 0)
+        {
+            return;
+        }
+
+        std::size_t const num_sites = lhs_localities.locality_.num_localities_;
+        std::uint32_t const this_site = lhs_localities.locality_.locality_id_;
+
+        // global index range of the local columns of the matrix
+        std::size_t first_col = 0;
+        if (lhs_localities.has_span(1))
+        {
+            first_col = lhs_localities.get_span(1).start_;
+        }
+        std::size_t const last_col = first_col + a.columns();
+
+        auto local_columns = [&](std::size_t start, std::size_t stop) {
+            return blaze::submatrix(
+                a, 0, start - first_col, n, stop - start);
+        };
+
+        // send the data of the owner of the given panel to all localities,
+        // this is the only synchronization needed per panel
+        std::string const basename =
+            (mode_ == inverse_mode_inverse ? "inverse_d_" :
+                                             "linear_solver_lu_d_") +
+            lhs_localities.annotation_.name_;
+
+        auto broadcast_panel = [&](char const* phase, std::size_t step,
+                                   detail::panel_data&& data) -> panel_future {
+            if (num_sites == 1)
+            {
+                std::vector<detail::panel_data> result;
+                result.push_back(std::move(data));
+                return hpx::make_ready_future(std::move(result));
+            }
+            return hpx::collectives::all_gather(
+                (phase + basename).c_str(), std::move(data),
+                hpx::collectives::num_sites_arg{num_sites},
+                hpx::collectives::this_site_arg{this_site},
+                hpx::collectives::generation_arg{step + 1});
+        };
+
+        auto receive_panel = [&](panel_future& f,
+                                 std::size_t p) -> detail::panel_data {
+            detail::panel_data panel = std::move(f.get()[panels[p].owner_]);
+            if (panels[p].owner_ != this_site)
+            {
+                transferred_bytes_ += static_cast<std::int64_t>(
+                    (panel.data_.rows() * panel.data_.columns()) *
+                        sizeof(double) +
+                    panel.pivots_.size() * sizeof(std::int64_t));
+            }
+            return panel;
+        };
+
+        // the owner of a panel factorizes it (all trailing updates of
+        // previous panels have been applied) and sends it to everybody
+        auto factorize_panel = [&](std::size_t p) -> panel_future {
+            detail::panel_data data;
+            if (panels[p].owner_ == this_site)
+            {
+                std::size_t const k = panels[p].start_;
+                auto panel = blaze::submatrix(a, k, k - first_col, n - k,
+                    panels[p].stop_ - k);
+                if (detail::factorize_panel(panel, data.pivots_, k))
+                {
+                    data.data_ = panel;
+                }
+                else
+                {
+                    data.pivots_.clear();    // signal singular matrix
                 }
             }
+            return broadcast_panel("lu_", p, std::move(data));
+        };
+
+        // forward phase, compute L and U of A and Y = L^-1 * P * B
+        panel_future next = factorize_panel(0);
+        for (std::size_t p = 0; p != num_panels; ++p)
+        {
+            detail::panel_data panel = receive_panel(next, p);
+
+            std::size_t const k = panels[p].start_;
+            std::size_t const stop = panels[p].stop_;
+            if (panel.pivots_.size() != stop - k)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_inverse::lu_solve",
+                    generate_error_message(
+                        mode_ == inverse_mode_inverse ?
+                            "inverse does not exist" :
+                            "the matrix is singular"));
+            }
+
+            // look-ahead: the columns of the next panel are updated first,
+            // its factorization is then sent while the remaining columns
+            // are being updated
+            std::size_t update_start = (std::max)(stop, first_col);
+            if (p + 1 != num_panels)
+            {
+                if (panels[p + 1].owner_ == this_site)
+                {
+                    detail::apply_panel(local_columns(panels[p + 1].start_,
+                                            panels[p + 1].stop_),
+                        panel, k);
+                    update_start = panels[p + 1].stop_;
+                }
+                next = factorize_panel(p + 1);
+            }
+
+            if (update_start < last_col)
+            {
+                detail::apply_panel(
+                    local_columns(update_start, last_col), panel, k);
+            }
+            detail::apply_panel(b, panel, k);
+        }
+
+        // backward phase, solve U * X = Y. The column panels of U are final
+        // now, the next one is requested before the current one is applied.
+        auto send_upper_panel = [&](std::size_t p) -> panel_future {
+            detail::panel_data data;
+            if (panels[p].owner_ == this_site)
+            {
+                std::size_t const k = panels[p].start_;
+                data.data_ = blaze::submatrix(a, 0, k - first_col,
+                    panels[p].stop_, panels[p].stop_ - k);
+            }
+            return broadcast_panel("upper_", p, std::move(data));
+        };
+
+        next = send_upper_panel(num_panels - 1);
+        for (std::size_t p = num_panels; p-- != 0;)
+        {
+            detail::panel_data panel = receive_panel(next, p);
+            if (p != 0)
+            {
+                next = send_upper_panel(p - 1);
+            }
+            detail::apply_upper_panel(b, panel.data_, panels[p].start_);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    execution_tree::primitive_argument_type dist_inverse::distInverse(
+        ir::node_data<double>&& arg,
+        execution_tree::localities_information&& lhs_localities) const
+    {
+        if (lhs_localities.num_dimensions() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_inverse::distInverse",
+                generate_error_message("the input must be a 2d matrix"));
+        }
+
+        std::size_t const n = lhs_localities.rows(name_, codename_);
+        execution_tree::tiling_span const columns =
+            lhs_localities.get_span(1);
+
+        // this locality's columns of the identity matrix
+        blaze::DynamicMatrix<double> a = arg.matrix();
+        blaze::DynamicMatrix<double> inv(n, a.columns(), 0.0);
+        for (std::size_t j = 0; j != inv.columns(); ++j)
+        {
+            inv(columns.start_ + j, j) = 1.0;
+        }
+
+        lu_solve(a, inv, lhs_localities);
+
+        // Prepare the output, the result is tiled like the argument
+        execution_tree::primitive_argument_type result =
+            execution_tree::primitive_argument_type{std::move(inv)};
 
-            // Prepare the output
-            execution_tree::primitive_argument_type result =
-                execution_tree::primitive_argument_type{invMatrix};
-            execution_tree::annotation ann{ir::range("tile",
-                ir::range("rows", static_cast<std::int64_t>(0),
-                    static_cast<std::int64_t>(numRows)),
-                ir::range("columns", static_cast<std::int64_t>(startCol),
-                    static_cast<std::int64_t>(endCol+1)))};
-            // Generate new tiling annotation for the result vector
-            execution_tree::tiling_information_2d tile_info(
-                ann, name_, codename_);
-
-            ++lhs_localities.annotation_.generation_;
-
-            auto locality_ann = lhs_localities.locality_.as_annotation();
-            result.set_annotation(
-                execution_tree::localities_annotation(locality_ann,
-                    tile_info.as_annotation(name_, codename_),
-                    lhs_localities.annotation_, name_, codename_),
-                name_, codename_);
+        execution_tree::tiling_information_2d tile_info(
+            execution_tree::tiling_span(0, n), columns);
+
+        ++lhs_localities.annotation_.generation_;
+
+        auto locality_ann = lhs_localities.locality_.as_annotation();
+        result.set_annotation(
+            execution_tree::localities_annotation(locality_ann,
+                tile_info.as_annotation(name_, codename_),
+                lhs_localities.annotation_, name_, codename_),
+            name_, codename_);
 
         return result;
     }
 
-    // This is where the computation of the inverse should be performed.
-    execution_tree::primitive_argument_type dist_inverse::distGaussInv(
-        execution_tree::primitive_argument_type&& lhs) const
+    execution_tree::primitive_argument_type dist_inverse::distSolve(
+        ir::node_data<double>&& lhs, ir::node_data<double>&& rhs,
+        execution_tree::localities_information&& lhs_localities,
+        execution_tree::localities_information&& rhs_localities,
+        bool rhs_distributed) const
     {
-        using namespace execution_tree;
+        if (lhs_localities.num_dimensions() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_inverse::distSolve",
+                generate_error_message("the matrix must be a 2d matrix"));
+        }
 
-        execution_tree::localities_information lhs_localities =
-            extract_localities_information(lhs, name_, codename_);
+        blaze::DynamicMatrix<double> a = lhs.matrix();
 
-        switch (extract_numeric_value_dimension(lhs, name_, codename_))
+        if (!rhs_distributed)
         {
-        case 2:
-            // Do the inverse operation
-            return distGaussInv(
-                extract_numeric_value(std::move(lhs), name_, codename_),
-                std::move(lhs_localities));
-        default:
+            // the right hand side is available everywhere, every locality
+            // computes the full solution
+            switch (rhs.num_dimensions())
+            {
+            case 1:
+                {
+                    blaze::DynamicMatrix<double> b(rhs.size(), 1);
+                    blaze::column(b, 0) = rhs.vector();
+                    lu_solve(a, b, lhs_localities);
+                    return execution_tree::primitive_argument_type{
+                        blaze::DynamicVector<double>(blaze::column(b, 0))};
+                }
+
+            case 2:
+                {
+                    blaze::DynamicMatrix<double> b = rhs.matrix();
+                    lu_solve(a, b, lhs_localities);
+                    return execution_tree::primitive_argument_type{
+                        std::move(b)};
+                }
+
+            default:
+                break;
+            }
+
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                " dist_inverse::distGaussInv",
-                generate_error_message("left hand side operand has unsupported "
-                                       "number of dimensions"));
+                "dist_inverse::distSolve",
+                generate_error_message(
+                    "the right hand side must be a vector or a matrix"));
         }
+
+        if (rhs_localities.num_dimensions() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_inverse::distSolve",
+                generate_error_message("a distributed right hand side must "
+                    "be a matrix tiled by columns"));
+        }
+
+        blaze::DynamicMatrix<double> b = rhs.matrix();
+        lu_solve(a, b, lhs_localities);
+
+        // the result is tiled like the right hand side
+        execution_tree::primitive_argument_type result =
+            execution_tree::primitive_argument_type{std::move(b)};
+
+        execution_tree::tiling_information_2d tile_info(
+            rhs_localities.tiles_[rhs_localities.locality_.locality_id_],
+            name_, codename_);
+
+        ++rhs_localities.annotation_.generation_;
+
+        auto locality_ann = rhs_localities.locality_.as_annotation();
+        result.set_annotation(
+            execution_tree::localities_annotation(locality_ann,
+                tile_info.as_annotation(name_, codename_),
+                rhs_localities.annotation_, name_, codename_),
+            name_, codename_);
+
+        return result;
     }
 
     // Call the evaluation function
@@ -356,26 +647,31 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
         execution_tree::primitive_arguments_type const& operands,
         execution_tree::primitive_arguments_type const& args,
         execution_tree::eval_context ctx) const
-
     {
         using namespace execution_tree;
 
-        // Check to make sure there is exactly one item to invert
-        if (operands.size() != 1)
+        std::size_t const num_operands =
+            mode_ == inverse_mode_inverse ? 1 : 2;
+
+        if (operands.size() != num_operands)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter, "dist_inverse::eval",
-                generate_error_message(
-                    "the gaussian inverse operation primitive requires"
-                    "exactly one operand"));
+                generate_error_message(mode_ == inverse_mode_inverse ?
+                        "the inverse_d primitive requires exactly one "
+                        "operand" :
+                        "the linear_solver_lu_d primitive requires exactly "
+                        "two operands"));
         }
 
-        // Check if there are no valid operands
-        if (!valid(operands[0]))
+        for (auto const& operand : operands)
         {
-            HPX_THROW_EXCEPTION(hpx::bad_parameter, "dist_inverse::eval",
-                generate_error_message(
-                    "the gaussian_inverse_operation primitive requires that "
-                    "the arguments given by the operands array is valid"));
+            if (!valid(operand))
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter, "dist_inverse::eval",
+                    generate_error_message(
+                        "the dist_inverse primitive requires that the "
+                        "arguments given by the operands array are valid"));
+            }
         }
 
         // Get a future to the result of the actual computation
@@ -384,7 +680,33 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
             hpx::unwrapping(
                 [this_ = std::move(this_)](primitive_arguments_type&& args)
                     -> primitive_argument_type {
-                    return this_->distGaussInv(std::move(args[0]));
+                    localities_information lhs_localities =
+                        extract_localities_information(
+                            args[0], this_->name_, this_->codename_);
+
+                    if (this_->mode_ == inverse_mode_inverse)
+                    {
+                        return this_->distInverse(
+                            extract_numeric_value(std::move(args[0]),
+                                this_->name_, this_->codename_),
+                            std::move(lhs_localities));
+                    }
+
+                    bool const rhs_distributed = args[1].has_annotation();
+                    localities_information rhs_localities;
+                    if (rhs_distributed)
+                    {
+                        rhs_localities = extract_localities_information(
+                            args[1], this_->name_, this_->codename_);
+                    }
+
+                    return this_->distSolve(
+                        extract_numeric_value(std::move(args[0]),
+                            this_->name_, this_->codename_),
+                        extract_numeric_value(std::move(args[1]),
+                            this_->name_, this_->codename_),
+                        std::move(lhs_localities), std::move(rhs_localities),
+                        rhs_distributed);
                 }),
             execution_tree::primitives::detail::map_operands(operands,
                 execution_tree::functional::value_operand{}, args, name_,
@@ -0,0 +1,672 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/locality_annotation.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/execution_tree/tiling_annotations.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/dist_matrixops/dist_iterative_solver.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+#include <phylanx/util/serialization/blaze.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/modules/collectives.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace dist_matrixops { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<execution_tree::match_pattern_type> const
+        dist_iterative_solver::match_data =
+    {
+        execution_tree::match_pattern_type{
+            "iterative_solver_conjugate_gradient_d",
+            std::vector<std::string>{R"(
+                iterative_solver_conjugate_gradient_d(
+                    _1_a,
+                    _2_b,
+                    __arg(_3_tolerance, 1e-10),
+                    __arg(_4_max_iterations, 0)
+                )
+            )"},
+            &create_dist_iterative_solver,
+            &execution_tree::create_primitive<dist_iterative_solver>, R"(
+            a, b, tolerance, max_iterations
+            Args:
+
+                a (matrix) : a symmetric positive definite matrix tiled by
+                    rows, every locality holds all columns of its rows
+                b (vector) : the right hand side, either tiled like the rows
+                    of a or available on all localities
+                tolerance (float, optional) : the iteration stops as soon as
+                    the norm of the residual drops below tolerance times the
+                    norm of b. It sets to 1e-10 by default.
+                max_iterations (int, optional) : the maximal number of
+                    iterations, the number of rows of a if not given.
+
+            Returns:
+
+            The vector `x` such that `a x = b`, solved using the pipelined
+            conjugate gradient method. The result is tiled like the rows of
+            a.)"
+        },
+        execution_tree::match_pattern_type{"iterative_solver_cg_jacobi_d",
+            std::vector<std::string>{R"(
+                iterative_solver_cg_jacobi_d(
+                    _1_a,
+                    _2_b,
+                    __arg(_3_tolerance, 1e-10),
+                    __arg(_4_max_iterations, 0)
+                )
+            )"},
+            &create_dist_iterative_solver,
+            &execution_tree::create_primitive<dist_iterative_solver>, R"(
+            a, b, tolerance, max_iterations
+            Args:
+
+                a (matrix) : a symmetric positive definite matrix tiled by
+                    rows, every locality holds all columns of its rows
+                b (vector) : the right hand side, either tiled like the rows
+                    of a or available on all localities
+                tolerance (float, optional) : the iteration stops as soon as
+                    the norm of the residual drops below tolerance times the
+                    norm of b. It sets to 1e-10 by default.
+                max_iterations (int, optional) : the maximal number of
+                    iterations, the number of rows of a if not given.
+
+            Returns:
+
+            The vector `x` such that `a x = b`, solved using the pipelined
+            conjugate gradient method utilizing the Jacobi (diagonal)
+            preconditioner. The result is tiled like the rows of a.)"
+        },
+        execution_tree::match_pattern_type{"iterative_solver_gmres_d",
+            std::vector<std::string>{R"(
+                iterative_solver_gmres_d(
+                    _1_a,
+                    _2_b,
+                    __arg(_3_restart, 30),
+                    __arg(_4_tolerance, 1e-10),
+                    __arg(_5_max_iterations, 0)
+                )
+            )"},
+            &create_dist_iterative_solver,
+            &execution_tree::create_primitive<dist_iterative_solver>, R"(
+            a, b, restart, tolerance, max_iterations
+            Args:
+
+                a (matrix) : a square matrix tiled by rows, every locality
+                    holds all columns of its rows
+                b (vector) : the right hand side, either tiled like the rows
+                    of a or available on all localities
+                restart (int, optional) : the number of iterations after
+                    which the method is restarted. It sets to 30 by default.
+                tolerance (float, optional) : the iteration stops as soon as
+                    the norm of the residual drops below tolerance times the
+                    norm of b. It sets to 1e-10 by default.
+                max_iterations (int, optional) : the maximal overall number of
+                    iterations, the number of rows of a if not given.
+
+            Returns:
+
+            The vector `x` such that `a x = b`, solved using the restarted
+            GMRES method. The result is tiled like the rows of a.)"
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    dist_iterative_solver::solver_type extract_solver_type(
+        std::string const& name)
+    {
+        dist_iterative_solver::solver_type result =
+            dist_iterative_solver::solver_cg;
+
+        if (name.find("iterative_solver_cg_jacobi_d") != std::string::npos)
+        {
+            result = dist_iterative_solver::solver_cg_jacobi;
+        }
+        else if (name.find("iterative_solver_gmres_d") != std::string::npos)
+        {
+            result = dist_iterative_solver::solver_gmres;
+        }
+        return result;
+    }
+
+    dist_iterative_solver::dist_iterative_solver(
+        execution_tree::primitive_arguments_type&& operands,
+        std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+      , solver_(extract_solver_type(name_))
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // Information about the row tiles of the matrix, shared by all
+        // collective operations of one solve
+        struct row_tiled_system
+        {
+            std::size_t num_sites_;
+            std::uint32_t this_site_;
+            std::string basename_;
+            std::vector<execution_tree::tiling_span> row_spans_;
+            std::size_t size_;          // overall number of rows
+            std::size_t generation_;    // generation of the last collective
+
+            // Make the local parts of a vector available on all localities
+            // and sum up the given partial scalar products. Both are
+            // exchanged using a single collective operation. Returns the
+            // full vector, sums is replaced by the overall sums.
+            blaze::DynamicVector<double> gather(
+                blaze::DynamicVector<double> const& local_part,
+                blaze::DynamicVector<double>& sums)
+            {
+                return exchange(local_part, sums, true);
+            }
+
+            // Sum up the given partial scalar products
+            void reduce(blaze::DynamicVector<double>& sums)
+            {
+                exchange(blaze::DynamicVector<double>{}, sums, false);
+            }
+
+        private:
+            blaze::DynamicVector<double> exchange(
+                blaze::DynamicVector<double> const& local_part,
+                blaze::DynamicVector<double>& sums, bool with_vector)
+            {
+                if (num_sites_ == 1)
+                {
+                    return local_part;
+                }
+
+                std::size_t const local_size = local_part.size();
+                std::size_t const num_sums = sums.size();
+
+                blaze::DynamicVector<double> data(local_size + num_sums);
+                blaze::subvector(data, 0, local_size) = local_part;
+                blaze::subvector(data, local_size, num_sums) = sums;
+
+                auto all_data = hpx::collectives::all_gather(
+                    basename_.c_str(), std::move(data),
+                    hpx::collectives::num_sites_arg{num_sites_},
+                    hpx::collectives::this_site_arg{this_site_},
+                    hpx::collectives::generation_arg{++generation_})
+                    .get();
+
+                // the partial sums are added in the same order everywhere,
+                // all localities see exactly the same results
+                blaze::DynamicVector<double> result(with_vector ? size_ : 0);
+                sums = 0.0;
+                for (std::size_t site = 0; site != num_sites_; ++site)
+                {
+                    auto const& site_data = all_data[site];
+                    std::size_t part = 0;
+                    if (with_vector)
+                    {
+                        part = row_spans_[site].size();
+                        blaze::subvector(
+                            result, row_spans_[site].start_, part) =
+                            blaze::subvector(site_data, 0, part);
+                    }
+                    sums += blaze::subvector(site_data, part, num_sums);
+                }
+                return result;
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Preconditioned pipelined conjugate gradient method (P. Ghysels,
+        // W. Vanroose, Hiding global synchronization latency in the
+        // preconditioned Conjugate Gradient algorithm, 2014). The scalar
+        // products of an iteration are reduced together with the gathering
+        // of the vector the next matrix vector product is applied to. An
+        // empty inv_diag disables the preconditioner.
+        blaze::DynamicVector<double> pipelined_cg(row_tiled_system& system,
+            blaze::DynamicMatrix<double> const& a,
+            blaze::DynamicVector<double> const& b,
+            blaze::DynamicVector<double> const& inv_diag, double tolerance,
+            std::size_t max_iterations)
+        {
+            std::size_t const local_size = b.size();
+
+            auto precondition = [&](blaze::DynamicVector<double> const& v)
+                -> blaze::DynamicVector<double> {
+                if (inv_diag.size() == 0)
+                {
+                    return v;
+                }
+                return inv_diag * v;
+            };
+
+            blaze::DynamicVector<double> x(local_size, 0.0);
+            blaze::DynamicVector<double> r = b;
+            blaze::DynamicVector<double> u = precondition(r);
+
+            blaze::DynamicVector<double> no_sums;
+            blaze::DynamicVector<double> w = a * system.gather(u, no_sums);
+
+            blaze::DynamicVector<double> z(local_size, 0.0);
+            blaze::DynamicVector<double> q(local_size, 0.0);
+            blaze::DynamicVector<double> s(local_size, 0.0);
+            blaze::DynamicVector<double> p(local_size, 0.0);
+
+            double const tolerance2 = tolerance * tolerance;
+            double norm_b2 = 0.0;
+            double gamma_prev = 0.0;
+            double alpha_prev = 0.0;
+
+            for (std::size_t i = 0; i != max_iterations; ++i)
+            {
+                blaze::DynamicVector<double> m = precondition(w);
+
+                blaze::DynamicVector<double> sums{
+                    blaze::dot(r, u), blaze::dot(w, u), blaze::dot(r, r)};
+                blaze::DynamicVector<double> n = a * system.gather(m, sums);
+
+                double const gamma = sums[0];
+                double const delta = sums[1];
+                double const norm_r2 = sums[2];
+
+                if (i == 0)
+                {
+                    norm_b2 = norm_r2;
+                }
+                if (norm_r2 <= tolerance2 * norm_b2 || gamma == 0.0)
+                {
+                    break;
+                }
+
+                double beta = 0.0;
+                double denominator = delta;
+                if (i != 0)
+                {
+                    beta = gamma / gamma_prev;
+                    denominator -= beta * gamma / alpha_prev;
+                }
+                if (denominator == 0.0)
+                {
+                    break;      // breakdown, a is not positive definite
+                }
+                double const alpha = gamma / denominator;
+
+                z = n + beta * z;
+                q = m + beta * q;
+                s = w + beta * s;
+                p = u + beta * p;
+
+                x += alpha * p;
+                r -= alpha * s;
+                u -= alpha * q;
+                w -= alpha * z;
+
+                gamma_prev = gamma;
+                alpha_prev = alpha;
+            }
+
+            return x;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Restarted GMRES using classical Gram-Schmidt orthogonalization,
+        // the scalar products of one iteration are reduced at once. The
+        // Krylov basis is needed in full for the matrix vector products, so
+        // the solution is accumulated in full as well.
+        blaze::DynamicVector<double> restarted_gmres(row_tiled_system& system,
+            blaze::DynamicMatrix<double> const& a,
+            blaze::DynamicVector<double> const& b, std::size_t restart,
+            double tolerance, std::size_t max_iterations)
+        {
+            std::size_t const size = system.size_;
+            std::size_t const local_size = b.size();
+            std::size_t const row_start =
+                system.row_spans_[system.this_site_].start_;
+
+            blaze::DynamicVector<double> norm_b2{blaze::dot(b, b)};
+            system.reduce(norm_b2);
+            double const target = tolerance * std::sqrt(norm_b2[0]);
+
+            blaze::DynamicVector<double> x(size, 0.0);
+            blaze::DynamicMatrix<double, blaze::columnMajor> v(
+                size, restart + 1);
+            blaze::DynamicMatrix<double> h(restart + 1, restart);
+            blaze::DynamicVector<double> cs(restart);
+            blaze::DynamicVector<double> sn(restart);
+            blaze::DynamicVector<double> g(restart + 1);
+
+            std::size_t iteration = 0;
+            bool converged = false;
+            while (!converged && iteration != max_iterations)
+            {
+                blaze::DynamicVector<double> r = b - a * x;
+                blaze::DynamicVector<double> norm_r2{blaze::dot(r, r)};
+                blaze::column(v, 0) = system.gather(r, norm_r2);
+
+                double const beta = std::sqrt(norm_r2[0]);
+                if (beta <= target)
+                {
+                    break;
+                }
+
+                blaze::column(v, 0) /= beta;
+                h = 0.0;
+                g = 0.0;
+                g[0] = beta;
+
+                std::size_t k = 0;
+                while (k != restart && iteration != max_iterations)
+                {
+                    // orthogonalize A v_k against the basis
+                    blaze::DynamicVector<double> w = a * blaze::column(v, k);
+                    auto v_local =
+                        blaze::submatrix(v, row_start, 0, local_size, k + 1);
+
+                    blaze::DynamicVector<double> hk = blaze::trans(v_local) * w;
+                    system.reduce(hk);
+                    w -= v_local * hk;
+
+                    blaze::DynamicVector<double> norm_w2{blaze::dot(w, w)};
+                    blaze::column(v, k + 1) = system.gather(w, norm_w2);
+
+                    double const h_next = std::sqrt(norm_w2[0]);
+                    if (h_next != 0.0)
+                    {
+                        blaze::column(v, k + 1) /= h_next;
+                    }
+
+                    for (std::size_t i = 0; i != k + 1; ++i)
+                    {
+                        h(i, k) = hk[i];
+                    }
+                    h(k + 1, k) = h_next;
+
+                    // apply the previous Givens rotations to the new column
+                    // and compute the rotation eliminating h(k + 1, k)
+                    for (std::size_t i = 0; i != k; ++i)
+                    {
+                        double const temp =
+                            cs[i] * h(i, k) + sn[i] * h(i + 1, k);
+                        h(i + 1, k) = -sn[i] * h(i, k) + cs[i] * h(i + 1, k);
+                        h(i, k) = temp;
+                    }
+
+                    double const denominator = std::hypot(h(k, k), h_next);
+                    cs[k] = denominator != 0.0 ? h(k, k) / denominator : 1.0;
+                    sn[k] = denominator != 0.0 ? h_next / denominator : 0.0;
+                    h(k, k) = denominator;
+                    h(k + 1, k) = 0.0;
+
+                    g[k + 1] = -sn[k] * g[k];
+                    g[k] = cs[k] * g[k];
+
+                    ++k;
+                    ++iteration;
+
+                    if (std::abs(g[k]) <= target || h_next == 0.0)
+                    {
+                        converged = true;
+                        break;
+                    }
+                }
+
+                // solve the upper triangular system H y = g and update the
+                // solution
+                blaze::DynamicVector<double> y(k);
+                for (std::size_t i = k; i-- != 0;)
+                {
+                    double sum = g[i];
+                    for (std::size_t j = i + 1; j != k; ++j)
+                    {
+                        sum -= h(i, j) * y[j];
+                    }
+                    y[i] = h(i, i) != 0.0 ? sum / h(i, i) : 0.0;
+                }
+                x += blaze::submatrix(v, 0, 0, size, k) * y;
+            }
+
+            return blaze::subvector(x, row_start, local_size);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    execution_tree::primitive_argument_type dist_iterative_solver::calculate(
+        execution_tree::primitive_arguments_type&& args) const
+    {
+        using namespace execution_tree;
+
+        bool const distributed = args[0].has_annotation();
+
+        localities_information locs =
+            extract_localities_information(args[0], name_, codename_);
+
+        if (locs.num_dimensions() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_iterative_solver::calculate",
+                generate_error_message(
+                    "the first argument must be a matrix tiled by rows"));
+        }
+
+        std::size_t const size = locs.rows(name_, codename_);
+        if (locs.columns(name_, codename_) != size)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_iterative_solver::calculate",
+                generate_error_message("the matrix must be square"));
+        }
+
+        // collect the row spans of all localities
+        detail::row_tiled_system system{locs.locality_.num_localities_,
+            locs.locality_.locality_id_,
+            "iterative_solver_d_" + locs.annotation_.name_,
+            std::vector<tiling_span>(locs.locality_.num_localities_), size,
+            0};
+
+        for (std::size_t loc = 0; loc != locs.tiles_.size(); ++loc)
+        {
+            if (locs.tiles_[loc].dimension() == 0)
+            {
+                continue;   // this locality does not hold any rows
+            }
+
+            tiling_information_2d tile(locs.tiles_[loc], name_, codename_);
+            if (tile.spans_[1].start_ != 0 ||
+                tile.spans_[1].stop_ != std::int64_t(size))
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_iterative_solver::calculate",
+                    generate_error_message(
+                        "the matrix must be tiled by rows, every locality "
+                        "has to hold all columns of its rows"));
+            }
+            system.row_spans_[loc] = tile.spans_[0];
+        }
+
+        tiling_span const& local_span = system.row_spans_[system.this_site_];
+
+        auto lhs = extract_numeric_value(std::move(args[0]), name_, codename_);
+        blaze::DynamicMatrix<double> a = lhs.matrix();
+
+        // the right hand side is either tiled like the rows of the matrix or
+        // available in full
+        blaze::DynamicVector<double> b;
+        if (args[1].has_annotation())
+        {
+            localities_information rhs_locs =
+                extract_localities_information(args[1], name_, codename_);
+
+            std::size_t const span_index = rhs_locs.has_span(0) ? 0 : 1;
+            if (rhs_locs.num_dimensions() != 1 ||
+                !rhs_locs.has_span(span_index) ||
+                rhs_locs.get_span(span_index).start_ != local_span.start_ ||
+                rhs_locs.get_span(span_index).stop_ != local_span.stop_)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_iterative_solver::calculate",
+                    generate_error_message(
+                        "a distributed right hand side must be a vector "
+                        "tiled like the rows of the matrix"));
+            }
+            b = extract_numeric_value(std::move(args[1]), name_, codename_)
+                    .vector();
+        }
+        else
+        {
+            auto rhs =
+                extract_numeric_value(std::move(args[1]), name_, codename_);
+            if (rhs.num_dimensions() != 1 || rhs.size() != size)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_iterative_solver::calculate",
+                    generate_error_message(
+                        "the right hand side must be a vector with as many "
+                        "elements as the matrix has rows"));
+            }
+            b = blaze::subvector(
+                rhs.vector(), local_span.start_, local_span.size());
+        }
+
+        std::size_t arg_index = 2;
+        std::size_t restart = 30;
+        if (solver_ == solver_gmres)
+        {
+            if (valid(args[arg_index]))
+            {
+                restart = extract_scalar_positive_integer_value_strict(
+                    std::move(args[arg_index]), name_, codename_);
+            }
+            ++arg_index;
+        }
+
+        double tolerance = 1e-10;
+        if (valid(args[arg_index]))
+        {
+            tolerance = extract_scalar_numeric_value(
+                std::move(args[arg_index]), name_, codename_);
+        }
+        ++arg_index;
+
+        std::size_t max_iterations = size;
+        if (valid(args[arg_index]))
+        {
+            std::int64_t iterations = extract_scalar_integer_value_strict(
+                std::move(args[arg_index]), name_, codename_);
+            if (iterations > 0)
+            {
+                max_iterations = std::size_t(iterations);
+            }
+        }
+
+        blaze::DynamicVector<double> x;
+        switch (solver_)
+        {
+        case solver_cg:
+            x = detail::pipelined_cg(system, a, b,
+                blaze::DynamicVector<double>{}, tolerance, max_iterations);
+            break;
+
+        case solver_cg_jacobi:
+            {
+                blaze::DynamicVector<double> inv_diag(a.rows());
+                for (std::size_t i = 0; i != a.rows(); ++i)
+                {
+                    double const diag = a(i, local_span.start_ + i);
+                    if (diag == 0.0)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                            "dist_iterative_solver::calculate",
+                            generate_error_message(
+                                "the Jacobi preconditioner requires all "
+                                "diagonal elements to be non-zero"));
+                    }
+                    inv_diag[i] = 1.0 / diag;
+                }
+                x = detail::pipelined_cg(
+                    system, a, b, inv_diag, tolerance, max_iterations);
+            }
+            break;
+
+        case solver_gmres:
+            x = detail::restarted_gmres(
+                system, a, b, restart, tolerance, max_iterations);
+            break;
+        }
+
+        primitive_argument_type result{std::move(x)};
+        if (distributed)
+        {
+            // the result is tiled like the rows of the matrix
+            tiling_information_1d tile_info(
+                tiling_information_1d::columns, local_span);
+
+            ++locs.annotation_.generation_;
+
+            auto locality_ann = locs.locality_.as_annotation();
+            result.set_annotation(
+                localities_annotation(locality_ann,
+                    tile_info.as_annotation(name_, codename_),
+                    locs.annotation_, name_, codename_),
+                name_, codename_);
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<execution_tree::primitive_argument_type>
+    dist_iterative_solver::eval(
+        execution_tree::primitive_arguments_type const& operands,
+        execution_tree::primitive_arguments_type const& args,
+        execution_tree::eval_context ctx) const
+    {
+        std::size_t const max_operands = solver_ == solver_gmres ? 5 : 4;
+        if (operands.size() < 2 || operands.size() > max_operands)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_iterative_solver::eval",
+                generate_error_message(
+                    "the distributed iterative solver primitives require at "
+                    "least two operands"));
+        }
+
+        if (!valid(operands[0]) || !valid(operands[1]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_iterative_solver::eval",
+                generate_error_message(
+                    "the distributed iterative solver primitives require "
+                    "that the arguments given by the operands array are "
+                    "valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync,
+            hpx::unwrapping(
+                [this_ = std::move(this_)](
+                    execution_tree::primitive_arguments_type&& args)
+                    -> execution_tree::primitive_argument_type
+                {
+                    args.resize(this_->solver_ == solver_gmres ? 5 : 4);
+                    return this_->calculate(std::move(args));
+                }),
+            execution_tree::primitives::detail::map_operands(operands,
+                execution_tree::functional::value_operand{}, args, name_,
+                codename_, std::move(ctx)));
+    }
+}}}
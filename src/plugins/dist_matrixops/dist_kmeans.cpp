@@ -0,0 +1,221 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/kmeans_operations.hpp>
+#include <phylanx/plugins/dist_matrixops/dist_kmeans.hpp>
+#include <phylanx/util/serialization/blaze.hpp>
+
+#include <hpx/collectives/all_reduce.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/util.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace dist_matrixops { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    execution_tree::match_pattern_type const dist_kmeans::match_data =
+    {
+        hpx::make_tuple("kmeans_d", std::vector<std::string>{R"(
+                kmeans_d(
+                    _1_points,
+                    _2_initial_centroids,
+                    __arg(_3_iterations, 10),
+                    __arg(_4_tolerance, 0.0)
+                )
+            )"},
+            &create_dist_kmeans,
+            &execution_tree::create_primitive<dist_kmeans>, R"(
+            points, initial_centroids, iterations, tolerance
+            Args:
+
+                points (matrix): a (possibly row-tiled) distributed matrix.
+                    Each row represents a point, each column represents a
+                    feature. Every locality holds a tile consisting of all
+                    columns of some of the rows.
+                initial_centroids (matrix): the initial centroids, a matrix
+                    with one row per centroid and as many columns as points.
+                    All localities have to use the same initial centroids.
+                iterations (int, optional): the maximal number of iterations.
+                    It sets to 10 by default.
+                tolerance (float, optional): the iteration stops as soon as
+                    no centroid has moved by more than this distance. It sets
+                    to 0.0 by default.
+
+            Returns:
+
+            The centroids of the clusters given the distributed points matrix.
+            The result is identical on all localities.)")
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    dist_kmeans::dist_kmeans(
+        execution_tree::primitive_arguments_type&& operands,
+        std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    blaze::DynamicMatrix<double> dist_kmeans::all_reduce_sums(
+        blaze::DynamicMatrix<double>&& sums, std::size_t iteration,
+        execution_tree::localities_information const& locs) const
+    {
+        if (locs.locality_.num_localities_ == 1)
+        {
+            return std::move(sums);
+        }
+
+        // the per-centroid sums and counts are the only data exchanged
+        return hpx::collectives::all_reduce(
+            ("all_reduce_kmeans_" + locs.annotation_.name_).c_str(),
+            std::move(sums), std::plus<blaze::DynamicMatrix<double>>{},
+            hpx::collectives::num_sites_arg{locs.locality_.num_localities_},
+            hpx::collectives::this_site_arg{locs.locality_.locality_id_},
+            hpx::collectives::generation_arg{iteration + 1})
+            .get();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    execution_tree::primitive_argument_type dist_kmeans::calculate_kmeans(
+        execution_tree::primitive_arguments_type&& args) const
+    {
+        using namespace execution_tree;
+
+        localities_information locs =
+            extract_localities_information(args[0], name_, codename_);
+
+        if (locs.num_dimensions() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_kmeans::calculate_kmeans",
+                generate_error_message(
+                    "the kmeans_d primitive requires for the first argument, "
+                    "points, to represent a matrix"));
+        }
+
+        auto arg0 = extract_numeric_value(std::move(args[0]), name_, codename_);
+        auto const points = arg0.matrix();
+
+        if (points.columns() != locs.columns(name_, codename_))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_kmeans::calculate_kmeans",
+                generate_error_message(
+                    "the kmeans_d primitive requires for the points to be "
+                    "tiled along the rows only"));
+        }
+
+        auto arg1 = extract_numeric_value(std::move(args[1]), name_, codename_);
+        if (arg1.num_dimensions() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_kmeans::calculate_kmeans",
+                generate_error_message(
+                    "the kmeans_d primitive requires for the "
+                    "initial_centroids to represent a matrix"));
+        }
+
+        blaze::DynamicMatrix<double> centroids = arg1.matrix();
+        if (centroids.rows() == 0 || centroids.columns() != points.columns())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_kmeans::calculate_kmeans",
+                generate_error_message(
+                    "the kmeans_d primitive requires for the "
+                    "initial_centroids to have at least one row and as many "
+                    "columns as the points"));
+        }
+
+        std::size_t iterations = 10;
+        if (valid(args[2]))
+        {
+            iterations = extract_scalar_positive_integer_value_strict(
+                std::move(args[2]), name_, codename_);
+        }
+
+        double tolerance = 0.0;
+        if (valid(args[3]))
+        {
+            tolerance = extract_scalar_numeric_value(
+                std::move(args[3]), name_, codename_);
+        }
+
+        std::size_t num_centroids = centroids.rows();
+        double const max_shift = tolerance * tolerance;
+
+        for (std::size_t i = 0; i != iterations; ++i)
+        {
+            auto closest = common::kmeans_closest_centroids(points, centroids);
+            auto sums = all_reduce_sums(
+                common::kmeans_accumulate(points, closest, num_centroids), i,
+                locs);
+
+            auto moved = common::kmeans_move_centroids(sums, centroids);
+            double shift = common::kmeans_max_shift(centroids, moved);
+
+            centroids = std::move(moved);
+
+            // all localities see the same centroids, so they all stop after
+            // the same iteration
+            if (shift <= max_shift)
+            {
+                break;
+            }
+        }
+
+        return primitive_argument_type{std::move(centroids)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<execution_tree::primitive_argument_type> dist_kmeans::eval(
+        execution_tree::primitive_arguments_type const& operands,
+        execution_tree::primitive_arguments_type const& args,
+        execution_tree::eval_context ctx) const
+    {
+        if (operands.size() < 2 || operands.size() > 4)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, "dist_kmeans::eval",
+                generate_error_message(
+                    "the kmeans_d primitive requires at least two and at "
+                    "most four operands"));
+        }
+
+        if (!valid(operands[0]) || !valid(operands[1]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, "dist_kmeans::eval",
+                generate_error_message(
+                    "the kmeans_d primitive requires that the arguments "
+                    "given by the operands array are valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync,
+            hpx::unwrapping(
+                [this_ = std::move(this_)](
+                    execution_tree::primitive_arguments_type&& args)
+                    -> execution_tree::primitive_argument_type
+                {
+                    return this_->calculate_kmeans(std::move(args));
+                }),
+            execution_tree::primitives::detail::map_operands(operands,
+                execution_tree::functional::value_operand{}, args, name_,
+                codename_, std::move(ctx)));
+    }
+}}}
@@ -28,9 +28,23 @@ PHYLANX_REGISTER_PLUGIN_FACTORY(dist_dot_operation_plugin,
 PHYLANX_REGISTER_PLUGIN_FACTORY(dist_identity_plugin,
     phylanx::dist_matrixops::primitives::dist_identity::match_data)
 PHYLANX_REGISTER_PLUGIN_FACTORY(dist_inverse_operation_plugin,
-    phylanx::dist_matrixops::primitives::dist_inverse::match_data);
+    phylanx::dist_matrixops::primitives::dist_inverse::match_data[0]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(dist_linear_solver_lu_plugin,
+    phylanx::dist_matrixops::primitives::dist_inverse::match_data[1]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(dist_conjugate_gradient_plugin,
+    phylanx::dist_matrixops::primitives::dist_iterative_solver::match_data[0]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(dist_cg_jacobi_plugin,
+    phylanx::dist_matrixops::primitives::dist_iterative_solver::match_data[1]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(dist_gmres_plugin,
+    phylanx::dist_matrixops::primitives::dist_iterative_solver::match_data[2]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(dist_kmeans_plugin,
+    phylanx::dist_matrixops::primitives::dist_kmeans::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(dist_random_plugin,
     phylanx::dist_matrixops::primitives::dist_random::match_data)
+PHYLANX_REGISTER_PLUGIN_FACTORY(dist_sort_plugin,
+    phylanx::dist_matrixops::primitives::dist_sort::match_data[0]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(dist_argsort_plugin,
+    phylanx::dist_matrixops::primitives::dist_sort::match_data[1]);
 PHYLANX_REGISTER_PLUGIN_FACTORY(dist_transpose_operation_plugin,
     phylanx::dist_matrixops::primitives::dist_transpose_operation::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(retile_annotations_plugin,
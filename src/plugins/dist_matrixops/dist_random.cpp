@@ -79,7 +79,8 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
             Returns:
 
             A part of an array of random numbers on tile_index-th tile out of
-            numtiles using the normal distribution)")
+            numtiles using the normal distribution. For a given seed (see
+            set_seed) the overall array does not depend on numtiles.)")
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -134,11 +135,15 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 tile_info.as_annotation(name_, codename_), ann_info, name_,
                 codename_));
 
+        // the elements are generated based on their global index, thus the
+        // overall array does not depend on the number of tiles
+        util::random_stream stream = util::next_random_stream();
+
         blaze::DynamicVector<double> v(size);
-        for (std::size_t i = 0; i != size; ++i)
-        {
-            v[i] = dist(util::rng_);
-        }
+        util::random_for_each(
+            size, dist, [&](std::normal_distribution<>& d, std::size_t i) {
+                v[i] = util::random_element(d, stream, start + i);
+            });
 
         return primitive_argument_type(std::move(v), attached_annotation);
     }
@@ -181,14 +186,18 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 locality_ann, tile_info.as_annotation(name_, codename_),
                 ann_info, name_, codename_));
 
+        // the elements are generated based on their global index, thus the
+        // overall array does not depend on the number of tiles
+        util::random_stream stream = util::next_random_stream();
+
         blaze::DynamicMatrix<double> m(row_size, column_size);
-        for (std::size_t i = 0; i != row_size; ++i)
-        {
-            for (std::size_t j = 0; j != column_size; ++j)
-            {
-                m(i, j) = dist(util::rng_);
-            }
-        }
+        util::random_for_each(row_size * column_size, dist,
+            [&](std::normal_distribution<>& d, std::size_t index) {
+                std::size_t const i = index / column_size;
+                std::size_t const j = index % column_size;
+                m(i, j) = util::random_element(d, stream,
+                    (row_start + i) * columns + column_start + j);
+            });
 
         return primitive_argument_type(std::move(m), attached_annotation);
     }
@@ -233,17 +242,20 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 locality_ann, tile_info.as_annotation(name_, codename_),
                 ann_info, name_, codename_));
 
+        // the elements are generated based on their global index, thus the
+        // overall array does not depend on the number of tiles
+        util::random_stream stream = util::next_random_stream();
+
         blaze::DynamicTensor<double> t(page_size, row_size, column_size);
-        for (std::size_t k = 0; k != page_size; ++k)
-        {
-            for (std::size_t i = 0; i != row_size; ++i)
-            {
-                for (std::size_t j = 0; j != column_size; ++j)
-                {
-                    t(k, i, j) = dist(util::rng_);
-                }
-            }
-        }
+        util::random_for_each(page_size * row_size * column_size, dist,
+            [&](std::normal_distribution<>& d, std::size_t index) {
+                std::size_t const k = index / (row_size * column_size);
+                std::size_t const i = (index / column_size) % row_size;
+                std::size_t const j = index % column_size;
+                t(k, i, j) = util::random_element(d, stream,
+                    ((page_start + k) * rows + row_start + i) * columns +
+                        column_start + j);
+            });
 
         return primitive_argument_type(std::move(t), attached_annotation);
     }
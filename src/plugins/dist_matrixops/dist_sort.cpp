@@ -0,0 +1,502 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/locality_annotation.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/meta_annotation.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/execution_tree/tiling_annotations.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/dist_matrixops/dist_sort.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+#include <phylanx/util/parallel_sort.hpp>
+#include <phylanx/util/serialization/blaze.hpp>
+
+#include <hpx/assert.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/modules/collectives.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace dist_matrixops { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<execution_tree::match_pattern_type> const
+        dist_sort::match_data =
+    {
+        execution_tree::match_pattern_type{"sort_d",
+            std::vector<std::string>{R"(
+                sort_d(
+                    _1_a,
+                    __arg(_2_kind, "quicksort")
+                )
+            )"},
+            &create_dist_sort,
+            &execution_tree::create_primitive<dist_sort>, R"(
+            a, kind
+            Args:
+
+                a (array) : a vector tiled across the localities
+                kind (optional, {'quicksort', 'mergesort', 'heapsort',
+                    'stable'}): accepted for compatibility with sort(), the
+                    distributed sort is always stable
+
+            Returns:
+
+                The part of the sorted vector held by this locality. The
+                result is tiled by columns, the tiles are ordered by the
+                locality ids.)"
+        },
+        execution_tree::match_pattern_type{"argsort_d",
+            std::vector<std::string>{R"(
+                argsort_d(
+                    _1_a,
+                    __arg(_2_kind, "quicksort")
+                )
+            )"},
+            &create_dist_sort,
+            &execution_tree::create_primitive<dist_sort>, R"(
+            a, kind
+            Args:
+
+                a (array) : a vector tiled across the localities
+                kind (optional, {'quicksort', 'mergesort', 'heapsort',
+                    'stable'}): accepted for compatibility with argsort(),
+                    the distributed sort is always stable
+
+            Returns:
+
+                The part of the (global) indices that sort the vector held by
+                this locality. The result is tiled by columns, the tiles are
+                ordered by the locality ids.)"
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    dist_sort::sort_mode extract_sort_mode(std::string const& name)
+    {
+        dist_sort::sort_mode result = dist_sort::sort_mode_values;
+
+        if (name.find("argsort_d") != std::string::npos)
+        {
+            result = dist_sort::sort_mode_indices;
+        }
+        return result;
+    }
+
+    dist_sort::dist_sort(execution_tree::primitive_arguments_type&& operands,
+        std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+      , mode_(extract_sort_mode(name_))
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    execution_tree::primitive_argument_type dist_sort::sort1d_local(
+        ir::node_data<T>&& arg) const
+    {
+        if (mode_ == sort_mode_values)
+        {
+            blaze::DynamicVector<T> result = arg.vector();
+            util::parallel_sort(result.begin(), result.end(), true);
+            return execution_tree::primitive_argument_type{std::move(result)};
+        }
+
+        auto v = arg.vector();
+        blaze::DynamicVector<std::int64_t> result(v.size());
+        std::iota(result.begin(), result.end(), 0);
+        util::parallel_sort(result.begin(), result.end(),
+            [&v](std::int64_t a, std::int64_t b) { return v[a] < v[b]; },
+            true);
+        return execution_tree::primitive_argument_type{std::move(result)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sample sort of a vector tiled across all localities. The elements are
+    // ordered by (value, global index), which makes all keys unique. This
+    // keeps the sort stable and lets the splitters separate runs of equal
+    // values, which would otherwise end up on a single locality.
+    template <typename T>
+    execution_tree::primitive_argument_type dist_sort::sort1d_distributed(
+        ir::node_data<T>&& arg,
+        execution_tree::localities_information&& locs) const
+    {
+        using namespace execution_tree;
+
+        using key_type = std::pair<T, std::int64_t>;
+
+        std::size_t const num_sites = locs.locality_.num_localities_;
+        std::uint32_t const this_site = locs.locality_.locality_id_;
+        std::size_t const generation =
+            static_cast<std::size_t>(locs.annotation_.generation_ + 1);
+        std::string const basename = (mode_ == sort_mode_values ?
+            "sort_d_" : "argsort_d_") + locs.annotation_.name_;
+
+        // sort the local tile
+        blaze::DynamicVector<T> values;
+        std::int64_t offset = 0;
+        if (locs.num_dimensions() != 0)
+        {
+            values = arg.vector();
+
+            std::size_t span_index = 0;
+            if (!locs.has_span(0))
+            {
+                HPX_ASSERT(locs.has_span(1));
+                span_index = 1;
+            }
+            offset = locs.get_span(span_index).start_;
+        }
+
+        std::size_t const size = values.size();
+
+        std::vector<key_type> keys(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            keys[i] = key_type(values[i], offset + std::int64_t(i));
+        }
+        util::parallel_sort(keys.begin(), keys.end());
+
+        // select num_sites - 1 regular samples from the sorted tile, the
+        // splitters are chosen from the samples of all localities
+        blaze::DynamicVector<T> sample_values(size != 0 ? num_sites - 1 : 0);
+        blaze::DynamicVector<std::int64_t> sample_indices(sample_values.size());
+        for (std::size_t k = 0; k != sample_values.size(); ++k)
+        {
+            key_type const& key = keys[(k + 1) * size / num_sites];
+            sample_values[k] = key.first;
+            sample_indices[k] = key.second;
+        }
+
+        auto all_sample_values = hpx::collectives::all_gather(
+            ("sample_values_" + basename).c_str(), std::move(sample_values),
+            hpx::collectives::num_sites_arg{num_sites},
+            hpx::collectives::this_site_arg{this_site},
+            hpx::collectives::generation_arg{generation});
+
+        auto all_sample_indices = hpx::collectives::all_gather(
+            ("sample_indices_" + basename).c_str(), std::move(sample_indices),
+            hpx::collectives::num_sites_arg{num_sites},
+            hpx::collectives::this_site_arg{this_site},
+            hpx::collectives::generation_arg{generation});
+
+        std::vector<key_type> samples;
+        {
+            auto gathered_values = all_sample_values.get();
+            auto gathered_indices = all_sample_indices.get();
+            for (std::size_t j = 0; j != num_sites; ++j)
+            {
+                for (std::size_t k = 0; k != gathered_values[j].size(); ++k)
+                {
+                    samples.emplace_back(
+                        gathered_values[j][k], gathered_indices[j][k]);
+                }
+            }
+        }
+        std::sort(samples.begin(), samples.end());
+
+        // split the sorted tile into one bucket per locality, bucket j
+        // receives the keys in (splitter[j - 1], splitter[j]]
+        std::vector<std::size_t> bounds(num_sites + 1, size);
+        bounds[0] = 0;
+        if (!samples.empty())
+        {
+            for (std::size_t j = 1; j != num_sites; ++j)
+            {
+                key_type const& splitter =
+                    samples[j * samples.size() / num_sites];
+                bounds[j] = std::upper_bound(keys.begin() + bounds[j - 1],
+                                keys.end(), splitter) - keys.begin();
+            }
+        }
+
+        std::vector<blaze::DynamicVector<T>> send_values(num_sites);
+        std::vector<blaze::DynamicVector<std::int64_t>> send_indices(
+            mode_ == sort_mode_indices ? num_sites : 0);
+        for (std::size_t j = 0; j != num_sites; ++j)
+        {
+            std::size_t const bucket_size = bounds[j + 1] - bounds[j];
+
+            send_values[j].resize(bucket_size, false);
+            for (std::size_t i = 0; i != bucket_size; ++i)
+            {
+                send_values[j][i] = keys[bounds[j] + i].first;
+            }
+
+            if (mode_ == sort_mode_indices)
+            {
+                send_indices[j].resize(bucket_size, false);
+                for (std::size_t i = 0; i != bucket_size; ++i)
+                {
+                    send_indices[j][i] = keys[bounds[j] + i].second;
+                }
+            }
+        }
+        keys.clear();
+
+        // exchange the buckets, locality j receives bucket j of all others
+        auto received_values = hpx::collectives::all_to_all(
+            ("values_" + basename).c_str(), std::move(send_values),
+            hpx::collectives::num_sites_arg{num_sites},
+            hpx::collectives::this_site_arg{this_site},
+            hpx::collectives::generation_arg{generation});
+
+        hpx::future<std::vector<blaze::DynamicVector<std::int64_t>>>
+            received_indices;
+        if (mode_ == sort_mode_indices)
+        {
+            received_indices = hpx::collectives::all_to_all(
+                ("indices_" + basename).c_str(), std::move(send_indices),
+                hpx::collectives::num_sites_arg{num_sites},
+                hpx::collectives::this_site_arg{this_site},
+                hpx::collectives::generation_arg{generation});
+        }
+
+        // the received buckets are sorted runs, merge them
+        std::vector<blaze::DynamicVector<T>> runs = received_values.get();
+
+        std::size_t total_size = 0;
+        std::vector<std::size_t> run_bounds;
+        run_bounds.reserve(num_sites + 1);
+        for (auto const& run : runs)
+        {
+            run_bounds.push_back(total_size);
+            total_size += run.size();
+        }
+        run_bounds.push_back(total_size);
+
+        auto local_sizes = hpx::collectives::all_gather(
+            ("sizes_" + basename).c_str(), total_size,
+            hpx::collectives::num_sites_arg{num_sites},
+            hpx::collectives::this_site_arg{this_site},
+            hpx::collectives::generation_arg{generation});
+
+        primitive_argument_type result;
+        if (mode_ == sort_mode_values)
+        {
+            blaze::DynamicVector<T> merged(total_size);
+            std::vector<typename blaze::DynamicVector<T>::Iterator> chunks;
+            chunks.reserve(num_sites + 1);
+            for (std::size_t j = 0; j != num_sites; ++j)
+            {
+                std::copy(runs[j].begin(), runs[j].end(),
+                    merged.begin() + run_bounds[j]);
+                chunks.push_back(merged.begin() + run_bounds[j]);
+            }
+            chunks.push_back(merged.end());
+
+            // runs from different localities holding equal values are
+            // indistinguishable, merging by value is sufficient
+            util::merge_sorted_chunks(chunks, std::less<T>{});
+
+            result = primitive_argument_type{std::move(merged)};
+        }
+        else
+        {
+            std::vector<blaze::DynamicVector<std::int64_t>> indices =
+                received_indices.get();
+
+            std::vector<key_type> merged(total_size);
+            std::vector<typename std::vector<key_type>::iterator> chunks;
+            chunks.reserve(num_sites + 1);
+            for (std::size_t j = 0; j != num_sites; ++j)
+            {
+                for (std::size_t i = 0; i != runs[j].size(); ++i)
+                {
+                    merged[run_bounds[j] + i] =
+                        key_type(runs[j][i], indices[j][i]);
+                }
+                chunks.push_back(merged.begin() + run_bounds[j]);
+            }
+            chunks.push_back(merged.end());
+
+            util::merge_sorted_chunks(chunks, std::less<key_type>{});
+
+            blaze::DynamicVector<std::int64_t> sorted_indices(total_size);
+            for (std::size_t i = 0; i != total_size; ++i)
+            {
+                sorted_indices[i] = merged[i].second;
+            }
+
+            result = primitive_argument_type{std::move(sorted_indices)};
+        }
+
+        // the tiles of the result follow the order of the locality ids
+        std::vector<std::size_t> sizes = local_sizes.get();
+        std::int64_t const start = std::accumulate(
+            sizes.begin(), sizes.begin() + this_site, std::int64_t(0));
+
+        ++locs.annotation_.generation_;
+        tiling_information_1d tile_info(
+            tiling_information_1d::tile1d_type::columns,
+            tiling_span(start, start + std::int64_t(total_size)));
+
+        auto locality_ann = locs.locality_.as_annotation();
+        auto attached_annotation =
+            std::make_shared<annotation>(localities_annotation(locality_ann,
+                tile_info.as_annotation(name_, codename_), locs.annotation_,
+                name_, codename_));
+
+        result.set_annotation(std::move(attached_annotation));
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    execution_tree::primitive_argument_type dist_sort::sort1d(
+        ir::node_data<T>&& arg, execution_tree::localities_information&& locs,
+        bool distributed) const
+    {
+        if (!distributed)
+        {
+            return sort1d_local(std::move(arg));
+        }
+        return sort1d_distributed(std::move(arg), std::move(locs));
+    }
+
+    execution_tree::primitive_argument_type dist_sort::sort1d(
+        execution_tree::primitive_argument_type&& arg) const
+    {
+        using namespace execution_tree;
+
+        bool const distributed = arg.has_annotation();
+
+        localities_information locs;
+        if (distributed)
+        {
+            locs = extract_localities_information(arg, name_, codename_);
+
+            std::size_t ndim = locs.num_dimensions();
+            if (ndim != 1 && ndim != 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter, "dist_sort::sort1d",
+                    generate_error_message(
+                        "the operand has incompatible dimensionalities"));
+            }
+        }
+
+        switch (extract_common_type(arg))
+        {
+        case node_data_type_bool:
+            return sort1d(
+                extract_boolean_value_strict(std::move(arg), name_, codename_),
+                std::move(locs), distributed);
+
+        case node_data_type_int32: HPX_FALLTHROUGH;
+        case node_data_type_int64:
+            return sort1d(
+                extract_integer_value_strict(std::move(arg), name_, codename_),
+                std::move(locs), distributed);
+
+        case node_data_type_unknown:
+            return sort1d(
+                extract_numeric_value(std::move(arg), name_, codename_),
+                std::move(locs), distributed);
+
+        case node_data_type_float32: HPX_FALLTHROUGH;
+        case node_data_type_double:
+            return sort1d(
+                extract_numeric_value_strict(std::move(arg), name_, codename_),
+                std::move(locs), distributed);
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "dist_matrixops::primitives::dist_sort::sort1d",
+            generate_error_message(
+                "the sort_d primitive requires for all arguments to "
+                "be numeric data types"));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<execution_tree::primitive_argument_type> dist_sort::eval(
+        execution_tree::primitive_arguments_type const& operands,
+        execution_tree::primitive_arguments_type const& args,
+        execution_tree::eval_context ctx) const
+    {
+        if (operands.empty() || operands.size() > 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_sort::eval",
+                generate_error_message(
+                    "the sort_d primitive requires one or two operands"));
+        }
+
+        if (!valid(operands[0]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_sort::eval",
+                generate_error_message(
+                    "the sort_d primitive requires the first argument "
+                    "given by the operands array is valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync,
+            hpx::unwrapping(
+                [this_ = std::move(this_)](
+                    execution_tree::primitive_arguments_type&& args)
+                    -> execution_tree::primitive_argument_type
+                {
+                    using namespace execution_tree;
+
+                    if (args.size() > 1 && valid(args[1]))
+                    {
+                        std::string kind = extract_string_value_strict(
+                            std::move(args[1]), this_->name_,
+                            this_->codename_);
+                        if (!util::is_valid_sort_kind(kind))
+                        {
+                            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                                "dist_sort::eval",
+                                this_->generate_error_message(
+                                    "sort algorithm not supported"));
+                        }
+                    }
+
+                    // the local part of an empty tile may be 0-d, the
+                    // dimensionality of the tiles is checked by sort1d
+                    if (args[0].has_annotation())
+                    {
+                        return this_->sort1d(std::move(args[0]));
+                    }
+
+                    switch (extract_numeric_value_dimension(
+                        args[0], this_->name_, this_->codename_))
+                    {
+                    case 1:
+                        return this_->sort1d(std::move(args[0]));
+
+                    default:
+                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                            "dist_sort::eval",
+                            this_->generate_error_message(
+                                "the sort_d primitive supports only "
+                                "vectors"));
+                    }
+                }),
+            execution_tree::primitives::detail::map_operands(operands,
+                execution_tree::functional::value_operand{}, args, name_,
+                codename_, std::move(ctx)));
+    }
+}}}    // namespace phylanx::dist_matrixops::primitives
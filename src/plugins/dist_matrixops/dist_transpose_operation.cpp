@@ -227,12 +227,14 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_boolean_value_strict(std::move(arg), name_, codename_),
                 std::move(localities_info));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return transpose2d(
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 std::move(localities_info));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose2d(
                 extract_numeric_value(std::move(arg), name_, codename_),
@@ -289,12 +291,14 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_boolean_value_strict(std::move(arg), name_, codename_),
                 std::move(localities_info));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return transpose2d(
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 std::move(localities_info));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose2d(
                 extract_numeric_value(std::move(arg), name_, codename_),
@@ -378,12 +382,14 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_boolean_value_strict(std::move(arg), name_, codename_),
                 std::move(localities_info));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return transpose3d(
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 std::move(localities_info));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose3d(
                 extract_numeric_value(std::move(arg), name_, codename_),
@@ -471,12 +477,14 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_boolean_value_strict(std::move(arg), name_, codename_),
                 std::move(axes), std::move(localities_info));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return transpose3d(
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 std::move(axes), std::move(localities_info));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose3d(
                 extract_numeric_value(std::move(arg), name_, codename_),
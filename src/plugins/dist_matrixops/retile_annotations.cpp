@@ -498,12 +498,14 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 tiling_type, intersection, numtiles, std::move(new_tiling),
                 std::move(arr_localities));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return retile1d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 tiling_type, intersection, numtiles, std::move(new_tiling),
                 std::move(arr_localities));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return retile1d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -706,12 +708,14 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 tiling_type, intersection, numtiles, std::move(new_tiling),
                 std::move(arr_localities));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return retile2d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 tiling_type, intersection, numtiles, std::move(new_tiling),
                 std::move(arr_localities));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return retile2d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -949,12 +953,14 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 tiling_type, intersection, numtiles, std::move(new_tiling),
                 std::move(arr_localities));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return retile3d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 tiling_type, intersection, numtiles, std::move(new_tiling),
                 std::move(arr_localities));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return retile3d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -17,6 +17,7 @@
 #include <phylanx/plugins/fileio/dist_file_read_csv.hpp>
 #include <phylanx/plugins/fileio/file_read_csv_impl.hpp>
 #include <phylanx/util/detail/range_dimension.hpp>
+#include <phylanx/util/mapped_file.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
@@ -27,7 +28,6 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <iomanip>
 #include <memory>
 #include <stdexcept>
@@ -113,15 +113,15 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
     ///////////////////////////////////////////////////////////////////////////
     primitive_argument_type dist_file_read_csv::dist_read_2d(
-        std::ifstream&& infile, std::string const& filename,
-        std::string const& tiling_type,
+        std::string const& filename, std::string const& tiling_type,
         std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& intersections,
         std::string&& given_name, std::uint32_t numtiles) const
     {
-        std::vector<double> data;
-        std::size_t n_rows, n_cols;
-        std::tie(data, n_rows, n_cols) =
-            read_helper(std::move(infile), filename);
+        // discover the shape of the data without converting any values
+        util::mapped_file file(filename);
+        csv_layout layout = scan_csv_layout(file);
+        std::size_t n_rows = layout.n_rows;
+        std::size_t n_cols = layout.n_cols;
 
         std::int64_t row_start, column_start;
         std::size_t row_size, column_size;
@@ -164,25 +164,31 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 tile_info.as_annotation(name_, codename_), ann_info, name_,
                 codename_));
 
-        blaze::DynamicMatrix<double> whole_data(n_rows, n_cols, data.data());
-        blaze::DynamicMatrix<double> result =
-            blaze::submatrix(std::move(whole_data), row_start, column_start,
-                row_size, column_size);
+        // parse only the rows and columns that belong to the local tile
+        blaze::DynamicMatrix<double> result(row_size, column_size);
+        parse_csv_rows(file, layout, row_start, row_start + row_size,
+            column_start, column_start + column_size,
+            detail::csv_all_rows{},
+            [&](std::size_t row, std::size_t col, double value)
+            {
+                result(row - row_start, col - column_start) = value;
+            });
 
         return primitive_argument_type(result, attached_annotation);
     }
 
     ///////////////////////////////////////////////////////////////////////////
     primitive_argument_type dist_file_read_csv::dist_read_3d(
-        std::ifstream&& infile, std::string const& filename,
-        std::int64_t given_nrows, std::string const& tiling_type,
+        std::string const& filename, std::int64_t given_nrows,
+        std::string const& tiling_type,
         std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& intersections,
         std::string&& given_name, std::uint32_t numtiles) const
     {
-        std::vector<double> data;
-        std::size_t n_rows, n_cols;
-        std::tie(data, n_rows, n_cols) =
-            read_helper(std::move(infile), filename);
+        // discover the shape of the data without converting any values
+        util::mapped_file file(filename);
+        csv_layout layout = scan_csv_layout(file);
+        std::size_t n_rows = layout.n_rows;
+        std::size_t n_cols = layout.n_cols;
         std::size_t n_pages = static_cast<std::size_t>(n_rows / given_nrows);
 
         if (n_rows % given_nrows != 0)
@@ -241,11 +247,29 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 tile_info.as_annotation(name_, codename_), ann_info, name_,
                 codename_));
 
-        blaze::DynamicTensor<double> whole_data(
-            n_pages, given_nrows, n_cols, data.data());
-        blaze::DynamicTensor<double> result =
-            blaze::subtensor(std::move(whole_data), page_start, row_start,
-                column_start, page_size, row_size, column_size);
+        // parse only the pages, rows and columns that belong to the local
+        // tile, page p of the result consists of the rows
+        // [p * given_nrows, (p + 1) * given_nrows) of the file
+        blaze::DynamicTensor<double> result(page_size, row_size, column_size);
+
+        std::size_t nrows = static_cast<std::size_t>(given_nrows);
+        std::size_t first_row = page_start * nrows + row_start;
+        std::size_t last_row =
+            (page_start + page_size - 1) * nrows + row_start + row_size;
+
+        parse_csv_rows(file, layout, first_row, last_row, column_start,
+            column_start + column_size,
+            [&](std::size_t row) -> bool
+            {
+                std::size_t page_row = row % nrows;
+                return page_row >= std::size_t(row_start) &&
+                    page_row < row_start + row_size;
+            },
+            [&](std::size_t row, std::size_t col, double value)
+            {
+                result(row / nrows - page_start, row % nrows - row_start,
+                    col - column_start) = value;
+            });
 
         return primitive_argument_type(result, attached_annotation);
     }
@@ -380,30 +404,23 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         hpx::get_num_localities(hpx::launch::sync);
                     if (args.size() > 6 && valid(args[6]))
                     {
-                        extract_scalar_positive_integer_value_strict(
-                            std::move(args[6]), this_->name_, this_->codename_);
-                    }
-
-                    std::ifstream infile(filename.c_str(), std::ios::in);
-
-                    if (!infile.is_open())
-                    {
-                        throw std::runtime_error(this_->generate_error_message(
-                            "couldn't open file: " + filename));
+                        numtiles = static_cast<std::uint32_t>(
+                            extract_scalar_positive_integer_value_strict(
+                                std::move(args[6]), this_->name_,
+                                this_->codename_));
                     }
 
                     if (mode3d)
                     {
-                        return this_->dist_read_3d(std::move(infile), filename,
-                            page_nrows, tiling_type, intersections,
-                            std::move(given_name), numtiles);
+                        return this_->dist_read_3d(filename, page_nrows,
+                            tiling_type, intersections, std::move(given_name),
+                            numtiles);
                     }
 
                     // dist_file_read_csv never considers 1d arrays. It is a
                     // dataframe ether representing a matrix or a tensor
-                    return this_->dist_read_2d(std::move(infile), filename,
-                             tiling_type, intersections,
-                            std::move(given_name), numtiles);
+                    return this_->dist_read_2d(filename, tiling_type,
+                        intersections, std::move(given_name), numtiles);
                 }),
             detail::map_operands(operands, functional::value_operand{}, args,
                 name_, codename_, std::move(ctx)));
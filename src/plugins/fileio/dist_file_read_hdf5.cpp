@@ -0,0 +1,343 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+
+#if defined(PHYLANX_HAVE_HIGHFIVE)
+#include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/locality_annotation.hpp>
+#include <phylanx/execution_tree/meta_annotation.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/execution_tree/tiling_annotations.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/dist_matrixops/tile_calculation_helper.hpp>
+#include <phylanx/plugins/fileio/dist_file_read_hdf5.hpp>
+#include <phylanx/plugins/fileio/file_read_hdf5_impl.hpp>
+#include <phylanx/util/detail/range_dimension.hpp>
+
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/errors/throw_exception.hpp>
+
+#include <phylanx/util/detail/blaze-highfive.hpp>
+#include <highfive/H5DataSet.hpp>
+#include <highfive/H5DataSpace.hpp>
+#include <highfive/H5File.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const dist_file_read_hdf5::match_data =
+    {
+        hpx::make_tuple("file_read_hdf5_d",
+            std::vector<std::string>{R"(
+                file_read_hdf5_d(
+                    _1_fname,
+                    _2_dsetname,
+                    __arg(_3_tiling_type, "sym"),
+                    __arg(_4_intersection, nil),
+                    __arg(_5_name, ""),
+                    __arg(_6_numtiles, num_localities())
+                )
+            )"},
+            &create_dist_file_read_hdf5, &create_primitive<dist_file_read_hdf5>,
+            R"(fname, dsetname, tiling_type, intersection, name, numtiles
+            Args:
+
+                fname (string) : file name including its path.
+                dsetname (string) : a dataset name
+                tiling_type (string, optional): defaults to `sym` which is a
+                    balanced way of tiling among all the numtiles localities.
+                    Other options are `row` or `column` tiling. For a vector
+                    all these tiling_types are the same.
+                intersection (int or a tuple of ints, optional): the size of
+                    overlapped part on each dimension. If an integer is given,
+                    that would be the intersection length on all dimensions
+                    that are tiled. The middle parts get to have two
+                    intersections, one with the tile before it and one with the
+                    tile after it.
+                name (string, optional): the array given name. If not given, a
+                    globally unique name will be generated.
+                numtiles (int, optional): number of tiles of the returned array.
+                    if not given it sets to the number of localities in the
+                    application.
+
+            Returns:
+
+            Returns a distributed array representing the given dataset. Each
+            locality reads only the hyperslab of the dataset corresponding to
+            its own tile.
+            )")
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    dist_file_read_hdf5::dist_file_read_hdf5(
+            primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        static std::atomic<std::size_t> hdf5_count(0);
+        std::string generate_hdf5_name(std::string&& given_name)
+        {
+            if (given_name.empty())
+            {
+                return "hdf5_file_" + std::to_string(++hdf5_count);
+            }
+
+            return std::move(given_name);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type dist_file_read_hdf5::dist_read(
+        std::string const& filename, std::string const& dataset_name,
+        std::string const& tiling_type,
+        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& intersections,
+        std::string&& given_name, std::uint32_t numtiles) const
+    {
+        std::lock_guard<hpx::lcos::local::mutex> l(hdf5_mutex());
+
+        HighFive::File infile(filename, HighFive::File::ReadOnly);
+        HighFive::DataSet dataSet = infile.getDataSet(dataset_name);
+        std::vector<std::size_t> dims = dataSet.getSpace().getDimensions();
+
+        std::uint32_t tile_idx = hpx::get_locality_id();
+
+        std::vector<std::size_t> offset, count;
+        annotation tile_ann;
+
+        switch (dims.size())
+        {
+        case 1:
+            {
+                std::int64_t start;
+                std::size_t size;
+                std::tie(start, size) = tile_calculation::tile_calculation_1d(
+                    tile_idx, dims[0], numtiles);
+
+                // adding overlap
+                if (size != dims[0] && intersections[0] != 0)
+                {
+                    std::tie(start, size) =
+                        tile_calculation::tile_calculation_overlap_1d(
+                            start, size, dims[0], intersections[0]);
+                }
+
+                tiling_information_1d tile_info(
+                    tiling_information_1d::tile1d_type::columns,
+                    tiling_span(start, start + size));
+                tile_ann = tile_info.as_annotation(name_, codename_);
+
+                offset = {static_cast<std::size_t>(start)};
+                count = {size};
+            }
+            break;
+
+        case 2:
+            {
+                std::int64_t row_start, column_start;
+                std::size_t row_size, column_size;
+                std::tie(row_start, column_start, row_size, column_size) =
+                    tile_calculation::tile_calculation_2d(
+                        tile_idx, dims[0], dims[1], numtiles, tiling_type);
+
+                // adding overlap
+                if (row_size != dims[0] && intersections[0] != 0)
+                {
+                    std::tie(row_start, row_size) =
+                        tile_calculation::tile_calculation_overlap_1d(
+                            row_start, row_size, dims[0], intersections[0]);
+                }
+                if (column_size != dims[1] && intersections[1] != 0)
+                {
+                    std::tie(column_start, column_size) =
+                        tile_calculation::tile_calculation_overlap_1d(
+                            column_start, column_size, dims[1],
+                            intersections[1]);
+                }
+
+                tiling_information_2d tile_info(
+                    tiling_span(row_start, row_start + row_size),
+                    tiling_span(column_start, column_start + column_size));
+                tile_ann = tile_info.as_annotation(name_, codename_);
+
+                offset = {static_cast<std::size_t>(row_start),
+                    static_cast<std::size_t>(column_start)};
+                count = {row_size, column_size};
+            }
+            break;
+
+        default:
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_file_read_hdf5::dist_read",
+                generate_error_message(
+                    "file_read_hdf5_d supports reading vectors and matrices "
+                    "only"));
+        }
+
+        locality_information locality_info(tile_idx, numtiles);
+        annotation locality_ann = locality_info.as_annotation();
+
+        std::string base_name =
+            detail::generate_hdf5_name(std::move(given_name));
+
+        annotation_information ann_info(
+            std::move(base_name), 0);    //generation 0
+
+        auto attached_annotation =
+            std::make_shared<annotation>(localities_annotation(locality_ann,
+                std::move(tile_ann), ann_info, name_, codename_));
+
+        // read the local tile only
+        primitive_argument_type result = read_hdf5_hyperslab(dataSet,
+            std::move(offset), std::move(count), name_, codename_);
+        result.set_annotation(std::move(attached_annotation));
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> dist_file_read_hdf5::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() < 2 || operands.size() > 6)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_file_read_hdf5::eval",
+                generate_error_message("the file_read_hdf5_d primitive "
+                                       "requires at least 2 and at most 6 "
+                                       "operands"));
+        }
+
+        if (!valid(operands[0]) || !valid(operands[1]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_file_read_hdf5::eval",
+                generate_error_message(
+                    "the file_read_hdf5_d primitive requires that the given "
+                        "operands are valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync, hpx::unwrapping(
+                [this_ = std::move(this_)](
+                    primitive_arguments_type&& args)
+                    -> primitive_argument_type
+                {
+                    std::string filename = extract_string_value_strict(
+                        std::move(args[0]), this_->name_, this_->codename_);
+                    std::string dataset_name = extract_string_value_strict(
+                        std::move(args[1]), this_->name_, this_->codename_);
+
+                    // using balanced symmetric tiles as the default
+                    std::string tiling_type = "sym";
+                    if (args.size() > 2 && valid(args[2]))
+                    {
+                        tiling_type = extract_string_value(
+                            std::move(args[2]), this_->name_, this_->codename_);
+                        if (tiling_type != "sym" && tiling_type != "row" &&
+                            tiling_type != "column")
+                        {
+                            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                                "dist_file_read_hdf5::eval",
+                                this_->generate_error_message(
+                                    "invalid tiling_type. The tiling_type can "
+                                    "be one of these: `sym`, `row` or "
+                                    "`column`"));
+                        }
+                    }
+
+                    std::array<std::size_t, PHYLANX_MAX_DIMENSIONS>
+                        intersections{0};
+                    if (args.size() > 3 && valid(args[3]))
+                    {
+                        if (is_list_operand_strict(args[3]))
+                        {
+                            ir::range&& intersection_list =
+                                extract_list_value_strict(std::move(args[3]),
+                                    this_->name_, this_->codename_);
+
+                            if (intersection_list.size() > 2)
+                            {
+                                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                                    "dist_file_read_hdf5::eval",
+                                    this_->generate_error_message(
+                                        "intersection should have the same "
+                                        "number of dimensions as the array, or "
+                                        "be represented with an integer for "
+                                        "all dimensions"));
+                            }
+                            intersections =
+                                util::detail::extract_nonneg_range_dimensions(
+                                    intersection_list, this_->name_,
+                                    this_->codename_);
+                        }
+                        else if (is_numeric_operand(args[3]))
+                        {
+                            // we assume all dimensions have the same
+                            // intersection length which is the given one
+                            intersections[0] =
+                                extract_scalar_nonneg_integer_value_strict(
+                                    std::move(args[3]), this_->name_,
+                                    this_->codename_);
+                            intersections[1] = intersections[0];
+                        }
+                        else
+                        {
+                            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                                "dist_file_read_hdf5::eval",
+                                this_->generate_error_message(
+                                    "intersection can be an integer or a list "
+                                    "of integers"));
+                        }
+                    }
+
+                    std::string given_name = "";
+                    if (args.size() > 4 && valid(args[4]))
+                    {
+                        given_name = extract_string_value(std::move(args[4]),
+                            this_->name_, this_->codename_);
+                    }
+
+                    std::uint32_t numtiles =
+                        hpx::get_num_localities(hpx::launch::sync);
+                    if (args.size() > 5 && valid(args[5]))
+                    {
+                        numtiles = static_cast<std::uint32_t>(
+                            extract_scalar_positive_integer_value_strict(
+                                std::move(args[5]), this_->name_,
+                                this_->codename_));
+                    }
+
+                    return this_->dist_read(filename, dataset_name,
+                        tiling_type, intersections, std::move(given_name),
+                        numtiles);
+                }),
+            detail::map_operands(operands, functional::value_operand{}, args,
+                name_, codename_, std::move(ctx)));
+    }
+}}}
+
+#endif
@@ -0,0 +1,523 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/compiler/primitive_name.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/fileio/file_read_chunks.hpp>
+#include <phylanx/plugins/fileio/file_read_csv_impl.hpp>
+#include <phylanx/util/mapped_file.hpp>
+
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/synchronization/mutex.hpp>
+
+#if defined(PHYLANX_HAVE_HIGHFIVE)
+#include <phylanx/plugins/fileio/file_read_hdf5_impl.hpp>
+
+#include <phylanx/util/detail/blaze-highfive.hpp>
+#include <highfive/H5DataSet.hpp>
+#include <highfive/H5DataSpace.hpp>
+#include <highfive/H5File.hpp>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // All chunks of a file share one instance of this. The csv layout is
+        // discovered only once, and at most one chunk is read ahead at any
+        // point in time, which keeps the memory requirements bounded by the
+        // size of two chunks (per consumer).
+        struct chunked_file
+        {
+            chunked_file(std::string const& filename,
+                    std::string const& dataset, std::string const& name,
+                    std::string const& codename)
+              : filename_(filename)
+              , dataset_(dataset)
+              , name_(name)
+              , codename_(codename)
+            {
+#if defined(PHYLANX_HAVE_HIGHFIVE)
+                if (!dataset_.empty())
+                {
+                    std::lock_guard<hpx::lcos::local::mutex> l(hdf5_mutex());
+
+                    HighFive::File infile(filename_, HighFive::File::ReadOnly);
+                    dims_ = infile.getDataSet(dataset_)
+                                .getSpace()
+                                .getDimensions();
+                    if (dims_.empty() || dims_.size() > 2)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                            "file_read_chunks",
+                            util::generate_error_message(
+                                "the dataset has to be one or two "
+                                "dimensional to be read in chunks",
+                                name_, codename_));
+                    }
+                    n_rows_ = dims_[0];
+                    return;
+                }
+#else
+                if (!dataset_.empty())
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "file_read_chunks",
+                        util::generate_error_message(
+                            "reading hdf5 datasets requires building "
+                            "Phylanx with HighFive support",
+                            name_, codename_));
+                }
+#endif
+                file_.reset(new util::mapped_file(filename_));
+                layout_ = scan_csv_layout(*file_);
+                n_rows_ = layout_.n_rows;
+            }
+
+            std::size_t num_rows() const
+            {
+                return n_rows_;
+            }
+
+            // synchronously read the rows [first_row, first_row + num_rows)
+            primitive_argument_type read(
+                std::size_t first_row, std::size_t num_rows) const
+            {
+#if defined(PHYLANX_HAVE_HIGHFIVE)
+                if (!dataset_.empty())
+                {
+                    std::vector<std::size_t> offset(dims_.size(), 0);
+                    std::vector<std::size_t> count(dims_);
+                    offset[0] = first_row;
+                    count[0] = num_rows;
+
+                    std::lock_guard<hpx::lcos::local::mutex> l(hdf5_mutex());
+
+                    HighFive::File infile(filename_, HighFive::File::ReadOnly);
+                    return read_hdf5_hyperslab(infile.getDataSet(dataset_),
+                        std::move(offset), std::move(count), name_, codename_);
+                }
+#endif
+                blaze::DynamicMatrix<double> matrix(num_rows, layout_.n_cols);
+                parse_csv_rows(*file_, layout_, first_row,
+                    first_row + num_rows, 0, layout_.n_cols,
+                    csv_all_rows{},
+                    [&](std::size_t row, std::size_t col, double value)
+                    {
+                        matrix(row - first_row, col) = value;
+                    });
+
+                return primitive_argument_type{
+                    ir::node_data<double>{std::move(matrix)}};
+            }
+
+            // return the requested chunk, either from the read-ahead buffer
+            // or by reading it now, then start reading the next chunk
+            static hpx::future<primitive_argument_type> fetch(
+                std::shared_ptr<chunked_file> const& self,
+                std::size_t first_row, std::size_t num_rows)
+            {
+                hpx::future<primitive_argument_type> result;
+
+                std::size_t next_row = first_row + num_rows;
+                std::size_t next_num_rows = 0;
+                if (next_row < self->n_rows_)
+                {
+                    next_num_rows = (std::min)(
+                        num_rows, self->n_rows_ - next_row);
+                }
+
+                {
+                    std::lock_guard<hpx::lcos::local::spinlock> l(self->mtx_);
+
+                    if (self->read_ahead_.valid() &&
+                        self->read_ahead_row_ == first_row &&
+                        self->read_ahead_num_rows_ == num_rows)
+                    {
+                        result = std::move(self->read_ahead_);
+                    }
+
+                    // don't replace a chunk that is still ahead of us, it
+                    // will be consumed by somebody else (e.g. parallel_map)
+                    if (next_num_rows != 0 &&
+                        (!self->read_ahead_.valid() ||
+                            self->read_ahead_row_ < first_row))
+                    {
+                        std::weak_ptr<chunked_file> weak = self;
+                        self->read_ahead_ = hpx::async(
+                            [weak = std::move(weak), next_row, next_num_rows]()
+                            -> primitive_argument_type
+                            {
+                                // nobody is interested in this chunk anymore
+                                auto file = weak.lock();
+                                if (!file)
+                                {
+                                    return primitive_argument_type{};
+                                }
+                                return file->read(next_row, next_num_rows);
+                            });
+                        self->read_ahead_row_ = next_row;
+                        self->read_ahead_num_rows_ = next_num_rows;
+                    }
+                }
+
+                if (!result.valid())
+                {
+                    result = hpx::async(
+                        [self, first_row, num_rows]()
+                        {
+                            return self->read(first_row, num_rows);
+                        });
+                }
+                return result;
+            }
+
+            std::string const filename_;
+            std::string const dataset_;
+            std::string const name_;
+            std::string const codename_;
+
+            std::size_t n_rows_ = 0;
+
+            // csv files are memory mapped
+            std::unique_ptr<util::mapped_file> file_;
+            csv_layout layout_;
+
+#if defined(PHYLANX_HAVE_HIGHFIVE)
+            std::vector<std::size_t> dims_;
+#endif
+
+            // the chunk that is currently being read ahead
+            hpx::lcos::local::spinlock mtx_;
+            hpx::future<primitive_argument_type> read_ahead_;
+            std::size_t read_ahead_row_ = 0;
+            std::size_t read_ahead_num_rows_ = 0;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // All chunks of the same file refer to the same chunked_file instance
+        // which is released as soon as the last of its chunks goes away.
+        std::shared_ptr<chunked_file> open_chunked_file(
+            std::string const& filename, std::string const& dataset,
+            std::string const& name, std::string const& codename)
+        {
+            using key_type = std::pair<std::string, std::string>;
+
+            static hpx::lcos::local::mutex mtx;
+            static std::map<key_type, std::weak_ptr<chunked_file>> files;
+
+            std::lock_guard<hpx::lcos::local::mutex> l(mtx);
+
+            auto it = files.find(key_type(filename, dataset));
+            if (it != files.end())
+            {
+                std::shared_ptr<chunked_file> file = it->second.lock();
+                if (file)
+                {
+                    return file;
+                }
+            }
+
+            // remove stale entries
+            for (auto it = files.begin(); it != files.end(); /**/)
+            {
+                if (it->second.expired())
+                {
+                    it = files.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            auto file = std::make_shared<chunked_file>(
+                filename, dataset, name, codename);
+            files[key_type(filename, dataset)] = file;
+            return file;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const file_read_chunks::match_data =
+    {
+        hpx::make_tuple("file_read_chunks",
+            std::vector<std::string>{R"(
+                file_read_chunks(
+                    _1_filename,
+                    _2_rows_per_chunk,
+                    __arg(_3_dataset, nil)
+                )
+            )"},
+            &create_file_read_chunks, &create_primitive<file_read_chunks>,
+            R"(filename, rows_per_chunk, dataset
+            Args:
+
+                filename (string) : file name
+                rows_per_chunk (int) : the number of rows in each chunk, the
+                    last chunk may hold fewer rows
+                dataset (string, optional) : if given, the file is read as
+                    an hdf5 file and this is the name of the (one or two
+                    dimensional) dataset to read, otherwise the file is read
+                    as a csv file
+
+            Returns:
+
+            Returns a list of row blocks of the given file. The blocks are
+            read lazily whenever an element of the list is evaluated (e.g.
+            by fold_left, for_each, or parallel_map). While a block is being
+            processed the next block is read in the background. Blocks of
+            csv files are always matrices.)"
+            )
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    file_read_chunks::file_read_chunks(
+            primitive_arguments_type && operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+    {}
+
+    primitive_argument_type file_read_chunks::create_chunks(
+        std::string const& filename, std::size_t rows_per_chunk,
+        primitive_argument_type&& dataset) const
+    {
+        std::string dataset_name;
+        if (valid(dataset))
+        {
+            dataset_name = extract_string_value_strict(
+                dataset, name_, codename_);
+        }
+
+        // this also verifies that the file exists and is well formed, the
+        // file is kept open to avoid rediscovering its layout whenever the
+        // first of its chunks is evaluated
+        std::shared_ptr<detail::chunked_file> file =
+            detail::open_chunked_file(
+                filename, dataset_name, name_, codename_);
+        {
+            std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+            file_ = file;
+        }
+
+        std::size_t n_rows = file->num_rows();
+        std::size_t num_chunks = (n_rows + rows_per_chunk - 1) / rows_per_chunk;
+
+        compiler::primitive_name_parts name_parts;
+        if (!compiler::parse_primitive_name(name_, name_parts))
+        {
+            name_parts.locality = hpx::get_locality_id();
+        }
+        name_parts.primitive = "file_read_chunk";
+
+        primitive_arguments_type chunks;
+        chunks.reserve(num_chunks);
+        for (std::size_t i = 0; i != num_chunks; ++i)
+        {
+            std::size_t first_row = i * rows_per_chunk;
+
+            primitive_arguments_type chunk_operands;
+            chunk_operands.reserve(4);
+            chunk_operands.emplace_back(filename);
+            chunk_operands.emplace_back(ir::node_data<std::int64_t>{
+                static_cast<std::int64_t>(first_row)});
+            chunk_operands.emplace_back(ir::node_data<std::int64_t>{
+                static_cast<std::int64_t>(
+                    (std::min)(rows_per_chunk, n_rows - first_row))});
+            chunk_operands.push_back(dataset);
+
+            name_parts.sequence_number = static_cast<std::int64_t>(i);
+
+            // the chunks are local to this locality, don't bother registering
+            // them with AGAS
+            chunks.emplace_back(create_primitive_component(hpx::find_here(),
+                name_parts.primitive, std::move(chunk_operands),
+                compiler::compose_primitive_name(name_parts), codename_,
+                false));
+        }
+
+        return primitive_argument_type{std::move(chunks)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> file_read_chunks::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() < 2 || operands.size() > 3)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::execution_tree::primitives::file_read_chunks::eval",
+                generate_error_message(
+                    "the file_read_chunks primitive requires at least two and "
+                    "at most three operands"));
+        }
+
+        if (!valid(operands[0]) || !valid(operands[1]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::execution_tree::primitives::file_read_chunks::eval",
+                generate_error_message(
+                    "the file_read_chunks primitive requires that the given "
+                    "operands are valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync, hpx::unwrapping(
+            [this_ = std::move(this_)](primitive_arguments_type&& args)
+                -> primitive_argument_type
+            {
+                std::string filename = extract_string_value_strict(
+                    std::move(args[0]), this_->name_, this_->codename_);
+
+                std::size_t rows_per_chunk = static_cast<std::size_t>(
+                    extract_scalar_positive_integer_value_strict(
+                        std::move(args[1]), this_->name_, this_->codename_));
+
+                primitive_argument_type dataset;
+                if (args.size() > 2)
+                {
+                    dataset = std::move(args[2]);
+                }
+
+                return this_->create_chunks(
+                    filename, rows_per_chunk, std::move(dataset));
+            }),
+            detail::map_operands(operands, functional::value_operand{}, args,
+                name_, codename_, std::move(ctx)));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const file_read_chunk::match_data =
+    {
+        hpx::make_tuple("file_read_chunk",
+            std::vector<std::string>{R"(
+                file_read_chunk(
+                    _1_filename,
+                    _2_first_row,
+                    _3_num_rows,
+                    __arg(_4_dataset, nil)
+                )
+            )"},
+            &create_file_read_chunk, &create_primitive<file_read_chunk>,
+            R"(filename, first_row, num_rows, dataset
+            Args:
+
+                filename (string) : file name
+                first_row (int) : the first row to read
+                num_rows (int) : the number of rows to read
+                dataset (string, optional) : if given, the file is read as
+                    an hdf5 file and this is the name of the dataset to read,
+                    otherwise the file is read as a csv file
+
+            Returns:
+
+            Returns the rows [first_row, first_row + num_rows) of the given
+            file. Reading a chunk starts reading the next chunk of the same
+            size in the background. This primitive is used by
+            file_read_chunks.)"
+            )
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    file_read_chunk::file_read_chunk(
+            primitive_arguments_type && operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+    {}
+
+    std::shared_ptr<detail::chunked_file> file_read_chunk::get_file(
+        std::string const& filename, std::string const& dataset) const
+    {
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+        if (!file_ || file_->filename_ != filename ||
+            file_->dataset_ != dataset)
+        {
+            file_ = detail::open_chunked_file(
+                filename, dataset, name_, codename_);
+        }
+        return file_;
+    }
+
+    hpx::future<primitive_argument_type> file_read_chunk::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() < 3 || operands.size() > 4)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::execution_tree::primitives::file_read_chunk::eval",
+                generate_error_message(
+                    "the file_read_chunk primitive requires at least three "
+                    "and at most four operands"));
+        }
+
+        if (!valid(operands[0]) || !valid(operands[1]) || !valid(operands[2]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::execution_tree::primitives::file_read_chunk::eval",
+                generate_error_message(
+                    "the file_read_chunk primitive requires that the given "
+                    "operands are valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync, hpx::unwrapping(
+            [this_ = std::move(this_)](primitive_arguments_type&& args)
+                -> hpx::future<primitive_argument_type>
+            {
+                std::string filename = extract_string_value_strict(
+                    std::move(args[0]), this_->name_, this_->codename_);
+
+                std::size_t first_row = static_cast<std::size_t>(
+                    extract_scalar_nonneg_integer_value_strict(
+                        std::move(args[1]), this_->name_, this_->codename_));
+                std::size_t num_rows = static_cast<std::size_t>(
+                    extract_scalar_nonneg_integer_value_strict(
+                        std::move(args[2]), this_->name_, this_->codename_));
+
+                std::string dataset;
+                if (args.size() > 3 && valid(args[3]))
+                {
+                    dataset = extract_string_value_strict(
+                        std::move(args[3]), this_->name_, this_->codename_);
+                }
+
+                std::shared_ptr<detail::chunked_file> file =
+                    this_->get_file(filename, dataset);
+
+                if (first_row + num_rows > file->num_rows())
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "file_read_chunk::eval",
+                        this_->generate_error_message(
+                            "the requested rows are out of range for file: " +
+                            filename));
+                }
+
+                return detail::chunked_file::fetch(file, first_row, num_rows);
+            }),
+            detail::map_operands(operands, functional::value_operand{}, args,
+                name_, codename_, std::move(ctx)));
+    }
+}}}
@@ -7,6 +7,7 @@
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/fileio/file_read_csv.hpp>
 #include <phylanx/plugins/fileio/file_read_csv_impl.hpp>
+#include <phylanx/util/mapped_file.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
@@ -15,12 +16,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
-#include <iomanip>
 #include <memory>
 #include <stdexcept>
 #include <string>
-#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -68,45 +66,64 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {}
 
     ///////////////////////////////////////////////////////////////////////////
+    // The file is memory mapped and split into chunks which are parsed
+    // concurrently, all values are written directly into the final storage.
     inline primitive_argument_type file_read_csv::read(
-        std::ifstream&& infile, std::string const& filename) const
+        std::string const& filename) const
     {
-        std::vector<double> data;
-        std::size_t n_rows, n_cols;
-        std::tie(data, n_rows, n_cols) =
-            read_helper(std::move(infile), filename);
+        util::mapped_file file(filename);
+        csv_layout layout = scan_csv_layout(file);
+
+        std::size_t n_rows = layout.n_rows;
+        std::size_t n_cols = layout.n_cols;
 
         if (n_rows == 1)
         {
             if (n_cols == 1)
             {
                 // scalar value
-                return primitive_argument_type{
-                    ir::node_data<double>{data[0]}};
+                double value = 0.0;
+                parse_csv_rows(file, layout, 0, 1, 0, 1,
+                    detail::csv_all_rows{},
+                    [&](std::size_t, std::size_t, double v) { value = v; });
+
+                return primitive_argument_type{ir::node_data<double>{value}};
             }
 
             // vector
-            blaze::DynamicVector<double> vector(n_cols, data.data());
+            blaze::DynamicVector<double> vector(n_cols);
+            parse_csv_rows(file, layout, 0, 1, 0, n_cols,
+                detail::csv_all_rows{},
+                [&](std::size_t, std::size_t col, double value)
+                {
+                    vector[col] = value;
+                });
 
             return primitive_argument_type{
                 ir::node_data<double>{std::move(vector)}};
         }
 
         // matrix
-        blaze::DynamicMatrix<double> matrix(n_rows, n_cols, data.data());
+        blaze::DynamicMatrix<double> matrix(n_rows, n_cols);
+        parse_csv_rows(file, layout, 0, n_rows, 0, n_cols,
+            detail::csv_all_rows{},
+            [&](std::size_t row, std::size_t col, double value)
+            {
+                matrix(row, col) = value;
+            });
 
         return primitive_argument_type{
             ir::node_data<double>{std::move(matrix)}};
     }
 
     inline primitive_argument_type file_read_csv::read_3d(
-        std::ifstream&& infile, std::string const& filename,
-        std::int64_t given_nrows) const
+        std::string const& filename, std::int64_t given_nrows) const
     {
-        std::vector<double> data;
-        std::size_t n_rows, n_cols;
-        std::tie(data, n_rows, n_cols) =
-            read_helper(std::move(infile), filename);
+        util::mapped_file file(filename);
+        csv_layout layout = scan_csv_layout(file);
+
+        std::size_t n_rows = layout.n_rows;
+        std::size_t n_cols = layout.n_cols;
 
         if (n_rows % given_nrows != 0)
         {
@@ -117,9 +134,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // tensor
-        blaze::DynamicTensor<double> result(
-            static_cast<std::size_t>(n_rows / given_nrows), given_nrows, n_cols,
-            data.data());
+        std::size_t nrows = static_cast<std::size_t>(given_nrows);
+        blaze::DynamicTensor<double> result(n_rows / nrows, nrows, n_cols);
+        parse_csv_rows(file, layout, 0, n_rows, 0, n_cols,
+            detail::csv_all_rows{},
+            [&](std::size_t row, std::size_t col, double value)
+            {
+                result(row / nrows, row % nrows, col) = value;
+            });
 
         return primitive_argument_type{
             ir::node_data<double>{std::move(result)}};
@@ -171,20 +193,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         std::move(args[2]), this_->name_, this_->codename_);
                 }
 
-                std::ifstream infile(filename.c_str(), std::ios::in);
-
-                if (!infile.is_open())
-                {
-                    throw std::runtime_error(this_->generate_error_message(
-                        "couldn't open file: " + filename));
-                }
-
                 if (mode3d)
                 {
-                    return this_->read_3d(
-                        std::move(infile), filename, page_nrows);
+                    return this_->read_3d(filename, page_nrows);
                 }
-                return this_->read(std::move(infile), filename);
+                return this_->read(filename);
 
                 }),
             detail::map_operands(operands, functional::value_operand{}, args,
@@ -8,6 +8,7 @@
 #if defined(PHYLANX_HAVE_HIGHFIVE)
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/fileio/file_read_hdf5.hpp>
+#include <phylanx/plugins/fileio/file_read_hdf5_impl.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
@@ -20,7 +21,8 @@
 #include <highfive/H5File.hpp>
 
 #include <cstddef>
-#include <fstream>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -32,20 +34,41 @@ namespace phylanx { namespace execution_tree { namespace primitives
     match_pattern_type const file_read_hdf5::match_data =
     {
         hpx::make_tuple("file_read_hdf5",
-            std::vector<std::string>{"file_read_hdf5(_1, _2)"},
+            std::vector<std::string>{R"(
+                file_read_hdf5(
+                    _1_fname,
+                    _2_dsetname,
+                    __arg(_3_offset, nil),
+                    __arg(_4_count, nil)
+                )
+            )"},
             &create_file_read_hdf5, &create_primitive<file_read_hdf5>,
-            R"(fname,dsetname
+            R"(fname, dsetname, offset, count
             Args:
 
                 fname (string) : a file name
                 dsetname (string) : a dataset name
+                offset (int or list of ints, optional) : the start of the
+                    hyperslab to read on each dimension, defaults to the
+                    beginning of the dataset
+                count (int or list of ints, optional) : the number of
+                    elements to read on each dimension, defaults to the
+                    remainder of the dataset
 
             Returns:
 
-            The dataset, either a matrix or vector.)"
+            The dataset (or the selected part of it), either a matrix or
+            vector.)"
             )
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::lcos::local::mutex& hdf5_mutex()
+    {
+        static hpx::lcos::local::mutex mtx;
+        return mtx;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     file_read_hdf5::file_read_hdf5(
             primitive_arguments_type && operands,
@@ -59,13 +82,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_arguments_type const& operands,
         primitive_arguments_type const& args, eval_context ctx) const
     {
-        if (operands.size() != 2)
+        if (operands.size() < 2 || operands.size() > 4)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
                 "phylanx::execution_tree::primitives::file_read_hdf5::eval",
                 generate_error_message(
-                    "the file_read_hdf5 primitive requires exactly two "
-                        "literal arguments"));
+                    "the file_read_hdf5 primitive requires at least two and "
+                        "at most four operands"));
         }
 
         if (!valid(operands[0]) || !valid(operands[1]))
@@ -77,52 +100,40 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         "operand is valid"));
         }
 
-        std::string filename =
-            string_operand_sync(operands[0], args, name_, codename_, ctx);
-        std::string datasetName =
-            string_operand_sync(operands[1], args, name_, codename_, ctx);
-
-        HighFive::File infile(filename, HighFive::File::ReadOnly);
-        HighFive::DataSet dataSet = infile.getDataSet(datasetName);
-        HighFive::DataSpace dataSpace = dataSet.getSpace();
-
-        switch (dataSpace.getNumberDimensions())
-        {
-        case 0:
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync, hpx::unwrapping(
+            [this_ = std::move(this_)](primitive_arguments_type&& args)
+                -> primitive_argument_type
             {
-                // scalar value
-                double scalar;
-                dataSet.read(scalar);
-                return hpx::make_ready_future(
-                    primitive_argument_type{ir::node_data<double>{scalar}});
-            }
-
-        case 1:
-            {
-                // vector
-                std::vector<std::size_t> dims = dataSpace.getDimensions();
-                blaze::DynamicVector<double> vector(dims[0]);
-                dataSet.read(vector);
-                return hpx::make_ready_future(primitive_argument_type{
-                    ir::node_data<double>{std::move(vector)}});
-            }
-
-        case 2:
-            {
-                // matrix
-                std::vector<std::size_t> dims = dataSpace.getDimensions();
-                blaze::DynamicMatrix<double> matrix(dims[0], dims[1]);
-                dataSet.read(matrix);
-                return hpx::make_ready_future(primitive_argument_type{
-                    ir::node_data<double>{std::move(matrix)}});
-            }
-
-        default:
-            HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "phylanx::execution_tree::primitives::file_read_hdf5::eval",
-                generate_error_message(
-                    "the input file has incompatible number of dimensions"));
-        }
+                std::string filename = extract_string_value_strict(
+                    std::move(args[0]), this_->name_, this_->codename_);
+                std::string dataset_name = extract_string_value_strict(
+                    std::move(args[1]), this_->name_, this_->codename_);
+
+                std::vector<std::size_t> offset;
+                if (args.size() > 2 && valid(args[2]))
+                {
+                    offset = extract_hdf5_extents(
+                        std::move(args[2]), this_->name_, this_->codename_);
+                }
+
+                std::vector<std::size_t> count;
+                if (args.size() > 3 && valid(args[3]))
+                {
+                    count = extract_hdf5_extents(
+                        std::move(args[3]), this_->name_, this_->codename_);
+                }
+
+                std::lock_guard<hpx::lcos::local::mutex> l(hdf5_mutex());
+
+                HighFive::File infile(filename, HighFive::File::ReadOnly);
+                HighFive::DataSet dataSet = infile.getDataSet(dataset_name);
+
+                return read_hdf5_hyperslab(dataSet, std::move(offset),
+                    std::move(count), this_->name_, this_->codename_);
+            }),
+            detail::map_operands(operands, functional::value_operand{}, args,
+                name_, codename_, std::move(ctx)));
     }
 }}}
 
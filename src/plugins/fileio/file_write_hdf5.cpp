@@ -7,6 +7,7 @@
 
 #if defined(PHYLANX_HAVE_HIGHFIVE)
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/fileio/file_read_hdf5_impl.hpp>
 #include <phylanx/plugins/fileio/file_write_hdf5.hpp>
 
 #include <hpx/include/lcos.hpp>
@@ -22,6 +23,7 @@
 #include <cstddef>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <utility>
@@ -60,6 +62,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
     void file_write_hdf5::write_to_file_hdf5(ir::node_data<double> const& val,
         std::string const& filename, std::string const& dataset_name) const
     {
+        std::lock_guard<hpx::lcos::local::mutex> l(hdf5_mutex());
+
         HighFive::File outfile(filename,
             HighFive::File::ReadWrite | HighFive::File::Create |
                 HighFive::File::Truncate);
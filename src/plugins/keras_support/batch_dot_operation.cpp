@@ -567,6 +567,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             extract_boolean_value(
                                 std::move(op2), this_->name_, this_->codename_));
 
+                    case node_data_type_int32: HPX_FALLTHROUGH;
                     case node_data_type_int64:
                         return this_->batch_dot_nd(
                             extract_integer_value(
@@ -576,6 +577,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
                     case node_data_type_unknown:
                         HPX_FALLTHROUGH;
+                    case node_data_type_float32: HPX_FALLTHROUGH;
                     case node_data_type_double:
                         return this_->batch_dot_nd(
                             extract_numeric_value(
@@ -627,6 +629,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                 std::move(op2), this_->name_, this_->codename_),
                             std::move(axes));
 
+                    case node_data_type_int32: HPX_FALLTHROUGH;
                     case node_data_type_int64:
                         return this_->batch_dot_nd(
                             extract_integer_value(
@@ -637,6 +640,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
                     case node_data_type_unknown:
                         HPX_FALLTHROUGH;
+                    case node_data_type_float32: HPX_FALLTHROUGH;
                     case node_data_type_double:
                         return this_->batch_dot_nd(
                             extract_numeric_value(
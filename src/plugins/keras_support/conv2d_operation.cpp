@@ -7,8 +7,8 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/common/conv_gemm.hpp>
 #include <phylanx/plugins/keras_support/conv2d_operation.hpp>
-#include <phylanx/plugins/keras_support/conv_indices_helper.hpp>
 
 #include <hpx/datastructures/optional.hpp>
 #include <hpx/include/lcos.hpp>
@@ -74,109 +74,43 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type conv2d_operation::conv2d_valid(
         ir::node_data<double>&& arg, ir::node_data<double>&& kernel) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        std::size_t batch = q.quats();
-        std::size_t in_height = q.pages();
-        std::size_t in_width = q.rows();
-        std::size_t in_channels = q.columns();
-        std::size_t filter_height = k.quats();
-        std::size_t filter_width = k.pages();
-        std::size_t out_channels = k.columns();
-
-        std::size_t res_height = in_height - filter_height + 1;
-        std::size_t res_width = in_width - filter_width + 1;
-        blaze::DynamicArray<4UL, double> result(
-            batch, res_height, res_width, out_channels);
-
-        for (std::size_t c = 0; c != out_channels; ++c)
-        {
-            auto k_tensor = blaze::quatslice(blaze::trans(k, {3, 0, 1, 2}), c);
-            auto res_tensor =
-                blaze::quatslice(blaze::trans(result, {3, 0, 1, 2}), c);
-            for (std::size_t l = 0; l != batch; ++l)
-            {
-                auto a_tensor = blaze::quatslice(q, l);
-                auto res_slice = blaze::pageslice(res_tensor, l);
-                for (std::size_t i = 0; i != res_height; ++i)
-                {
-                    for (std::size_t j = 0; j != res_width; ++j)
-                    {
-                        auto schur_product =
-                            blaze::subtensor(a_tensor, i, j, 0, filter_height,
-                                filter_width, in_channels) %
-                            k_tensor;
+        std::size_t res_height = arg.dimension(1) - kernel.dimension(0) + 1;
+        std::size_t res_width = arg.dimension(2) - kernel.dimension(1) + 1;
 
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv2d_gemm(
+            arg, kernel, res_height, res_width, common::conv_geometry{})};
     }
 
     primitive_argument_type conv2d_operation::conv2d_valid(
         ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
         std::int64_t stride_height, std::int64_t stride_width) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        std::size_t batch = q.quats();
-        std::size_t in_height = q.pages();
-        std::size_t in_width = q.rows();
-        std::size_t in_channels = q.columns();
-        std::size_t filter_height = k.quats();
-        std::size_t filter_width = k.pages();
-        std::size_t out_channels = k.columns();
+        std::size_t in_height = arg.dimension(1);
+        std::size_t in_width = arg.dimension(2);
+        std::size_t filter_height = kernel.dimension(0);
+        std::size_t filter_width = kernel.dimension(1);
 
         std::size_t res_height = blaze::ceil(
             static_cast<double>(in_height - filter_height + 1) / stride_height);
         std::size_t res_width = blaze::ceil(
             static_cast<double>(in_width - filter_width + 1) / stride_width);
 
-        blaze::DynamicArray<4UL, double> result(
-            batch, res_height, res_width, out_channels);
+        common::conv_geometry geometry;
+        geometry.stride_height = stride_height;
+        geometry.stride_width = stride_width;
 
-        for (std::size_t c = 0; c != out_channels; ++c)
-        {
-            auto k_tensor = blaze::quatslice(blaze::trans(k, {3, 0, 1, 2}), c);
-            auto res_tensor =
-                blaze::quatslice(blaze::trans(result, {3, 0, 1, 2}), c);
-            for (std::size_t l = 0; l != batch; ++l)
-            {
-                auto a_tensor = blaze::quatslice(q, l);
-                auto res_slice = blaze::pageslice(res_tensor, l);
-                for (std::size_t i = 0; i != res_height; ++i)
-                {
-                    for (std::size_t j = 0; j != res_width; ++j)
-                    {
-                        auto schur_product =
-                            blaze::subtensor(a_tensor, i * stride_height,
-                                j * stride_width, 0, filter_height,
-                                filter_width, in_channels) %
-                            k_tensor;
-
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv2d_gemm(
+            arg, kernel, res_height, res_width, geometry)};
     }
 
     primitive_argument_type conv2d_operation::conv2d_valid_dilation(
         ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
         std::int64_t dilation_height, std::int64_t dilation_width) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        auto filter_height = static_cast<std::int64_t>(k.quats());
-        auto filter_width= static_cast<std::int64_t>(k.pages());
-        auto in_height = static_cast<std::int64_t>(q.pages());
-        auto in_width  = static_cast<std::int64_t>(q.rows());
-        std::size_t batch = q.quats();
-        std::size_t in_channels = q.columns();
-        std::size_t out_channels = k.columns();
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
+        auto in_height = static_cast<std::int64_t>(arg.dimension(1));
+        auto in_width  = static_cast<std::int64_t>(arg.dimension(2));
 
         std::int64_t res_height =
             in_height - dilation_height * (filter_height - 1);
@@ -188,102 +122,37 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 generate_error_message("this dilation_rate causes non-positive "
                                        "result_length where padding is valid"));
 
-        blaze::DynamicArray<4UL, double> result(
-            batch, res_height, res_width, out_channels);
+        common::conv_geometry geometry;
+        geometry.dilation_height = dilation_height;
+        geometry.dilation_width = dilation_width;
 
-        for (std::size_t c = 0; c != out_channels; ++c)
-        {
-            auto k_tensor = blaze::quatslice(blaze::trans(k, {3, 0, 1, 2}), c);
-            auto res_tensor =
-                blaze::quatslice(blaze::trans(result, {3, 0, 1, 2}), c);
-            for (std::size_t l = 0; l != batch; ++l)
-            {
-                auto a_tensor = blaze::quatslice(q, l);
-                auto res_slice = blaze::pageslice(res_tensor, l);
-                for (std::size_t i = 0; i != res_height; ++i)
-                {
-                    for (std::size_t j = 0; j != res_width; ++j)
-                    {
-                        auto schur_product =
-                            blaze::dilatedsubtensor(a_tensor, i, j, 0,
-                                filter_height, filter_width, in_channels,
-                                dilation_height, dilation_width, 1) %
-                            k_tensor;
-
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv2d_gemm(
+            arg, kernel, res_height, res_width, geometry)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
     primitive_argument_type conv2d_operation::conv2d_same(
         ir::node_data<double>&& arg, ir::node_data<double>&& kernel) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        auto filter_height = static_cast<std::int64_t>(k.quats());
-        auto filter_width= static_cast<std::int64_t>(k.pages());
-        auto in_height = static_cast<std::int64_t>(q.pages());
-        auto in_width  = static_cast<std::int64_t>(q.rows());
-        std::size_t batch = q.quats();
-        std::size_t in_channels = q.columns();
-        std::size_t out_channels = k.columns();
-
-        std::int64_t pad_top = (filter_height - 1) / 2;
-        std::int64_t pad_left = (filter_width - 1) / 2;
-
-        blaze::DynamicArray<4UL, double> result(
-            batch, in_height, in_width, out_channels);
-
-        for (std::size_t c = 0; c != out_channels; ++c)
-        {
-            auto k_tensor = blaze::quatslice(blaze::trans(k, {3, 0, 1, 2}), c);
-            auto res_tensor =
-                blaze::quatslice(blaze::trans(result, {3, 0, 1, 2}), c);
-            for (std::size_t l = 0; l != batch; ++l)
-            {
-                auto a_tensor = blaze::quatslice(q, l);
-                auto res_slice = blaze::pageslice(res_tensor, l);
-                for (std::size_t i = 0; i != in_height; ++i)
-                {
-                    auto sub_height = conv_indices::get_subsizes(
-                        in_height, filter_height, i - pad_top);
-                    for (std::size_t j = 0; j != in_width; ++j)
-                    {
-                        auto sub_width = conv_indices::get_subsizes(
-                            in_width, filter_width, j - pad_left);
-                        auto schur_product =
-                            blaze::subtensor(a_tensor, sub_height.image_beg_,
-                                sub_width.image_beg_, 0, sub_height.size_,
-                                sub_width.size_, in_channels) %
-                            blaze::subtensor(k_tensor, sub_height.kernel_beg_,
-                                sub_width.kernel_beg_, 0, sub_height.size_,
-                                sub_width.size_, in_channels);
-
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
+
+        common::conv_geometry geometry;
+        geometry.pad_top = (filter_height - 1) / 2;
+        geometry.pad_left = (filter_width - 1) / 2;
+
+        return primitive_argument_type{common::conv2d_gemm(arg, kernel,
+            arg.dimension(1), arg.dimension(2), geometry)};
     }
 
     primitive_argument_type conv2d_operation::conv2d_same(
         ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
         std::int64_t stride_height, std::int64_t stride_width) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        auto filter_height = static_cast<std::int64_t>(k.quats());
-        auto filter_width= static_cast<std::int64_t>(k.pages());
-        auto in_height = static_cast<std::int64_t>(q.pages());
-        auto in_width  = static_cast<std::int64_t>(q.rows());
-        std::size_t batch = q.quats();
-        std::size_t in_channels = q.columns();
-        std::size_t out_channels = k.columns();
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
+        auto in_height = static_cast<std::int64_t>(arg.dimension(1));
+        auto in_width  = static_cast<std::int64_t>(arg.dimension(2));
         std::int64_t pad_height;
         std::int64_t pad_width;
 
@@ -320,100 +189,31 @@ namespace phylanx { namespace execution_tree { namespace primitives
             static_cast<double>(in_height + pad_height - filter_height + 1) /
             stride_height);
 
-        blaze::DynamicArray<4UL, double> result(
-            batch, res_height, res_width, out_channels);
-        std::int64_t pad_top  = pad_height / 2;
-        std::int64_t pad_left = pad_width / 2;
+        common::conv_geometry geometry;
+        geometry.pad_top = pad_height / 2;
+        geometry.pad_left = pad_width / 2;
+        geometry.stride_height = stride_height;
+        geometry.stride_width = stride_width;
 
-        for (std::size_t c = 0; c != out_channels; ++c)
-        {
-            auto k_tensor = blaze::quatslice(blaze::trans(k, {3, 0, 1, 2}), c);
-            auto res_tensor =
-                blaze::quatslice(blaze::trans(result, {3, 0, 1, 2}), c);
-            for (std::size_t l = 0; l != batch; ++l)
-            {
-                auto a_tensor = blaze::quatslice(q, l);
-                auto res_slice = blaze::pageslice(res_tensor, l);
-                for (std::size_t i = 0; i != res_height; ++i)
-                {
-                    auto sub_height = conv_indices::get_subsizes(
-                        in_height, filter_height, i * stride_height - pad_top);
-                    for (std::size_t j = 0; j != res_width; ++j)
-                    {
-                        auto sub_width = conv_indices::get_subsizes(in_width,
-                            filter_width, j * stride_width - pad_left);
-                        auto schur_product =
-                            blaze::subtensor(a_tensor, sub_height.image_beg_,
-                                sub_width.image_beg_, 0, sub_height.size_,
-                                sub_width.size_, in_channels) %
-                            blaze::subtensor(k_tensor, sub_height.kernel_beg_,
-                                sub_width.kernel_beg_, 0, sub_height.size_,
-                                sub_width.size_, in_channels);
-
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::conv2d_gemm(
+            arg, kernel, res_height, res_width, geometry)};
     }
 
     primitive_argument_type conv2d_operation::conv2d_same_dilation(
         ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
         std::int64_t dilation_height, std::int64_t dilation_width) const
     {
-        auto q = arg.quatern();
-        auto k = kernel.quatern();
-        auto filter_height = static_cast<std::int64_t>(k.quats());
-        auto filter_width= static_cast<std::int64_t>(k.pages());
-        auto in_height = static_cast<std::int64_t>(q.pages());
-        auto in_width  = static_cast<std::int64_t>(q.rows());
-        std::size_t batch = q.quats();
-        std::size_t in_channels = q.columns();
-        std::size_t out_channels = k.columns();
-
-        std::int64_t pad_top = (dilation_height * (filter_height - 1)) / 2;
-        std::int64_t pad_left = (dilation_width * (filter_width - 1)) / 2;
-
-        blaze::DynamicArray<4UL, double> result(blaze::init_from_value, 0.0,
-            batch, in_height, in_width, out_channels);
-
-        for (std::size_t c = 0; c != out_channels; ++c)
-        {
-            auto k_tensor = blaze::quatslice(blaze::trans(k, {3, 0, 1, 2}), c);
-            auto res_tensor =
-                blaze::quatslice(blaze::trans(result, {3, 0, 1, 2}), c);
-            for (std::size_t l = 0; l != batch; ++l)
-            {
-                auto a_tensor = blaze::quatslice(q, l);
-                auto res_slice = blaze::pageslice(res_tensor, l);
-                for (std::size_t i = 0; i != in_height; ++i)
-                {
-                    auto sub_height = conv_indices::get_subsizes_dilated(
-                        in_height, filter_height, i - pad_top, dilation_height);
-                    for (std::size_t j = 0; j != in_width; ++j)
-                    {
-                        auto sub_width =
-                            conv_indices::get_subsizes_dilated(in_width,
-                                filter_width, j - pad_left, dilation_width);
-                        if (sub_height.size_ == 0 || sub_width.size_ == 0)
-                            continue;
-
-                        auto schur_product =
-                            blaze::dilatedsubtensor(a_tensor,
-                                sub_height.image_beg_, sub_width.image_beg_, 0,
-                                sub_height.size_, sub_width.size_, in_channels,
-                                dilation_height, dilation_width, 1) %
-                            blaze::subtensor(k_tensor, sub_height.kernel_beg_,
-                                sub_width.kernel_beg_, 0, sub_height.size_,
-                                sub_width.size_, in_channels);
-
-                        res_slice(i, j) = blaze::sum(schur_product);
-                    }
-                }
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        auto filter_height = static_cast<std::int64_t>(kernel.dimension(0));
+        auto filter_width = static_cast<std::int64_t>(kernel.dimension(1));
+
+        common::conv_geometry geometry;
+        geometry.pad_top = (dilation_height * (filter_height - 1)) / 2;
+        geometry.pad_left = (dilation_width * (filter_width - 1)) / 2;
+        geometry.dilation_height = dilation_height;
+        geometry.dilation_width = dilation_width;
+
+        return primitive_argument_type{common::conv2d_gemm(arg, kernel,
+            arg.dimension(1), arg.dimension(2), geometry)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
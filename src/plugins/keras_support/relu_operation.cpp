@@ -215,6 +215,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
                 switch (t)
                 {
+                case node_data_type_int32: HPX_FALLTHROUGH;
                 case node_data_type_int64:
                 {
                     std::int64_t max_value;
@@ -251,6 +252,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 }
                 case node_data_type_unknown:
                     HPX_FALLTHROUGH;
+                case node_data_type_float32: HPX_FALLTHROUGH;
                 case node_data_type_double:
                 {
                     double max_value = 0.0;
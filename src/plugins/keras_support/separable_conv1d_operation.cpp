@@ -7,7 +7,7 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
-#include <phylanx/plugins/keras_support/conv_indices_helper.hpp>
+#include <phylanx/plugins/common/conv_gemm.hpp>
 #include <phylanx/plugins/keras_support/separable_conv1d_operation.hpp>
 
 #include <hpx/datastructures/optional.hpp>
@@ -77,34 +77,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
         ir::node_data<double>&& depth_kernel,
         ir::node_data<double>&& point_kernel) const
     {
-        auto a = arg.tensor();
-        auto dk = depth_kernel.tensor();
-        auto pk = point_kernel.tensor();
+        std::size_t result_length =
+            arg.dimension(1) - depth_kernel.dimension(0) + 1;
 
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t dk_length = dk.pages();
-        std::size_t dk_out_channels = dk.columns();
-        std::size_t pk_out_channels = pk.columns();
-        std::size_t result_length = a.rows() - dk_length + 1;
-
-        blaze::DynamicTensor<double> result(
-            batch, result_length, pk_out_channels, 0.);
-
-        for (std::size_t i = 0; i != in_channels; ++i)
-        {
-            for (std::size_t j = 0; j != result_length; ++j)
-            {
-                blaze::rowslice(result, j) +=
-                    blaze::trans(blaze::submatrix(blaze::columnslice(a, i), 0,
-                                     j, batch, dk_length) *
-                        blaze::trans(blaze::rowslice(dk, i)) *
-                        blaze::submatrix(blaze::pageslice(pk, 0),
-                            dk_out_channels * i, 0, dk_out_channels,
-                            pk_out_channels));
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::separable_conv1d_gemm(
+            arg, depth_kernel, point_kernel, result_length, 0, 1, 1)};
     }
 
     primitive_argument_type separable_conv1d_operation::sep_conv1d_valid(
@@ -112,35 +89,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         ir::node_data<double>&& depth_kernel,
         ir::node_data<double>&& point_kernel, std::int64_t strides) const
     {
-        auto a = arg.tensor();
-        auto dk = depth_kernel.tensor();
-        auto pk = point_kernel.tensor();
-
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t dk_length = dk.pages();
-        std::size_t dk_out_channels = dk.columns();
-        std::size_t pk_out_channels = pk.columns();
         std::size_t result_length = blaze::ceil(
-            static_cast<double>(a.rows() - dk_length + 1) / strides);
-
-        blaze::DynamicTensor<double> result(
-            batch, result_length, pk_out_channels, 0.);
+            static_cast<double>(
+                arg.dimension(1) - depth_kernel.dimension(0) + 1) /
+            strides);
 
-        for (std::size_t i = 0; i != in_channels; ++i)
-        {
-            for (std::size_t j = 0; j != result_length; ++j)
-            {
-                blaze::rowslice(result, j) +=
-                    blaze::trans(blaze::submatrix(blaze::columnslice(a, i), 0,
-                                     j * strides, batch, dk_length) *
-                        blaze::trans(blaze::rowslice(dk, i)) *
-                        blaze::submatrix(blaze::pageslice(pk, 0),
-                            dk_out_channels * i, 0, dk_out_channels,
-                            pk_out_channels));
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{common::separable_conv1d_gemm(
+            arg, depth_kernel, point_kernel, result_length, 0, strides, 1)};
     }
 
     primitive_argument_type
@@ -148,16 +103,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         ir::node_data<double>&& arg, ir::node_data<double>&& depth_kernel,
         ir::node_data<double>&& point_kernel, std::int64_t dilation_rate) const
     {
-        auto a = arg.tensor();
-        auto dk = depth_kernel.tensor();
-        auto pk = point_kernel.tensor();
-
-        auto dk_length = static_cast<std::int64_t>(dk.pages());
-        auto data_length = static_cast<std::int64_t>(a.rows());
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t dk_out_channels = dk.columns();
-        std::size_t pk_out_channels = pk.columns();
+        auto dk_length = static_cast<std::int64_t>(depth_kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
         std::int64_t result_length =
             data_length - dilation_rate * (dk_length - 1);
 
@@ -168,23 +115,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     "this dilation_rate causes non-positive "
                     "result_length where padding is valid"));
 
-        blaze::DynamicTensor<double> result(
-            batch, result_length, pk_out_channels, 0.);
-
-        for (std::size_t i = 0; i != in_channels; ++i)
-        {
-            for (std::size_t j = 0; j != result_length; ++j)
-            {
-                blaze::rowslice(result, j) += blaze::trans(
-                    blaze::dilatedsubmatrix(blaze::columnslice(a, i), 0, j,
-                        batch, dk_length, 1, dilation_rate) *
-                    blaze::trans(blaze::rowslice(dk, i)) *
-                    blaze::submatrix(blaze::pageslice(pk, 0),
-                        dk_out_channels * i, 0, dk_out_channels,
-                        pk_out_channels));
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{
+            common::separable_conv1d_gemm(arg, depth_kernel, point_kernel,
+                result_length, 0, 1, dilation_rate)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -193,54 +126,20 @@ namespace phylanx { namespace execution_tree { namespace primitives
         ir::node_data<double>&& depth_kernel,
         ir::node_data<double>&& point_kernel) const
     {
-        auto a = arg.tensor();
-        auto dk = depth_kernel.tensor();
-        auto pk = point_kernel.tensor();
-
-        auto dk_length = static_cast<std::int64_t>(dk.pages());
-        auto data_length = static_cast<std::int64_t>(a.rows());
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t dk_out_channels = dk.columns();
-        std::size_t pk_out_channels = pk.columns();
+        auto dk_length = static_cast<std::int64_t>(depth_kernel.dimension(0));
         std::int64_t pad_left = (dk_length - 1) / 2;
 
-        blaze::DynamicTensor<double> result(
-            batch, data_length, pk_out_channels, 0.);
-
-        for (std::size_t i = 0; i != in_channels; ++i)
-        {
-            for (std::size_t j = 0; j != data_length; ++j)
-            {
-                auto sub = conv_indices::get_subsizes(
-                    data_length, dk_length, j - pad_left);
-                blaze::rowslice(result, j) +=
-                    blaze::trans(blaze::submatrix(blaze::columnslice(a, i), 0,
-                                     sub.image_beg_, batch, sub.size_) *
-                        blaze::trans(blaze::submatrix(blaze::rowslice(dk, i), 0,
-                            sub.kernel_beg_, dk_out_channels, sub.size_)) *
-                        blaze::submatrix(blaze::pageslice(pk, 0),
-                            dk_out_channels * i, 0, dk_out_channels,
-                            pk_out_channels));
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{
+            common::separable_conv1d_gemm(arg, depth_kernel, point_kernel,
+                arg.dimension(1), pad_left, 1, 1)};
     }
 
     primitive_argument_type separable_conv1d_operation::sep_conv1d_same(
         ir::node_data<double>&& arg, ir::node_data<double>&& depth_kernel,
         ir::node_data<double>&& point_kernel, std::int64_t strides) const
     {
-        auto a = arg.tensor();
-        auto dk = depth_kernel.tensor();
-        auto pk = point_kernel.tensor();
-
-        auto dk_length = static_cast<std::int64_t>(dk.pages());
-        auto data_length = static_cast<std::int64_t>(a.rows());
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t dk_out_channels = dk.columns();
-        std::size_t pk_out_channels = pk.columns();
+        auto dk_length = static_cast<std::int64_t>(depth_kernel.dimension(0));
+        auto data_length = static_cast<std::int64_t>(arg.dimension(1));
         std::int64_t pad_width;
 
         if (data_length % strides == 0)
@@ -257,70 +156,23 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::size_t result_length = blaze::ceil(
             static_cast<double>(data_length + pad_width - dk_length + 1) /
             strides);
+        std::int64_t pad_left = pad_width / 2;
 
-        blaze::DynamicTensor<double> result(
-            batch, result_length, pk_out_channels, 0.);
-        std::size_t pad_left = pad_width / 2;
-
-        for (std::size_t i = 0; i != in_channels; ++i)
-        {
-            for (std::size_t j = 0; j != result_length; ++j)
-            {
-                auto sub = conv_indices::get_subsizes(
-                    data_length, dk_length, j * strides - pad_left);
-                blaze::rowslice(result, j) +=
-                    blaze::trans(blaze::submatrix(blaze::columnslice(a, i), 0,
-                                     sub.image_beg_, batch, sub.size_) *
-                        blaze::trans(blaze::submatrix(blaze::rowslice(dk, i), 0,
-                            sub.kernel_beg_, dk_out_channels, sub.size_)) *
-                        blaze::submatrix(blaze::pageslice(pk, 0),
-                            dk_out_channels * i, 0, dk_out_channels,
-                            pk_out_channels));
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{
+            common::separable_conv1d_gemm(arg, depth_kernel, point_kernel,
+                result_length, pad_left, strides, 1)};
     }
 
     primitive_argument_type separable_conv1d_operation::sep_conv1d_same_dilation(
         ir::node_data<double>&& arg, ir::node_data<double>&& depth_kernel,
         ir::node_data<double>&& point_kernel, std::int64_t dilation_rate) const
     {
-        auto a = arg.tensor();
-        auto dk = depth_kernel.tensor();
-        auto pk = point_kernel.tensor();
-
-        auto dk_length = static_cast<std::int64_t>(dk.pages());
-        auto data_length = static_cast<std::int64_t>(a.rows());
-        std::size_t batch = a.pages();
-        std::size_t in_channels = a.columns();
-        std::size_t dk_out_channels = dk.columns();
-        std::size_t pk_out_channels = pk.columns();
+        auto dk_length = static_cast<std::int64_t>(depth_kernel.dimension(0));
         std::int64_t pad_left = (dilation_rate * (dk_length - 1) ) / 2;
 
-        blaze::DynamicTensor<double> result(
-            batch, data_length, pk_out_channels, 0.);
-
-        for (std::size_t i = 0; i != in_channels; ++i)
-        {
-            for (std::size_t j = 0; j != data_length; ++j)
-            {
-                auto sub = conv_indices::get_subsizes_dilated(
-                    data_length, dk_length, j - pad_left, dilation_rate);
-
-                if (sub.size_ == 0)
-                    continue;
-
-                blaze::rowslice(result, j) += blaze::trans(
-                    blaze::dilatedsubmatrix(blaze::columnslice(a, i), 0,
-                        sub.image_beg_, batch, sub.size_, 1, dilation_rate) *
-                    blaze::trans(blaze::submatrix(blaze::rowslice(dk, i), 0,
-                        sub.kernel_beg_, dk_out_channels, sub.size_)) *
-                    blaze::submatrix(blaze::pageslice(pk, 0),
-                        dk_out_channels * i, 0, dk_out_channels,
-                        pk_out_channels));
-            }
-        }
-        return primitive_argument_type{std::move(result)};
+        return primitive_argument_type{
+            common::separable_conv1d_gemm(arg, depth_kernel, point_kernel,
+                arg.dimension(1), pad_left, 1, dilation_rate)};
     }
 
     ///////////////////////////////////////////////////////////////////////////
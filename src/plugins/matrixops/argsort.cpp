@@ -8,6 +8,7 @@
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/matrixops/argsort.hpp>
 #include <phylanx/util/matrix_iterators.hpp>
+#include <phylanx/util/parallel_sort.hpp>
 
 #include <hpx/iostream.hpp>
 #include <hpx/include/lcos.hpp>
@@ -48,9 +49,9 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                 The default is -1 (the last axis).
                 If nil, the flattend array is used.
 
-              kind (optional, {'quicksort', 'merrgesort', 'heapsort', 'stable'}):
-                Sorting algorithm.
-                *** ignored ***
+              kind (optional, {'quicksort', 'mergesort', 'heapsort', 'stable'}):
+                Sorting algorithm. 'mergesort' and 'stable' preserve the
+                relative order of equal elements.
 
               order (optional, {str, list of str}):
                 When a is an array with fields defined, this argument specifies which
@@ -86,8 +87,11 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
         auto flatten = blaze::ravel(mat);
         blaze::DynamicVector<std::int64_t> idx(mat.rows() * mat.columns());
         std::iota(idx.begin(), idx.end(), 0);
-        std::sort(idx.begin(), idx.end(),
-            [&flatten](size_t a, size_t b) { return flatten[a] < flatten[b]; });
+        util::parallel_sort(idx.begin(), idx.end(),
+            [&flatten](std::int64_t a, std::int64_t b) {
+                return flatten[a] < flatten[b];
+            },
+            util::is_stable_sort_kind(kind));
         return primitive_argument_type{std::move(idx)};
     }
 
@@ -100,8 +104,11 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
         blaze::DynamicVector<std::int64_t> idx(
             tensor.pages() * tensor.rows() * tensor.columns());
         std::iota(idx.begin(), idx.end(), 0);
-        std::sort(idx.begin(), idx.end(),
-            [&flatten](size_t a, size_t b) { return flatten[a] < flatten[b]; });
+        util::parallel_sort(idx.begin(), idx.end(),
+            [&flatten](std::int64_t a, std::int64_t b) {
+                return flatten[a] < flatten[b];
+            },
+            util::is_stable_sort_kind(kind));
         return primitive_argument_type{std::move(idx)};
     }
 
@@ -145,11 +152,13 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
                 extract_boolean_value_strict(
                     std::move(in_array), name_, codename_),
                 axis, kind, order);
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return argsort_flatten_helper(
                 extract_integer_value_strict(
                     std::move(in_array), name_, codename_),
                 axis, kind, order);
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return argsort_flatten_helper(
                 extract_numeric_value_strict(
@@ -178,8 +187,11 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
             auto vec = in_array.vector();
             blaze::DynamicVector<std::int64_t> idx(vec.size());
             std::iota(idx.begin(), idx.end(), 0);
-            std::sort(idx.begin(), idx.end(),
-                [&vec](size_t a, size_t b) { return vec[a] < vec[b]; });
+            util::parallel_sort(idx.begin(), idx.end(),
+                [&vec](std::int64_t a, std::int64_t b) {
+                    return vec[a] < vec[b];
+                },
+                util::is_stable_sort_kind(kind));
             return primitive_argument_type{std::move(idx)};
         }
         HPX_THROW_EXCEPTION(hpx::bad_parameter, "argsort::argsort1d",
@@ -192,24 +204,21 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
     primitive_argument_type argsort::argsort2d_axis0(
         ir::node_data<T>&& in_array, std::string kind, std::string order) const
     {
-        using phylanx::util::matrix_column_iterator;
         auto mat = in_array.matrix();
         blaze::DynamicMatrix<std::int64_t> idx(mat.rows(), mat.columns());
+        bool const stable = util::is_stable_sort_kind(kind);
 
-        matrix_column_iterator<decltype(mat)> mat_cols_begin(mat);
-        matrix_column_iterator<decltype(mat)> mat_cols_end(mat, mat.columns());
-
-        matrix_column_iterator<decltype(idx)> idx_cols_it(idx);
+        util::for_each_sequence(mat.columns(), mat.rows(), [&](std::size_t i) {
+            auto mat_col = blaze::column(mat, i);
+            auto idx_col = blaze::column(idx, i);
 
-        for (auto mat_col = mat_cols_begin; mat_col != mat_cols_end;
-             ++mat_col, ++idx_cols_it)
-        {
-            std::iota(idx_cols_it->begin(), idx_cols_it->end(), 0);
-            std::sort(idx_cols_it->begin(), idx_cols_it->end(),
-                [mat_col](size_t a, size_t b) {
-                    return *(mat_col->begin() + a) < *(mat_col->begin() + b);
-                });
-        }
+            std::iota(idx_col.begin(), idx_col.end(), 0);
+            util::parallel_sort(idx_col.begin(), idx_col.end(),
+                [&mat_col](std::int64_t a, std::int64_t b) {
+                    return mat_col[a] < mat_col[b];
+                },
+                stable);
+        });
 
         return primitive_argument_type{std::move(idx)};
     }
@@ -218,24 +227,21 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
     primitive_argument_type argsort::argsort2d_axis1(
         ir::node_data<T>&& in_array, std::string kind, std::string order) const
     {
-        using phylanx::util::matrix_row_iterator;
         auto mat = in_array.matrix();
         blaze::DynamicMatrix<std::int64_t> idx(mat.rows(), mat.columns());
+        bool const stable = util::is_stable_sort_kind(kind);
 
-        matrix_row_iterator<decltype(mat)> mat_rows_begin(mat);
-        matrix_row_iterator<decltype(mat)> mat_rows_end(mat, mat.rows());
+        util::for_each_sequence(mat.rows(), mat.columns(), [&](std::size_t i) {
+            auto mat_row = blaze::row(mat, i);
+            auto idx_row = blaze::row(idx, i);
 
-        matrix_row_iterator<decltype(idx)> idx_rows_it(idx);
-
-        for (auto mat_row = mat_rows_begin; mat_row != mat_rows_end;
-             ++mat_row, ++idx_rows_it)
-        {
-            std::iota(idx_rows_it->begin(), idx_rows_it->end(), 0);
-            std::sort(idx_rows_it->begin(), idx_rows_it->end(),
-                [mat_row](size_t a, size_t b) {
-                    return *(mat_row->begin() + a) < *(mat_row->begin() + b);
-                });
-        }
+            std::iota(idx_row.begin(), idx_row.end(), 0);
+            util::parallel_sort(idx_row.begin(), idx_row.end(),
+                [&mat_row](std::int64_t a, std::int64_t b) {
+                    return mat_row[a] < mat_row[b];
+                },
+                stable);
+        });
 
         return primitive_argument_type{std::move(idx)};
     }
@@ -270,31 +276,34 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
         auto tensor = in_array.tensor();
         blaze::DynamicTensor<std::int64_t> idx(
             tensor.pages(), tensor.rows(), tensor.columns());
-
-        for (size_t row = 0; row < tensor.rows(); ++row)
-        {
-            auto tensor_row_slice = blaze::rowslice(tensor, row);
-            matrix_row_iterator<decltype(tensor_row_slice)> const
-                mat_slice_rows_begin(tensor_row_slice);
-            matrix_row_iterator<decltype(tensor_row_slice)> const
-                mat_slice_rows_end(tensor_row_slice, tensor_row_slice.rows());
-
-            auto idx_row_slice = blaze::rowslice(idx, row);
-            matrix_row_iterator<decltype(idx_row_slice)> const
-                idx_slice_rows_begin(idx_row_slice);
-
-            auto idx_row = idx_slice_rows_begin;
-            for (auto mat_row = mat_slice_rows_begin;
-                 mat_row != mat_slice_rows_end; ++mat_row, ++idx_row)
-            {
-                std::iota(idx_row->begin(), idx_row->end(), 0);
-                std::sort(idx_row->begin(), idx_row->end(),
-                    [mat_row](size_t a, size_t b) {
-                        return *(mat_row->begin() + a) <
-                            *(mat_row->begin() + b);
-                    });
-            }
-        }
+        bool const stable = util::is_stable_sort_kind(kind);
+
+        util::for_each_sequence(tensor.rows(),
+            tensor.columns() * tensor.pages(), [&](std::size_t row) {
+                auto tensor_row_slice = blaze::rowslice(tensor, row);
+                matrix_row_iterator<decltype(tensor_row_slice)> const
+                    mat_slice_rows_begin(tensor_row_slice);
+                matrix_row_iterator<decltype(tensor_row_slice)> const
+                    mat_slice_rows_end(
+                        tensor_row_slice, tensor_row_slice.rows());
+
+                auto idx_row_slice = blaze::rowslice(idx, row);
+                matrix_row_iterator<decltype(idx_row_slice)> const
+                    idx_slice_rows_begin(idx_row_slice);
+
+                auto idx_row = idx_slice_rows_begin;
+                for (auto mat_row = mat_slice_rows_begin;
+                     mat_row != mat_slice_rows_end; ++mat_row, ++idx_row)
+                {
+                    std::iota(idx_row->begin(), idx_row->end(), 0);
+                    util::parallel_sort(idx_row->begin(), idx_row->end(),
+                        [mat_row](std::int64_t a, std::int64_t b) {
+                            return *(mat_row->begin() + a) <
+                                *(mat_row->begin() + b);
+                        },
+                        stable);
+                }
+            });
         return primitive_argument_type{std::move(idx)};
     }
 
@@ -306,32 +315,34 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
         auto tensor = in_array.tensor();
         blaze::DynamicTensor<std::int64_t> idx(
             tensor.pages(), tensor.rows(), tensor.columns());
-
-        for (size_t page = 0; page < tensor.columns(); ++page)
-        {
-            auto tensor_col_slice = blaze::columnslice(tensor, page);
-            matrix_row_iterator<decltype(tensor_col_slice)> const
-                mat_slice_rows_begin(tensor_col_slice);
-            matrix_row_iterator<decltype(tensor_col_slice)> const
-                mat_slice_rows_end(
-                    tensor_col_slice, tensor_col_slice.columns());
-
-            auto idx_col_slice = blaze::columnslice(idx, page);
-            matrix_row_iterator<decltype(idx_col_slice)> const
-                idx_slice_rows_begin(idx_col_slice);
-
-            auto idx_row = idx_slice_rows_begin;
-            for (auto mat_row = mat_slice_rows_begin;
-                 mat_row != mat_slice_rows_end; ++mat_row, ++idx_row)
-            {
-                std::iota(idx_row->begin(), idx_row->end(), 0);
-                std::sort(idx_row->begin(), idx_row->end(),
-                    [mat_row](size_t a, size_t b) {
-                        return *(mat_row->begin() + a) <
-                            *(mat_row->begin() + b);
-                    });
-            }
-        }
+        bool const stable = util::is_stable_sort_kind(kind);
+
+        util::for_each_sequence(tensor.columns(),
+            tensor.pages() * tensor.rows(), [&](std::size_t page) {
+                auto tensor_col_slice = blaze::columnslice(tensor, page);
+                matrix_row_iterator<decltype(tensor_col_slice)> const
+                    mat_slice_rows_begin(tensor_col_slice);
+                matrix_row_iterator<decltype(tensor_col_slice)> const
+                    mat_slice_rows_end(
+                        tensor_col_slice, tensor_col_slice.rows());
+
+                auto idx_col_slice = blaze::columnslice(idx, page);
+                matrix_row_iterator<decltype(idx_col_slice)> const
+                    idx_slice_rows_begin(idx_col_slice);
+
+                auto idx_row = idx_slice_rows_begin;
+                for (auto mat_row = mat_slice_rows_begin;
+                     mat_row != mat_slice_rows_end; ++mat_row, ++idx_row)
+                {
+                    std::iota(idx_row->begin(), idx_row->end(), 0);
+                    util::parallel_sort(idx_row->begin(), idx_row->end(),
+                        [mat_row](std::int64_t a, std::int64_t b) {
+                            return *(mat_row->begin() + a) <
+                                *(mat_row->begin() + b);
+                        },
+                        stable);
+                }
+            });
         return primitive_argument_type{std::move(idx)};
     }
 
@@ -343,33 +354,35 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
         auto tensor = in_array.tensor();
         blaze::DynamicTensor<std::int64_t> idx(
             tensor.pages(), tensor.rows(), tensor.columns());
-
-        for (size_t page = 0; page < tensor.pages(); ++page)
-        {
-            auto tensor_page_slice = blaze::pageslice(tensor, page);
-
-            matrix_row_iterator<decltype(tensor_page_slice)> const
-                mat_slice_pages_begin(tensor_page_slice);
-            matrix_row_iterator<decltype(tensor_page_slice)> const
-                mat_slice_pages_end(
-                    tensor_page_slice, tensor_page_slice.rows());
-
-            auto idx_page_slice = blaze::pageslice(idx, page);
-            matrix_row_iterator<decltype(idx_page_slice)> const
-                idx_slice_pages_begin(idx_page_slice);
-
-            auto idx_page = idx_slice_pages_begin;
-            for (auto mat_page = mat_slice_pages_begin;
-                 mat_page != mat_slice_pages_end; ++mat_page, ++idx_page)
-            {
-                std::iota(idx_page->begin(), idx_page->end(), 0);
-                std::sort(idx_page->begin(), idx_page->end(),
-                    [mat_page](size_t a, size_t b) {
-                        return *(mat_page->begin() + a) <
-                            *(mat_page->begin() + b);
-                    });
-            }
-        }
+        bool const stable = util::is_stable_sort_kind(kind);
+
+        util::for_each_sequence(tensor.pages(),
+            tensor.rows() * tensor.columns(), [&](std::size_t page) {
+                auto tensor_page_slice = blaze::pageslice(tensor, page);
+
+                matrix_row_iterator<decltype(tensor_page_slice)> const
+                    mat_slice_pages_begin(tensor_page_slice);
+                matrix_row_iterator<decltype(tensor_page_slice)> const
+                    mat_slice_pages_end(
+                        tensor_page_slice, tensor_page_slice.rows());
+
+                auto idx_page_slice = blaze::pageslice(idx, page);
+                matrix_row_iterator<decltype(idx_page_slice)> const
+                    idx_slice_pages_begin(idx_page_slice);
+
+                auto idx_page = idx_slice_pages_begin;
+                for (auto mat_page = mat_slice_pages_begin;
+                     mat_page != mat_slice_pages_end; ++mat_page, ++idx_page)
+                {
+                    std::iota(idx_page->begin(), idx_page->end(), 0);
+                    util::parallel_sort(idx_page->begin(), idx_page->end(),
+                        [mat_page](std::int64_t a, std::int64_t b) {
+                            return *(mat_page->begin() + a) <
+                                *(mat_page->begin() + b);
+                        },
+                        stable);
+                }
+            });
         return primitive_argument_type{std::move(idx)};
     }
 
@@ -444,6 +457,13 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
                     -> primitive_argument_type {
                     std::string kind = extract_string_value_strict(
                         std::move(args[2]), this_->name_, this_->codename_);
+                    if (!util::is_valid_sort_kind(kind))
+                    {
+                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                            "argsort::eval",
+                            this_->generate_error_message(
+                                "sort algorithm not supported"));
+                    }
                     // TODO: order is ignored!
                     std::string order = "";
 
@@ -472,12 +492,14 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
                                     this_->name_, this_->codename_),
                                 axis, kind, order);
 
+                        case node_data_type_int32: HPX_FALLTHROUGH;
                         case node_data_type_int64:
                             return this_->argsort_helper(
                                 extract_integer_value_strict(std::move(args[0]),
                                     this_->name_, this_->codename_),
                                 axis, kind, order);
 
+                        case node_data_type_float32: HPX_FALLTHROUGH;
                         case node_data_type_double:
                             return this_->argsort_helper(
                                 extract_numeric_value_strict(std::move(args[0]),
@@ -191,10 +191,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         {
         case node_data_type_bool:
             return constant0d_helper<std::uint8_t>(std::move(op));
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return constant0d_helper<std::int64_t>(std::move(op));
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return constant0d_helper<double>(std::move(op));
         default:
@@ -237,11 +239,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return constant1d_helper<std::uint8_t>(std::move(op), dim);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return constant1d_helper<std::int64_t>(std::move(op), dim);
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return constant1d_helper<double>(std::move(op), dim);
 
@@ -287,11 +291,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return constant2d_helper<std::uint8_t>(std::move(op), dim);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return constant2d_helper<std::int64_t>(std::move(op), dim);
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return constant2d_helper<double>(std::move(op), dim);
 
@@ -339,11 +345,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return constant3d_helper<std::uint8_t>(std::move(op), dim);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return constant3d_helper<std::int64_t>(std::move(op), dim);
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return constant3d_helper<double>(std::move(op), dim);
 
@@ -397,11 +405,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return constant4d_helper<std::uint8_t>(std::move(op), dim);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return constant4d_helper<std::int64_t>(std::move(op), dim);
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return constant4d_helper<double>(std::move(op), dim);
 
@@ -68,10 +68,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return primitive_argument_type{detail::count_nonzero0d(
                 extract_node_data<std::uint8_t>(std::move(arg)))};
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return primitive_argument_type{detail::count_nonzero0d(
                 extract_node_data<std::int64_t>(std::move(arg)))};
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return primitive_argument_type{detail::count_nonzero0d(
                 extract_node_data<double>(std::move(arg)))};
@@ -104,10 +106,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return primitive_argument_type{detail::count_nonzero1d(
                 extract_node_data<std::uint8_t>(std::move(arg)))};
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return primitive_argument_type{detail::count_nonzero1d(
                 extract_node_data<std::int64_t>(std::move(arg)))};
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return primitive_argument_type{detail::count_nonzero1d(
                 extract_node_data<double>(std::move(arg)))};
@@ -140,10 +144,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return primitive_argument_type{detail::count_nonzero2d(
                 extract_node_data<std::uint8_t>(std::move(arg)))};
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return primitive_argument_type{detail::count_nonzero2d(
                 extract_node_data<std::int64_t>(std::move(arg)))};
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return primitive_argument_type{detail::count_nonzero2d(
                 extract_node_data<double>(std::move(arg)))};
@@ -387,12 +387,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value(std::move(lhs), name_, codename_),
                 extract_boolean_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return cross1d(
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return cross1d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -419,12 +421,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value(std::move(lhs), name_, codename_),
                 extract_boolean_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return cross2d(
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return cross2d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -65,10 +65,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return determinant0d(
                 extract_boolean_value_strict(std::move(op), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return determinant0d(
                 extract_integer_value_strict(std::move(op), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return determinant0d(
                 extract_numeric_value_strict(std::move(op), name_, codename_));
@@ -102,10 +104,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         switch (extract_common_type(op))
         {
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return determinant2d(
                 extract_numeric_value_strict(std::move(op), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:  HPX_FALLTHROUGH;
         case node_data_type_bool:   HPX_FALLTHROUGH;
         case node_data_type_unknown:
@@ -85,11 +85,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arg), name_, codename_),
                 k);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return diag1d(
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 k);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return diag1d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
@@ -120,11 +122,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arg), name_, codename_),
                 k);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return diag2d(
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 k);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return diag2d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
@@ -7,6 +7,7 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/execution_tree/primitives/sparse_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/common/dot_operation_nd.hpp>
 #include <phylanx/plugins/matrixops/dot_operation.hpp>
@@ -19,6 +20,7 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -136,6 +138,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value(std::move(lhs), name_, codename_),
                 extract_boolean_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return outer1d(
                 extract_integer_value(std::move(lhs), name_, codename_),
@@ -143,6 +146,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return outer1d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -169,6 +173,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value(std::move(lhs), name_, codename_),
                 extract_boolean_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return outer2d(
                 extract_integer_value(std::move(lhs), name_, codename_),
@@ -176,6 +181,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return outer2d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -202,6 +208,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value(std::move(lhs), name_, codename_),
                 extract_boolean_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return outer3d(
                 extract_integer_value(std::move(lhs), name_, codename_),
@@ -209,6 +216,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return outer3d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -235,6 +243,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value(std::move(lhs), name_, codename_),
                 extract_boolean_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return contraction2d(
                 extract_integer_value(std::move(lhs), name_, codename_),
@@ -242,6 +251,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return contraction2d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -268,6 +278,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value(std::move(lhs), name_, codename_),
                 extract_boolean_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return contraction3d(
                 extract_integer_value(std::move(lhs), name_, codename_),
@@ -275,6 +286,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return contraction3d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -303,6 +315,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value(std::move(rhs), name_, codename_), axis_a,
                 axis_b);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return tensordot_range_of_scalars(
                 extract_integer_value(std::move(lhs), name_, codename_),
@@ -311,6 +324,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return tensordot_range_of_scalars(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -338,6 +352,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value(std::move(lhs), name_, codename_),
                 extract_boolean_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return outer_nd_helper(
                 extract_integer_value(std::move(lhs), name_, codename_),
@@ -345,6 +360,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return outer_nd_helper(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -361,10 +377,108 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 "be numeric data types"));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // dot product for any combination of sparse and dense vectors and
+        // matrices
+        template <typename Lhs, typename Rhs>
+        typename std::enable_if<blaze::IsVector<Lhs>::value &&
+                blaze::IsVector<Rhs>::value,
+            primitive_argument_type>::type
+        sparse_dot(Lhs const& lhs, Rhs const& rhs)
+        {
+            return primitive_argument_type{blaze::dot(lhs, rhs)};
+        }
+
+        template <typename Lhs, typename Rhs>
+        typename std::enable_if<blaze::IsVector<Lhs>::value &&
+                blaze::IsMatrix<Rhs>::value,
+            primitive_argument_type>::type
+        sparse_dot(Lhs const& lhs, Rhs const& rhs)
+        {
+            return primitive_argument_type{
+                sparse_or_dense_result<double>(blaze::trans(rhs) * lhs)};
+        }
+
+        template <typename Lhs, typename Rhs>
+        typename std::enable_if<blaze::IsMatrix<Lhs>::value &&
+                blaze::IsVector<Rhs>::value,
+            primitive_argument_type>::type
+        sparse_dot(Lhs const& lhs, Rhs const& rhs)
+        {
+            return primitive_argument_type{
+                sparse_or_dense_result<double>(lhs * rhs)};
+        }
+
+        template <typename Lhs, typename Rhs>
+        typename std::enable_if<blaze::IsMatrix<Lhs>::value &&
+                blaze::IsMatrix<Rhs>::value,
+            primitive_argument_type>::type
+        sparse_dot(Lhs const& lhs, Rhs const& rhs)
+        {
+            return primitive_argument_type{
+                sparse_or_dense_result<double>(lhs * rhs)};
+        }
+    }
+
+    primitive_argument_type dot_operation::dot_sparse(
+        ir::node_data<double>&& lhs, ir::node_data<double>&& rhs) const
+    {
+        std::size_t lhs_dims = lhs.num_dimensions();
+        std::size_t rhs_dims = rhs.num_dimensions();
+
+        // scaling a sparse array keeps it sparse
+        if (lhs_dims == 0 || rhs_dims == 0)
+        {
+            double scale = lhs_dims == 0 ? lhs.scalar() : rhs.scalar();
+            ir::node_data<double>& arr = lhs_dims == 0 ? rhs : lhs;
+
+            if (arr.index() == ir::node_data<double>::sparse_storage1d)
+            {
+                return primitive_argument_type{ir::node_data<double>{
+                    blaze::CompressedVector<double>(
+                        arr.sparse_vector() * scale)}};
+            }
+            return primitive_argument_type{
+                ir::node_data<double>{blaze::CompressedMatrix<double>(
+                    arr.sparse_matrix() * scale)}};
+        }
+
+        if (lhs.dimension(int(lhs_dims) - 1) != rhs.dimension(0))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dot_operation::dot_sparse",
+                generate_error_message(
+                    "the operands have incompatible number of dimensions"));
+        }
+
+        return visit_sparse_or_dense(lhs,
+            [&](auto const& l) -> primitive_argument_type
+            {
+                return visit_sparse_or_dense(rhs,
+                    [&](auto const& r) -> primitive_argument_type
+                    {
+                        return detail::sparse_dot(l, r);
+                    });
+            });
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     primitive_argument_type dot_operation::dot_nd(
         primitive_argument_type&& lhs, primitive_argument_type&& rhs) const
     {
+        // sparse operands are multiplied without expanding them, unless the
+        // other operand has more than two dimensions
+        if ((is_sparse_operand(lhs) || is_sparse_operand(rhs)) &&
+            extract_numeric_value_dimension(lhs, name_, codename_) <= 2 &&
+            extract_numeric_value_dimension(rhs, name_, codename_) <= 2)
+        {
+            return dot_sparse(
+                extract_sparse_numeric_value(std::move(lhs), name_, codename_),
+                extract_sparse_numeric_value(std::move(rhs), name_, codename_));
+        }
+
         switch (extract_numeric_value_dimension(lhs, name_, codename_))
         {
         case 0:
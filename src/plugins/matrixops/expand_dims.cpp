@@ -95,10 +95,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return expand_dims_0d(extract_boolean_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return expand_dims_0d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return expand_dims_0d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_));
@@ -211,11 +213,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                           std::move(args[0]), name_, codename_),
                     axis, std::move(arr_localities));
 
+            case node_data_type_int32: HPX_FALLTHROUGH;
             case node_data_type_int64:
                 return expand_dims_1d(extract_integer_value_strict(
                                           std::move(args[0]), name_, codename_),
                     axis, std::move(arr_localities));
 
+            case node_data_type_float32: HPX_FALLTHROUGH;
             case node_data_type_double:
                 return expand_dims_1d(extract_numeric_value_strict(
                                           std::move(args[0]), name_, codename_),
@@ -244,10 +248,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return expand_dims_1d(extract_boolean_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return expand_dims_1d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return expand_dims_1d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
@@ -318,10 +324,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return expand_dims_2d(extract_boolean_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return expand_dims_2d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return expand_dims_2d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
@@ -417,10 +425,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return expand_dims_3d(extract_boolean_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return expand_dims_3d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return expand_dims_3d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
@@ -194,10 +194,12 @@ namespace phylanx { namespace execution_tree { namespace primitives {
     {
         switch (extract_common_type(op))
         {
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return gaussInverse2d(
                 extract_numeric_value_strict(std::move(op), name_, codename_));
         case node_data_type_bool:
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
         case node_data_type_unknown:
             return gaussInverse2d(
@@ -105,6 +105,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         switch (t)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return linmatrix(nx, ny,
                 extract_scalar_integer_value(std::move(x0), name_, codename_),
@@ -112,6 +113,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_scalar_integer_value(std::move(dy), name_, codename_));
 
         case node_data_type_bool:   HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return linmatrix(nx, ny,
@@ -94,6 +94,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         switch (t)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return linspace1d(
                 extract_scalar_integer_value(std::move(start), name_, codename_),
@@ -101,6 +102,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 nelements);
 
         case node_data_type_bool:   HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return linspace1d(
@@ -280,12 +280,14 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                 type, std::move(ord), std::move(axis), keepdims,
                 std::move(ctx));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return norm_helper(
                 extract_integer_value_strict(std::move(data), name_, codename_),
                 type, std::move(ord), std::move(axis), keepdims,
                 std::move(ctx));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return norm_helper(
                 extract_numeric_value_strict(std::move(data), name_, codename_),
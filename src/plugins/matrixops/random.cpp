@@ -159,6 +159,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return detail::adjust_dimensions(
                 util::get<4>(val), name, codename);
 
+        case primitive_argument_type::float32_index:
+            return detail::adjust_dimensions(
+                util::get<9>(val), name, codename);
+
+        case primitive_argument_type::int32_index:
+            return detail::adjust_dimensions(
+                util::get<10>(val), name, codename);
+
         case primitive_argument_type::list_index:
             {
                 std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> result{};
@@ -381,88 +389,74 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         ///////////////////////////////////////////////////////////////////////
         template <typename Dist, typename T>
-        ir::node_data<T> randomize(Dist& dist, T& d)
+        ir::node_data<T> randomize(
+            Dist const& dist, util::random_stream const& stream, T& d)
         {
-            d = dist(util::rng_);
+            Dist local(dist);
+            d = util::random_element(local, stream, 0);
             return ir::node_data<T>{d};
         }
 
         template <typename Dist, typename T>
-        ir::node_data<T> randomize(
-            Dist& dist, blaze::DynamicVector<T>& v)
+        ir::node_data<T> randomize(Dist const& dist,
+            util::random_stream const& stream, blaze::DynamicVector<T>& v)
         {
-            std::size_t const size = v.size();
-
-            for (std::size_t i = 0; i != size; ++i)
-            {
-                v[i] = dist(util::rng_);
-            }
+            util::random_for_each(
+                v.size(), dist, [&](Dist& local, std::size_t i) {
+                    v[i] = util::random_element(local, stream, i);
+                });
 
             return ir::node_data<T>{std::move(v)};
         }
 
         template <typename Dist, typename T>
-        ir::node_data<T> randomize(
-            Dist& dist, blaze::DynamicMatrix<T>& m)
+        ir::node_data<T> randomize(Dist const& dist,
+            util::random_stream const& stream, blaze::DynamicMatrix<T>& m)
         {
-            std::size_t const rows = m.rows();
             std::size_t const columns = m.columns();
 
-            for (std::size_t i = 0; i != rows; ++i)
-            {
-                for (std::size_t j = 0; j != columns; ++j)
-                {
-                    m(i, j) = dist(util::rng_);
-                }
-            }
+            util::random_for_each(m.rows() * columns, dist,
+                [&](Dist& local, std::size_t index) {
+                    m(index / columns, index % columns) =
+                        util::random_element(local, stream, index);
+                });
 
             return ir::node_data<T>{std::move(m)};
         }
 
         template <typename Dist, typename T>
-        ir::node_data<T> randomize(
-            Dist& dist, blaze::DynamicTensor<T>& t)
+        ir::node_data<T> randomize(Dist const& dist,
+            util::random_stream const& stream, blaze::DynamicTensor<T>& t)
         {
-            std::size_t const pages = t.pages();
             std::size_t const rows = t.rows();
             std::size_t const columns = t.columns();
 
-            for (std::size_t k = 0; k != pages; ++k)
-            {
-                for (std::size_t i = 0; i != rows; ++i)
-                {
-                    for (std::size_t j = 0; j != columns; ++j)
-                    {
-                        t(k, i, j) = dist(util::rng_);
-                    }
-                }
-            }
+            util::random_for_each(t.pages() * rows * columns, dist,
+                [&](Dist& local, std::size_t index) {
+                    std::size_t const row = index / columns;
+                    t(row / rows, row % rows, index % columns) =
+                        util::random_element(local, stream, index);
+                });
 
             return ir::node_data<T>{std::move(t)};
         }
 
         template <typename Dist, typename T>
-        ir::node_data<T> randomize(
-            Dist& dist, blaze::DynamicArray<4UL, T>& q)
+        ir::node_data<T> randomize(Dist const& dist,
+            util::random_stream const& stream, blaze::DynamicArray<4UL, T>& q)
         {
-            std::size_t const quats = q.quats();
             std::size_t const pages = q.pages();
             std::size_t const rows  = q.rows();
             std::size_t const columns = q.columns();
 
-            for (std::size_t l = 0; l != quats; ++l)
-            {
-                for (std::size_t k = 0; k != pages; ++k)
-                {
-                    for (std::size_t i = 0; i != rows; ++i)
-                    {
-                        for (std::size_t j = 0; j != columns; ++j)
-                        {
-                            q(l, k, i, j) = dist(util::rng_);
-                        }
-                    }
-                }
-            }
+            util::random_for_each(q.quats() * pages * rows * columns, dist,
+                [&](Dist& local, std::size_t index) {
+                    std::size_t const row = index / columns;
+                    std::size_t const page = row / rows;
+                    q(page / pages, page % pages, row % rows,
+                        index % columns) =
+                        util::random_element(local, stream, index);
+                });
 
             return ir::node_data<T>{std::move(q)};
         }
@@ -509,17 +503,20 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         template <typename T, typename Dist, typename Array>
         primitive_argument_type randomize(
-            Dist& dist, Array& data, node_data_type dtype,
+            Dist const& dist, Array& data, node_data_type dtype,
             std::string const& name, std::string const& codename,
             eval_context ctx)
         {
-            ir::node_data<T> result = randomize(dist, data);
+            ir::node_data<T> result =
+                randomize(dist, util::next_random_stream(), data);
             switch (dtype)
             {
+            case node_data_type_int32: HPX_FALLTHROUGH;
             case node_data_type_int64:
                 return convert_to<std::int64_t>(std::move(result));
 
             case node_data_type_unknown: HPX_FALLTHROUGH;
+            case node_data_type_float32: HPX_FALLTHROUGH;
             case node_data_type_double:
                 return convert_to<double>(std::move(result));
 
@@ -918,11 +918,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         extract_boolean_value(
                             std::move(args[0]), this_->name_, this_->codename_),
                         extract_integer_value_strict(std::move(args[1])), axis);
+                case node_data_type_int32: HPX_FALLTHROUGH;
                 case node_data_type_int64:
                     return this_->repeatnd(
                         extract_integer_value(
                             std::move(args[0]), this_->name_, this_->codename_),
                         extract_integer_value_strict(std::move(args[1])), axis);
+                case node_data_type_float32: HPX_FALLTHROUGH;
                 case node_data_type_double:
                     return this_->repeatnd(
                         extract_numeric_value(
@@ -198,11 +198,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return reshape0d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return reshape0d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -319,11 +321,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return reshape1d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return reshape1d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -462,11 +466,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return reshape2d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return reshape2d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -599,11 +605,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return reshape3d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return reshape3d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -786,10 +794,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         return this_->flatten_nd(extract_boolean_value_strict(
                             std::move(arr), this_->name_, this_->codename_));
 
+                    case node_data_type_int32: HPX_FALLTHROUGH;
                     case node_data_type_int64:
                         return this_->flatten_nd(extract_integer_value_strict(
                             std::move(arr), this_->name_, this_->codename_));
 
+                    case node_data_type_float32: HPX_FALLTHROUGH;
                     case node_data_type_double:
                         return this_->flatten_nd(extract_numeric_value_strict(
                             std::move(arr), this_->name_, this_->codename_));
@@ -894,12 +904,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                 std::move(arr), this_->name_, this_->codename_),
                             std::move(order));
 
+                    case node_data_type_int32: HPX_FALLTHROUGH;
                     case node_data_type_int64:
                         return this_->flatten_nd(
                             extract_integer_value_strict(
                                 std::move(arr), this_->name_, this_->codename_),
                             std::move(order));
 
+                    case node_data_type_float32: HPX_FALLTHROUGH;
                     case node_data_type_double:
                         return this_->flatten_nd(
                             extract_numeric_value_strict(
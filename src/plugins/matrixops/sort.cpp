@@ -9,6 +9,7 @@
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/matrixops/sort.hpp>
 #include <phylanx/util/matrix_iterators.hpp>
+#include <phylanx/util/parallel_sort.hpp>
 #include <phylanx/util/tensor_iterators.hpp>
 
 #include <hpx/include/lcos.hpp>
@@ -65,7 +66,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         blaze::DynamicVector<T> result(m.rows() * m.columns());
 
         std::copy(r.begin(), r.end(), result.begin());
-        std::sort(result.begin(), result.begin() + result.size());
+        util::parallel_sort(result.begin(), result.end(),
+            util::is_stable_sort_kind(kind));
         return primitive_argument_type{std::move(result)};
     }
 
@@ -78,7 +80,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         blaze::DynamicVector<T> result(t.pages() * t.rows() * t.columns());
 
         std::copy(r.begin(), r.end(), result.begin());
-        std::sort(result.begin(), result.begin() + result.size());
+        util::parallel_sort(result.begin(), result.end(),
+            util::is_stable_sort_kind(kind));
         return primitive_argument_type{std::move(result)};
     }
 
@@ -121,11 +124,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arg), name_, codename_),
                 kind);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return sort_flatten_helper(
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 kind);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return sort_flatten_helper(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
@@ -152,7 +157,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         {
             auto v = arg.vector();
 
-            std::sort(v.begin(), v.begin() + v.size());
+            util::parallel_sort(
+                v.begin(), v.end(), util::is_stable_sort_kind(kind));
             return primitive_argument_type{std::move(arg)};
         }
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -165,16 +171,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type sort::sort2d_axis0(ir::node_data<T>&& arg,
         std::string kind) const
     {
-        using phylanx::util::matrix_column_iterator;
         auto m = arg.matrix();
+        bool const stable = util::is_stable_sort_kind(kind);
 
-        matrix_column_iterator<decltype(m)> m_begin(m);
-        const matrix_column_iterator<decltype(m)> m_end(m, m.columns());
-
-        for (auto it = m_begin; it != m_end; ++it)
-        {
-            std::sort(it->begin(), it->end());
-        }
+        util::for_each_sequence(m.columns(), m.rows(), [&](std::size_t i) {
+            auto c = blaze::column(m, i);
+            util::parallel_sort(c.begin(), c.end(), stable);
+        });
 
         return primitive_argument_type{std::move(arg)};
     }
@@ -184,15 +187,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::string kind) const
     {
         auto m = arg.matrix();
-        using phylanx::util::matrix_row_iterator;
+        bool const stable = util::is_stable_sort_kind(kind);
 
-        matrix_row_iterator<decltype(m)> m_begin(m);
-        const matrix_row_iterator<decltype(m)> m_end(m, m.rows());
-
-        for (auto it = m_begin; it != m_end; ++it)
-        {
-            std::sort(it->begin(), it->end());
-        }
+        util::for_each_sequence(m.rows(), m.columns(), [&](std::size_t i) {
+            auto r = blaze::row(m, i);
+            util::parallel_sort(r.begin(), r.end(), stable);
+        });
 
         return primitive_argument_type{std::move(arg)};
     }
@@ -227,17 +227,18 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         using phylanx::util::matrix_row_iterator;
         auto t = arg.tensor();
-
-        for (std::size_t i = 0; i != t.rows(); ++i)
-        {
-            auto slice = blaze::rowslice(t, i);
-            matrix_row_iterator<decltype(slice)> const a_begin(slice);
-            matrix_row_iterator<decltype(slice)> const a_end(
-                slice, slice.rows());
-
-            for (auto it = a_begin; it != a_end; ++it)
-                std::sort(it->begin(), it->end());
-        }
+        bool const stable = util::is_stable_sort_kind(kind);
+
+        util::for_each_sequence(t.rows(), t.columns() * t.pages(),
+            [&](std::size_t i) {
+                auto slice = blaze::rowslice(t, i);
+                matrix_row_iterator<decltype(slice)> const a_begin(slice);
+                matrix_row_iterator<decltype(slice)> const a_end(
+                    slice, slice.rows());
+
+                for (auto it = a_begin; it != a_end; ++it)
+                    util::parallel_sort(it->begin(), it->end(), stable);
+            });
         return primitive_argument_type{std::move(arg)};
     }
 
@@ -247,17 +248,18 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         using phylanx::util::matrix_row_iterator;
         auto t = arg.tensor();
-
-        for (std::size_t i = 0; i != t.columns(); ++i)
-        {
-            auto slice = blaze::columnslice(t, i);
-            matrix_row_iterator<decltype(slice)> const a_begin(slice);
-            matrix_row_iterator<decltype(slice)> const a_end(
-                slice, slice.rows());
-
-            for (auto it = a_begin; it != a_end; ++it)
-                std::sort(it->begin(), it->end());
-        }
+        bool const stable = util::is_stable_sort_kind(kind);
+
+        util::for_each_sequence(t.columns(), t.pages() * t.rows(),
+            [&](std::size_t i) {
+                auto slice = blaze::columnslice(t, i);
+                matrix_row_iterator<decltype(slice)> const a_begin(slice);
+                matrix_row_iterator<decltype(slice)> const a_end(
+                    slice, slice.rows());
+
+                for (auto it = a_begin; it != a_end; ++it)
+                    util::parallel_sort(it->begin(), it->end(), stable);
+            });
         return primitive_argument_type{std::move(arg)};
     }
 
@@ -267,17 +269,18 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         using phylanx::util::matrix_column_iterator;
         auto t = arg.tensor();
-
-        for (std::size_t i = 0; i != t.rows(); ++i)
-        {
-            auto slice = blaze::rowslice(t, i);
-            matrix_column_iterator<decltype(slice)> const a_begin(slice);
-            matrix_column_iterator<decltype(slice)> const a_end(
-                slice, slice.columns());
-
-            for (auto it = a_begin; it != a_end; ++it)
-                std::sort(it->begin(), it->end());
-        }
+        bool const stable = util::is_stable_sort_kind(kind);
+
+        util::for_each_sequence(t.rows(), t.columns() * t.pages(),
+            [&](std::size_t i) {
+                auto slice = blaze::rowslice(t, i);
+                matrix_column_iterator<decltype(slice)> const a_begin(slice);
+                matrix_column_iterator<decltype(slice)> const a_end(
+                    slice, slice.columns());
+
+                for (auto it = a_begin; it != a_end; ++it)
+                    util::parallel_sort(it->begin(), it->end(), stable);
+            });
         return primitive_argument_type{std::move(arg)};
     }
 
@@ -354,15 +357,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
             hpx::unwrapping([this_ = std::move(this_)](
                                       primitive_arguments_type&& args)
                                       -> primitive_argument_type {
-                //TODO: "order" is not implemented, "kind" is ignored
+                //TODO: "order" is not implemented
                 std::int64_t axis = -1;
                 std::string kind = "quicksort";
                 if (args.size() > 2)
                     kind = extract_string_value(
                         std::move(args[2]), this_->name_, this_->codename_);
 
-                if ((kind != "quicksort" && kind != "mergesort") &&
-                    (kind != "heapsort" && kind != "stable"))
+                if (!util::is_valid_sort_kind(kind))
                     HPX_THROW_EXCEPTION(hpx::bad_parameter,
                         "sort::eval",
                         this_->generate_error_message(
@@ -383,12 +385,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             std::move(args[0]), this_->name_, this_->codename_),
                         axis, kind);
 
+                case node_data_type_int32: HPX_FALLTHROUGH;
                 case node_data_type_int64:
                     return this_->sort_helper(
                         extract_integer_value_strict(
                             std::move(args[0]), this_->name_, this_->codename_),
                         axis, kind);
 
+                case node_data_type_float32: HPX_FALLTHROUGH;
                 case node_data_type_double:
                     return this_->sort_helper(
                         extract_numeric_value_strict(
@@ -96,10 +96,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return squeeze1d(
                 extract_boolean_value_strict(std::move(arg), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return squeeze1d(
                 extract_integer_value_strict(std::move(arg), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return squeeze1d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_));
@@ -205,11 +207,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arg), name_, codename_),
                 axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return squeeze2d(
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 axis);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return squeeze2d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
@@ -369,11 +373,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arg), name_, codename_),
                 axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return squeeze3d(
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 axis);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return squeeze3d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
@@ -627,11 +633,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arg), name_, codename_),
                 axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return squeeze4d(
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 axis);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return squeeze4d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
@@ -324,10 +324,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return hstack0d1d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return hstack0d1d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return hstack0d1d_helper<double>(std::move(args));
 
@@ -428,10 +430,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return hstack2d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return hstack2d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return hstack2d_helper<double>(std::move(args));
 
@@ -546,10 +550,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return hstack3d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return hstack3d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return hstack3d_helper<double>(std::move(args));
 
@@ -621,10 +627,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return vstack0d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return vstack0d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return vstack0d_helper<double>(std::move(args));
 
@@ -759,10 +767,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return vstack1d2d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return vstack1d2d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return vstack1d2d_helper<double>(std::move(args));
 
@@ -877,10 +887,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return vstack3d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return vstack3d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return vstack3d_helper<double>(std::move(args));
 
@@ -952,10 +964,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return dstack0d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dstack0d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dstack0d_helper<double>(std::move(args));
 
@@ -1057,10 +1071,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return dstack1d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dstack1d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dstack1d_helper<double>(std::move(args));
 
@@ -1194,10 +1210,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return dstack2d3d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dstack2d3d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dstack2d3d_helper<double>(std::move(args));
 
@@ -1336,11 +1354,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return stack1d_axis1_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return stack1d_axis1_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return stack1d_axis1_helper<double>(std::move(args));
 
@@ -1491,11 +1511,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return stack2d_axis0_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return stack2d_axis0_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return stack2d_axis0_helper<double>(std::move(args));
 
@@ -1616,11 +1638,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return stack2d_axis1_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return stack2d_axis1_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return stack2d_axis1_helper<double>(std::move(args));
 
@@ -1750,11 +1774,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return stack3d_axis1_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return stack3d_axis1_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return stack3d_axis1_helper<double>(std::move(args));
 
@@ -1837,11 +1863,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return stack3d_axis2_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return stack3d_axis2_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return stack3d_axis2_helper<double>(std::move(args));
 
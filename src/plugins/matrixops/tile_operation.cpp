@@ -156,11 +156,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return tile0d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return tile0d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -284,11 +286,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return tile1d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return tile1d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -412,11 +416,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return tile2d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return tile2d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -538,11 +544,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return tile3d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return tile3d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
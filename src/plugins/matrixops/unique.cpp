@@ -10,6 +10,7 @@
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/matrixops/unique.hpp>
 #include <phylanx/util/matrix_iterators.hpp>
+#include <phylanx/util/parallel_sort.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
@@ -76,10 +77,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return unique0d(extract_boolean_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return unique0d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return unique0d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_));
@@ -105,7 +108,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         blaze::DynamicVector<T> a = arg.vector();
         // Sorting the vector
-        std::sort(a.begin(), a.end());
+        util::parallel_sort(a.begin(), a.end());
 
         // Use std::unique to remove duplicacy
         auto ip = std::unique(a.begin(), a.end());
@@ -140,10 +143,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return unique1d(extract_boolean_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return unique1d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return unique1d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_));
@@ -183,7 +188,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // Sorting the vector
-        std::sort(result.begin(), result.end());
+        util::parallel_sort(result.begin(), result.end());
 
         // Use std::unique to remove duplicacy
         auto ip = std::unique(result.begin(), result.end());
@@ -209,7 +214,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             a.rows(), a_begin);
         std::iota(indices.begin(), indices.end(), a_begin);
 
-        std::sort(indices.begin(), indices.end(),
+        util::parallel_sort(indices.begin(), indices.end(),
             [&](const auto& lhs, const auto& rhs) {
                 return std::lexicographical_compare(
                     lhs->begin(), lhs->end(), rhs->begin(), rhs->end());
@@ -238,7 +243,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             a.columns(), a_begin);
         std::iota(indices.begin(), indices.end(), a_begin);
 
-        std::sort(indices.begin(), indices.end(),
+        util::parallel_sort(indices.begin(), indices.end(),
             [&](const auto& lhs, const auto& rhs) {
                 return std::lexicographical_compare(
                     lhs->begin(), lhs->end(), rhs->begin(), rhs->end());
@@ -313,12 +318,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     std::move(args[0]), name_, codename_),
                 axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return unique2d(numargs,
                 extract_integer_value_strict(
                     std::move(args[0]), name_, codename_),
                 axis);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return unique2d(numargs,
                 extract_numeric_value_strict(
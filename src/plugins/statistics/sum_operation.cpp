@@ -8,11 +8,17 @@
 #include <phylanx/plugins/statistics/sum_operation.hpp>
 #include <phylanx/plugins/statistics/statistics_base_impl.hpp>
 
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/errors/throw_exception.hpp>
+
+#include <cstdint>
 #include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <blaze/Math.h>
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace phylanx { namespace execution_tree { namespace primitives {
 
@@ -48,4 +54,96 @@ namespace phylanx { namespace execution_tree { namespace primitives {
       : base_type(std::move(operands), name, codename)
     {
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type sum_operation::handle_sparse_operand(
+        primitive_argument_type const& arg,
+        hpx::util::optional<std::int64_t> const& axis, bool keepdims,
+        primitive_argument_type const& initial, node_data_type dtype) const
+    {
+        // anything but a plain sum is handled by expanding the data
+        if (valid(initial) ||
+            (dtype != node_data_type_unknown && dtype != node_data_type_double))
+        {
+            return primitive_argument_type{};
+        }
+
+        auto data = extract_sparse_numeric_value(arg, name_, codename_);
+        if (data.index() == ir::node_data<double>::sparse_storage1d)
+        {
+            auto const& v = data.sparse_vector();
+            if (axis && *axis != 0 && *axis != -1)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "sum_operation::handle_sparse_operand",
+                    generate_error_message(
+                        "the sum primitive requires operand axis to be "
+                        "either 0 or -1 for vectors"));
+            }
+
+            double result = blaze::sum(v);
+            if (keepdims)
+            {
+                return primitive_argument_type{ir::node_data<double>{
+                    blaze::DynamicVector<double>(1, result)}};
+            }
+            return primitive_argument_type{result};
+        }
+
+        auto const& m = data.sparse_matrix();
+        if (!axis)
+        {
+            double result = blaze::sum(m);
+            if (keepdims)
+            {
+                return primitive_argument_type{ir::node_data<double>{
+                    blaze::DynamicMatrix<double>(1, 1, result)}};
+            }
+            return primitive_argument_type{result};
+        }
+
+        switch (*axis)
+        {
+        case -2: HPX_FALLTHROUGH;
+        case 0:
+            {
+                blaze::DynamicVector<double, blaze::rowVector> sums =
+                    blaze::sum<blaze::columnwise>(m);
+                if (keepdims)
+                {
+                    blaze::DynamicMatrix<double> result(1, sums.size());
+                    blaze::row(result, 0) = sums;
+                    return primitive_argument_type{
+                        ir::node_data<double>{std::move(result)}};
+                }
+                return primitive_argument_type{ir::node_data<double>{
+                    blaze::DynamicVector<double>(blaze::trans(sums))}};
+            }
+
+        case -1: HPX_FALLTHROUGH;
+        case 1:
+            {
+                blaze::DynamicVector<double> sums =
+                    blaze::sum<blaze::rowwise>(m);
+                if (keepdims)
+                {
+                    blaze::DynamicMatrix<double> result(sums.size(), 1);
+                    blaze::column(result, 0) = sums;
+                    return primitive_argument_type{
+                        ir::node_data<double>{std::move(result)}};
+                }
+                return primitive_argument_type{
+                    ir::node_data<double>{std::move(sums)}};
+            }
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "sum_operation::handle_sparse_operand",
+            generate_error_message(
+                "the sum primitive requires operand axis to be between -2 "
+                "and 1 for matrices"));
+    }
 }}}    // namespace phylanx::execution_tree::primitives
@@ -0,0 +1,146 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+#include <phylanx/util/mapped_file.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace phylanx { namespace util
+{
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
+    ///////////////////////////////////////////////////////////////////////////
+    mapped_file::mapped_file(std::string const& filename)
+      : filename_(filename)
+      , data_(nullptr)
+      , size_(0)
+      , file_(INVALID_HANDLE_VALUE)
+      , mapping_(nullptr)
+    {
+        file_ = ::CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+            nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE)
+        {
+            throw std::runtime_error(
+                generate_error_message("couldn't open file: " + filename));
+        }
+
+        LARGE_INTEGER size;
+        if (!::GetFileSizeEx(file_, &size))
+        {
+            ::CloseHandle(file_);
+            throw std::runtime_error(generate_error_message(
+                "couldn't determine size of file: " + filename));
+        }
+
+        size_ = static_cast<std::size_t>(size.QuadPart);
+        if (size_ == 0)
+        {
+            return;     // nothing to map
+        }
+
+        mapping_ = ::CreateFileMappingA(
+            file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_ == nullptr)
+        {
+            ::CloseHandle(file_);
+            throw std::runtime_error(
+                generate_error_message("couldn't map file: " + filename));
+        }
+
+        data_ = static_cast<char const*>(
+            ::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (data_ == nullptr)
+        {
+            ::CloseHandle(mapping_);
+            ::CloseHandle(file_);
+            throw std::runtime_error(
+                generate_error_message("couldn't map file: " + filename));
+        }
+    }
+
+    mapped_file::~mapped_file()
+    {
+        if (data_ != nullptr)
+        {
+            ::UnmapViewOfFile(data_);
+        }
+        if (mapping_ != nullptr)
+        {
+            ::CloseHandle(mapping_);
+        }
+        if (file_ != INVALID_HANDLE_VALUE)
+        {
+            ::CloseHandle(file_);
+        }
+    }
+#else
+    ///////////////////////////////////////////////////////////////////////////
+    mapped_file::mapped_file(std::string const& filename)
+      : filename_(filename)
+      , data_(nullptr)
+      , size_(0)
+      , fd_(-1)
+    {
+        fd_ = ::open(filename.c_str(), O_RDONLY);
+        if (fd_ == -1)
+        {
+            throw std::runtime_error(
+                generate_error_message("couldn't open file: " + filename));
+        }
+
+        struct stat st;
+        if (::fstat(fd_, &st) == -1)
+        {
+            ::close(fd_);
+            throw std::runtime_error(generate_error_message(
+                "couldn't determine size of file: " + filename));
+        }
+
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ == 0)
+        {
+            return;     // nothing to map
+        }
+
+        void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+        if (p == MAP_FAILED)
+        {
+            ::close(fd_);
+            throw std::runtime_error(
+                generate_error_message("couldn't map file: " + filename));
+        }
+
+        // the file is (mostly) processed front to back
+        ::madvise(p, size_, MADV_SEQUENTIAL);
+
+        data_ = static_cast<char const*>(p);
+    }
+
+    mapped_file::~mapped_file()
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+        if (fd_ != -1)
+        {
+            ::close(fd_);
+        }
+    }
+#endif
+}}
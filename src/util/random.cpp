@@ -6,6 +6,7 @@
 
 #include <phylanx/util/random.hpp>
 
+#include <atomic>
 #include <cstdint>
 #include <random>
 
@@ -22,14 +23,27 @@ namespace phylanx { namespace util
 
     std::mt19937 rng_{default_seed()};    // The Mersenne twister generator.
 
+    // the counter based generator uses the default seed until set_seed is
+    // called
+    static std::atomic<bool> seed_set_(false);
+    static std::atomic<std::uint64_t> stream_(0);
+
     void set_seed(std::uint32_t seed)
     {
         seed_ = seed;
         rng_.seed(seed_);
+        seed_set_.store(true);
+        stream_.store(0);
     }
 
     std::uint32_t get_seed()
     {
         return seed_;
     }
+
+    random_stream next_random_stream()
+    {
+        return random_stream{
+            seed_set_.load() ? seed_ : default_seed(), stream_++};
+    }
 }}
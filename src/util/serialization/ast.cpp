@@ -51,6 +51,16 @@ namespace phylanx { namespace util
         return detail::serialize(ast);
     }
 
+    std::vector<char> serialize(ir::node_data<float> const& ast)
+    {
+        return detail::serialize(ast);
+    }
+
+    std::vector<char> serialize(ir::node_data<std::int32_t> const& ast)
+    {
+        return detail::serialize(ast);
+    }
+
     std::vector<char> serialize(ast::nil ast)
     {
         return std::vector<char>{};
@@ -134,6 +144,18 @@ namespace phylanx { namespace util
             detail::unserialize_helper(input, ast);
         }
 
+        void unserialize(
+            std::vector<char> const& input, ir::node_data<float>& ast)
+        {
+            detail::unserialize_helper(input, ast);
+        }
+
+        void unserialize(
+            std::vector<char> const& input, ir::node_data<std::int32_t>& ast)
+        {
+            detail::unserialize_helper(input, ast);
+        }
+
         void unserialize(std::vector<char> const& input, ast::nil& ast)
         {
         }
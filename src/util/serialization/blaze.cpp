@@ -0,0 +1,44 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/serialization/blaze.hpp>
+
+#include <hpx/include/util.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // performance counter data
+    static std::atomic<std::int64_t> count_zero_copy_bytes_sent_;
+
+    std::int64_t zero_copy_bytes_sent(bool reset)
+    {
+        return hpx::util::get_and_reset_value(
+            count_zero_copy_bytes_sent_, reset);
+    }
+
+    namespace detail
+    {
+        std::size_t zero_copy_serialization_threshold()
+        {
+            static std::size_t threshold = std::stoul(hpx::get_config_entry(
+                "hpx.parcel.zero_copy_serialization_threshold", "8192"));
+            return threshold;
+        }
+
+        void count_zero_copy_bytes_sent(std::size_t bytes)
+        {
+            count_zero_copy_bytes_sent_.fetch_add(
+                std::int64_t(bytes), std::memory_order_relaxed);
+        }
+    }
+}}
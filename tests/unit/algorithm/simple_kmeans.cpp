@@ -11,6 +11,7 @@
 #include <hpx/include/util.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <utility>
@@ -152,10 +153,50 @@ void test_kmeans_cpp_physl()
         phylanx::ir::node_data<uint8_t>{1});
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void test_kmeans_plusplus()
+{
+    // three well separated clusters of three-dimensional points
+    phylanx::execution_tree::compiler::function_list snippets;
+    auto const& code = phylanx::execution_tree::compile(R"(
+        kmeans(
+            [[  0.0,   0.0,   0.0], [  1.0,   0.0,   0.0], [  0.0,   1.0,   0.5],
+             [100.0,   0.0,   0.0], [101.0,   0.0,   0.0], [100.0,   1.0,   0.5],
+             [  0.0, 100.0, 100.0], [  1.0, 100.0, 100.0], [  0.0, 101.0, 100.5]],
+            3, 100, false, 11, nil, "k-means++"
+        )
+    )", snippets);
+
+    auto result = phylanx::execution_tree::extract_numeric_value(code.run()());
+    HPX_TEST_EQ(result.dimension(0), std::size_t(3));
+    HPX_TEST_EQ(result.dimension(1), std::size_t(3));
+
+    // the order of the centroids depends on the initialization
+    blaze::DynamicMatrix<double> expected{{1. / 3., 1. / 3., 1. / 6.},
+        {100. + 1. / 3., 1. / 3., 1. / 6.},
+        {1. / 3., 100. + 1. / 3., 100. + 1. / 6.}};
+
+    auto centroids = result.matrix();
+    for (std::size_t i = 0; i != expected.rows(); ++i)
+    {
+        bool found = false;
+        for (std::size_t j = 0; j != centroids.rows(); ++j)
+        {
+            if (blaze::sqrNorm(blaze::row(centroids, j) -
+                    blaze::row(expected, i)) < 1e-12)
+            {
+                found = true;
+            }
+        }
+        HPX_TEST(found);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main(int argc, char* argv[])
 {
     test_kmeans_as_primitive();
     test_kmeans_cpp_physl();
+    test_kmeans_plusplus();
     return hpx::util::report_errors();
 }
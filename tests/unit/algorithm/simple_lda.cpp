@@ -0,0 +1,108 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+char const* const lda_test = R"(
+    define(train, seed, word_doc,
+        block(
+            set_seed(seed),
+            lda_trainer(3, 0.1, 0.01, 20, word_doc)
+        )
+    )
+    train
+)";
+
+///////////////////////////////////////////////////////////////////////////////
+void test_counts(blaze::DynamicMatrix<double> const& word_doc,
+    blaze::DynamicMatrix<double> const& wp,
+    blaze::DynamicMatrix<double> const& dp)
+{
+    HPX_TEST_EQ(wp.rows(), word_doc.columns());
+    HPX_TEST_EQ(dp.rows(), word_doc.rows());
+    HPX_TEST_EQ(wp.columns(), std::size_t(3));
+    HPX_TEST_EQ(dp.columns(), std::size_t(3));
+
+    // no negative counts
+    HPX_TEST_LTE(0.0, blaze::min(wp));
+    HPX_TEST_LTE(0.0, blaze::min(dp));
+
+    // every word instance is assigned to exactly one topic
+    HPX_TEST_EQ(blaze::sum(wp), blaze::sum(word_doc));
+    HPX_TEST_EQ(blaze::sum(dp), blaze::sum(word_doc));
+
+    for (std::size_t w = 0; w != word_doc.columns(); ++w)
+    {
+        HPX_TEST_EQ(blaze::sum(blaze::row(wp, w)),
+            blaze::sum(blaze::column(word_doc, w)));
+    }
+    for (std::size_t d = 0; d != word_doc.rows(); ++d)
+    {
+        HPX_TEST_EQ(blaze::sum(blaze::row(dp, d)),
+            blaze::sum(blaze::row(word_doc, d)));
+    }
+}
+
+void test_lda_trainer()
+{
+    // word-document histogram: documents are rows, words are columns
+    blaze::DynamicMatrix<double> word_doc{
+        {2.0, 0.0, 1.0, 3.0, 0.0, 1.0, 0.0, 0.0},
+        {0.0, 4.0, 0.0, 0.0, 2.0, 0.0, 1.0, 0.0},
+        {1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0},
+        {0.0, 0.0, 5.0, 0.0, 0.0, 3.0, 0.0, 2.0},
+        {3.0, 0.0, 0.0, 2.0, 0.0, 0.0, 0.0, 0.0},
+        {0.0, 2.0, 0.0, 0.0, 3.0, 0.0, 4.0, 1.0},
+        {1.0, 0.0, 2.0, 0.0, 0.0, 2.0, 0.0, 3.0},
+        {0.0, 1.0, 0.0, 0.0, 1.0, 0.0, 2.0, 0.0}};
+
+    phylanx::execution_tree::compiler::function_list snippets;
+    auto const& code = phylanx::execution_tree::compile(lda_test, snippets);
+    auto train = code.run();
+
+    auto first = phylanx::execution_tree::extract_list_value(train(
+        std::int64_t(42), phylanx::ir::node_data<double>{word_doc}));
+    blaze::DynamicMatrix<double> wp1 =
+        phylanx::execution_tree::extract_numeric_value(*first.begin())
+            .matrix();
+    blaze::DynamicMatrix<double> dp1 =
+        phylanx::execution_tree::extract_numeric_value(*++first.begin())
+            .matrix();
+
+    test_counts(word_doc, wp1, dp1);
+
+    // the same seed (and number of threads) yields the same results
+    auto second = phylanx::execution_tree::extract_list_value(train(
+        std::int64_t(42), phylanx::ir::node_data<double>{word_doc}));
+    blaze::DynamicMatrix<double> wp2 =
+        phylanx::execution_tree::extract_numeric_value(*second.begin())
+            .matrix();
+    blaze::DynamicMatrix<double> dp2 =
+        phylanx::execution_tree::extract_numeric_value(*++second.begin())
+            .matrix();
+
+    HPX_TEST(wp1 == wp2);
+    HPX_TEST(dp1 == dp2);
+}
+
+int main(int argc, char* argv[])
+{
+    // the documents are sampled by several threads concurrently
+    HPX_TEST_LT(std::size_t(1), hpx::get_os_thread_count());
+
+    test_lda_trainer();
+
+    return hpx::util::report_errors();
+}
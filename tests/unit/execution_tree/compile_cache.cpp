@@ -0,0 +1,198 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_compile_cache_default_environment()
+{
+    phylanx::execution_tree::clear_compile_cache();
+    phylanx::execution_tree::compile_cache_hits(true);
+    phylanx::execution_tree::compile_cache_misses(true);
+
+    std::string const code = "block(define(x, 41.0), x + 1.0)";
+
+    phylanx::execution_tree::compiler::function_list snippets;
+    for (int i = 0; i != 3; ++i)
+    {
+        auto const& f = phylanx::execution_tree::compile(code, snippets);
+
+        HPX_TEST_EQ(42.0,
+            phylanx::execution_tree::extract_scalar_numeric_value(
+                f.run().arg_));
+    }
+
+    HPX_TEST_EQ(
+        phylanx::execution_tree::compile_cache_misses(false), std::int64_t(1));
+    HPX_TEST_EQ(
+        phylanx::execution_tree::compile_cache_hits(false), std::int64_t(2));
+}
+
+void test_compile_cache_separate_function_lists()
+{
+    phylanx::execution_tree::clear_compile_cache();
+    phylanx::execution_tree::compile_cache_hits(true);
+    phylanx::execution_tree::compile_cache_misses(true);
+
+    std::string const code = R"(
+        define(x, 0.0)
+        define(add, v, block(store(x, x + v), x))
+        add
+    )";
+
+    // the same code compiled into different function lists must not share
+    // any state
+    phylanx::execution_tree::compiler::function_list snippets1;
+    phylanx::execution_tree::compiler::function_list snippets2;
+
+    auto add1 = phylanx::execution_tree::compile(code, snippets1).run();
+    auto add2 = phylanx::execution_tree::compile(code, snippets2).run();
+
+    HPX_TEST_EQ(
+        1.0, phylanx::execution_tree::extract_scalar_numeric_value(add1(1.0)));
+    HPX_TEST_EQ(
+        2.0, phylanx::execution_tree::extract_scalar_numeric_value(add1(1.0)));
+    HPX_TEST_EQ(10.0,
+        phylanx::execution_tree::extract_scalar_numeric_value(add2(10.0)));
+    HPX_TEST_EQ(
+        3.0, phylanx::execution_tree::extract_scalar_numeric_value(add1(1.0)));
+
+    HPX_TEST_EQ(
+        phylanx::execution_tree::compile_cache_misses(false), std::int64_t(2));
+    HPX_TEST_EQ(
+        phylanx::execution_tree::compile_cache_hits(false), std::int64_t(0));
+}
+
+void test_compile_cache_redefinition()
+{
+    phylanx::execution_tree::clear_compile_cache();
+    phylanx::execution_tree::compile_cache_hits(true);
+    phylanx::execution_tree::compile_cache_misses(true);
+
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    phylanx::execution_tree::eval_context ctx;
+
+    phylanx::execution_tree::compile("define(x, 42.0)", snippets, env)
+        .run(ctx);
+
+    // compiling the same code twice reuses the generated code
+    auto x = phylanx::execution_tree::compile("x", snippets, env).run(ctx);
+    HPX_TEST_EQ(
+        42.0, phylanx::execution_tree::extract_scalar_numeric_value(x()));
+
+    x = phylanx::execution_tree::compile("x", snippets, env).run(ctx);
+    HPX_TEST_EQ(
+        42.0, phylanx::execution_tree::extract_scalar_numeric_value(x()));
+
+    HPX_TEST_EQ(
+        phylanx::execution_tree::compile_cache_hits(false), std::int64_t(1));
+
+    // redefining 'x' invalidates the cached code
+    phylanx::execution_tree::compile("define(x, 43.0)", snippets, env)
+        .run(ctx);
+
+    x = phylanx::execution_tree::compile("x", snippets, env).run(ctx);
+    HPX_TEST_EQ(
+        43.0, phylanx::execution_tree::extract_scalar_numeric_value(x()));
+
+    HPX_TEST_EQ(
+        phylanx::execution_tree::compile_cache_hits(false), std::int64_t(1));
+}
+
+void test_compile_cache_fresh_environment()
+{
+    phylanx::execution_tree::clear_compile_cache();
+    phylanx::execution_tree::compile_cache_hits(true);
+
+    // environments that are recreated at the same address must not see
+    // code compiled for an earlier environment
+    for (int i = 0; i != 2; ++i)
+    {
+        phylanx::execution_tree::compiler::function_list snippets;
+        phylanx::execution_tree::compiler::environment env =
+            phylanx::execution_tree::compiler::default_environment();
+
+        phylanx::execution_tree::eval_context ctx;
+
+        phylanx::execution_tree::compile("define(y, 42.0)", snippets, env)
+            .run(ctx);
+
+        auto y = phylanx::execution_tree::compile("y", snippets, env).run(ctx);
+        HPX_TEST_EQ(
+            42.0, phylanx::execution_tree::extract_scalar_numeric_value(y()));
+    }
+
+    HPX_TEST_EQ(
+        phylanx::execution_tree::compile_cache_hits(false), std::int64_t(0));
+}
+
+void test_compile_cache_released_function_list()
+{
+    phylanx::execution_tree::clear_compile_cache();
+    phylanx::execution_tree::compile_cache_misses(true);
+
+    std::string const code = R"(
+        define(f, a, a + 1.0)
+        f(41.0)
+    )";
+
+    {
+        phylanx::execution_tree::compiler::function_list snippets;
+        HPX_TEST_EQ(42.0,
+            phylanx::execution_tree::extract_scalar_numeric_value(
+                phylanx::execution_tree::compile(code, snippets).run().arg_));
+    }
+
+    // the function_list above is gone, compiling the same code again
+    // creates new primitives that are registered using the same names
+    phylanx::execution_tree::compiler::function_list snippets;
+    auto const& f = phylanx::execution_tree::compile(code, snippets);
+
+    HPX_TEST_EQ(
+        phylanx::execution_tree::compile_cache_misses(false), std::int64_t(2));
+
+    std::vector<std::string> instances =
+        phylanx::util::enable_measurements();
+
+    HPX_TEST_EQ(42.0,
+        phylanx::execution_tree::extract_scalar_numeric_value(f.run().arg_));
+
+    // the performance counters resolve to the new primitives
+    std::size_t found = 0;
+    for (auto const& entry : phylanx::util::retrieve_counter_data(
+             instances, std::vector<std::string>{"count/eval"}))
+    {
+        if (entry.first.find("/__add$") != std::string::npos)
+        {
+            HPX_TEST_EQ(entry.second.size(), std::size_t(1));
+            HPX_TEST_EQ(entry.second[0], std::int64_t(1));
+            ++found;
+        }
+    }
+    HPX_TEST_EQ(found, std::size_t(1));
+}
+
+int main(int argc, char* argv[])
+{
+    test_compile_cache_default_environment();
+    test_compile_cache_separate_function_lists();
+    test_compile_cache_redefinition();
+    test_compile_cache_fresh_environment();
+    test_compile_cache_released_function_list();
+
+    return hpx::util::report_errors();
+}
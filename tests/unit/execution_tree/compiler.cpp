@@ -855,6 +855,24 @@ void test_define_call_block_function_noarg()
         ));
 }
 
+// the pattern ASTs are derived without re-parsing the patterns, they have to
+// be identical to the result of parsing the corresponding pattern string
+void test_generated_patterns()
+{
+    auto const& patterns =
+        phylanx::execution_tree::compiler::generate_patterns();
+
+    HPX_TEST(patterns.find("__arg") != patterns.end());
+    HPX_TEST(patterns.find("logsumexp__float") != patterns.end());
+
+    for (auto const& p : patterns)
+    {
+        auto exprs = phylanx::ast::generate_ast(p.second.pattern_);
+        HPX_TEST_EQ(exprs.size(), std::size_t(1));
+        HPX_TEST(exprs[0] == p.second.pattern_ast_);
+    }
+}
+
 int main(int argc, char* argv[])
 {
     test_builtin_environment();
@@ -898,6 +916,8 @@ int main(int argc, char* argv[])
     test_define_call_block_function_noarg();
     test_define_function_default_arguments();
 
+    test_generated_patterns();
+
     return hpx::util::report_errors();
 }
 
@@ -0,0 +1,122 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/agas.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// these have to match the configuration passed to hpx::init below
+std::int64_t const eval_count_threshold = 4;
+std::int64_t const eval_sample_interval = 8;
+
+char const* const code = R"(
+    define(f, x, x + 1.0)
+    f
+)";
+
+std::int64_t counter_value(std::string const& name)
+{
+    hpx::performance_counters::performance_counter pc(
+        "/phylanx{locality#0/total}/primitives/__add/" + name);
+
+    auto const values = pc.get_counter_values_array(hpx::launch::sync, false);
+    HPX_TEST_EQ(values.values_.size(), std::size_t(1));
+
+    return values.values_.empty() ? 0 : values.values_[0];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The measured execution times are always between both thresholds, thus the
+// adaptive policy is not able to decide based on the measurements and has to
+// settle after eval_sample_interval samples.
+void test_adaptive_direct_execution()
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    auto const& compiled = phylanx::execution_tree::compile(code, snippets);
+    auto f = compiled.run();
+
+    auto entries =
+        hpx::agas::find_symbols(hpx::launch::sync, "/phylanx$0/__add$*");
+    HPX_TEST_EQ(entries.size(), std::size_t(1));
+    if (entries.empty())
+    {
+        return;
+    }
+
+    // do not use the count/eval counter, it would enable measuring every
+    // invocation
+    auto instance = hpx::get_ptr<
+        phylanx::execution_tree::primitives::primitive_component>(
+        hpx::launch::sync, entries.begin()->second);
+
+    // every invocation is sampled while undecided
+    std::int64_t i = 0;
+    for (/**/; i != eval_sample_interval - 1; ++i)
+    {
+        f(phylanx::ir::node_data<double>{1.0});
+    }
+
+    HPX_TEST_EQ(counter_value("eval_direct"), std::int64_t(-1));
+    HPX_TEST_EQ(counter_value("count/eval_direct_decisions"), std::int64_t(0));
+
+    // the decision is taken by the first re-evaluation after that, which
+    // happens at most eval_count_threshold + 1 invocations later
+    for (/**/; i != eval_sample_interval + eval_count_threshold + 1; ++i)
+    {
+        f(phylanx::ir::node_data<double>{1.0});
+    }
+
+    HPX_TEST_EQ(counter_value("eval_direct"), std::int64_t(1));
+    HPX_TEST_EQ(counter_value("count/eval_direct_decisions"), std::int64_t(1));
+
+    // from now on only every eval_sample_interval-th invocation is sampled
+    std::int64_t samples = instance->get_eval_count(false);
+    for (std::int64_t j = 0; j != 3 * eval_sample_interval; ++j)
+    {
+        f(phylanx::ir::node_data<double>{1.0});
+    }
+
+    HPX_TEST_LTE(instance->get_eval_count(false) - samples, std::int64_t(3));
+
+    // and the decision stays the same
+    HPX_TEST_EQ(counter_value("eval_direct"), std::int64_t(1));
+    HPX_TEST_EQ(counter_value("count/eval_direct_decisions"), std::int64_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_adaptive_direct_execution();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "phylanx.adaptive_direct_execution=1",
+        "phylanx.eval_count_threshold=" + std::to_string(eval_count_threshold),
+        "phylanx.eval_sample_interval=" + std::to_string(eval_sample_interval),
+        "phylanx.exec_time_lower_threshold=0",
+        "phylanx.exec_time_upper_threshold=1000000000000"
+    };
+
+    hpx::init_params params;
+    params.cfg = std::move(cfg);
+    HPX_TEST_EQ(hpx::init(argc, argv, params), 0);
+
+    return hpx::util::report_errors();
+}
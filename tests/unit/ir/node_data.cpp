@@ -13,19 +13,22 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 #include <blaze/Math.h>
 #include <blaze_tensor/Math.h>
 
-void test_serialization(phylanx::ir::node_data<double> const& array_value1)
+template <typename T>
+void test_serialization(phylanx::ir::node_data<T> const& array_value1)
 {
-    phylanx::ir::node_data<double> array_value2;
+    phylanx::ir::node_data<T> array_value2;
 
     std::vector<char> buffer = phylanx::util::serialize(array_value1);
     phylanx::util::detail::unserialize(buffer, array_value2);
 
     HPX_TEST_EQ(array_value1, array_value2);
+    HPX_TEST_EQ(array_value1.is_sparse(), array_value2.is_sparse());
 }
 
 int main(int argc, char* argv[])
@@ -241,5 +244,102 @@ int main(int argc, char* argv[])
         test_serialization(array_value);
     }
 
+    {
+        blaze::CompressedVector<double> v(7UL);
+        v[1] = 42.0;
+        v[5] = -1.0;
+
+        phylanx::ir::node_data<double> array_value(v);
+
+        HPX_TEST(array_value.is_sparse());
+        HPX_TEST(!array_value.is_ref());
+        HPX_TEST_EQ(array_value.num_dimensions(), std::size_t(1UL));
+        HPX_TEST(array_value.dimensions() ==
+            phylanx::ir::node_data<double>::dimensions_type{v.size()});
+        HPX_TEST_EQ(array_value.size(), std::size_t(7UL));
+        HPX_TEST_EQ(array_value[1], 42.0);
+        HPX_TEST_EQ(array_value[2], 0.0);
+
+        auto dense = array_value.dense();
+        HPX_TEST(!dense.is_sparse());
+        HPX_TEST(dense.vector() == blaze::DynamicVector<double>(v));
+        HPX_TEST_EQ(array_value, dense);
+
+        test_serialization(array_value);
+    }
+
+    {
+        blaze::CompressedMatrix<double> m(4UL, 5UL);
+        m(0, 1) = 1.0;
+        m(2, 3) = 2.0;
+        m(3, 0) = -3.0;
+
+        phylanx::ir::node_data<double> array_value(m);
+
+        HPX_TEST(array_value.is_sparse());
+        HPX_TEST_EQ(array_value.num_dimensions(), std::size_t(2UL));
+        HPX_TEST(array_value.dimensions() ==
+            phylanx::ir::node_data<double>::dimensions_type({
+                m.rows(), m.columns()}));
+        HPX_TEST_EQ(array_value.size(), std::size_t(20UL));
+        HPX_TEST_EQ(array_value.at(2, 3), 2.0);
+        HPX_TEST_EQ(array_value.at(1, 1), 0.0);
+        HPX_TEST(array_value.sparse_matrix() == m);
+
+        auto dense = array_value.dense();
+        HPX_TEST(!dense.is_sparse());
+        HPX_TEST(dense.matrix() == blaze::DynamicMatrix<double>(m));
+        HPX_TEST_EQ(array_value, dense);
+
+        phylanx::ir::node_data<std::int64_t> int_value(array_value);
+        HPX_TEST(int_value.is_sparse());
+        HPX_TEST_EQ(int_value.at(3, 0), std::int64_t(-3));
+
+        test_serialization(array_value);
+    }
+
+    {
+        blaze::Rand<blaze::DynamicMatrix<float>> gen{};
+        blaze::DynamicMatrix<float> m = gen.generate(42UL, 101UL);
+
+        phylanx::ir::node_data<float> array_value(m);
+
+        HPX_TEST_EQ(array_value.num_dimensions(), std::size_t(2UL));
+        HPX_TEST(array_value.matrix() == m);
+
+        phylanx::ir::node_data<double> double_value(array_value);
+        HPX_TEST_EQ(double_value.at(3, 7), double(m(3, 7)));
+        HPX_TEST(phylanx::ir::node_data<float>(double_value) == array_value);
+
+        test_serialization(array_value);
+    }
+
+    {
+        blaze::DynamicVector<std::int32_t> v{1, -2, 3, 42};
+
+        phylanx::ir::node_data<std::int32_t> array_value(v);
+
+        HPX_TEST_EQ(array_value.num_dimensions(), std::size_t(1UL));
+        HPX_TEST_EQ(array_value[3], std::int32_t(42));
+        HPX_TEST(array_value ==
+            phylanx::ir::node_data<std::int32_t>(
+                phylanx::ir::node_data<std::int64_t>(array_value)));
+
+        test_serialization(array_value);
+    }
+
+    {
+        // only the elements of a vector are sent, not its whole capacity
+        blaze::Rand<blaze::DynamicVector<double>> gen{};
+        blaze::DynamicVector<double> v = gen.generate(100007UL);
+        v.resize(42UL, true);
+
+        phylanx::ir::node_data<double> array_value(std::move(v));
+
+        HPX_TEST_EQ(array_value.size(), std::size_t(42UL));
+
+        test_serialization(array_value);
+    }
+
     return hpx::util::report_errors();
 }
@@ -135,6 +135,11 @@ int main()
             "/phylanx{locality#0/total}/primitives/" + name + "/eval_direct");
         hpx::performance_counters::performance_counter eval_pc(eval_pc_name);
 
+        std::string const decisions_pc_name(
+            "/phylanx{locality#0/total}/primitives/" + name +
+            "/count/eval_direct_decisions");
+        hpx::performance_counters::performance_counter decisions_pc(
+            decisions_pc_name);
 
         // Count performance counters
         auto const info = count_pc.get_info(hpx::launch::sync);
@@ -189,6 +194,25 @@ int main()
                     values.values_[i] == 1);
             }
         }
+
+        // Eval-direct decision performance counters
+        {
+            auto const info = decisions_pc.get_info(hpx::launch::sync);
+            HPX_TEST_EQ(info.fullname_, decisions_pc_name);
+            HPX_TEST_EQ(
+                info.type_, hpx::performance_counters::counter_raw_values);
+
+            auto const values =
+                decisions_pc.get_counter_values_array(hpx::launch::sync, false);
+
+            HPX_TEST_EQ(values.count_, 1ll);
+            HPX_TEST_EQ(values.values_.size(), entries.size());
+
+            for (std::size_t i = 0; i != values.values_.size(); ++i)
+            {
+                HPX_TEST(values.values_[i] >= 0);
+            }
+        }
     }
 
     return hpx::util::report_errors();
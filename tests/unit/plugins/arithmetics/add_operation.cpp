@@ -9,6 +9,7 @@
 #include <hpx/include/lcos.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstdint>
 #include <utility>
 #include <vector>
 #include <blaze/Math.h>
@@ -495,6 +496,75 @@ void test_add_operation_2d1d_lit()
         phylanx::execution_tree::extract_numeric_value(f.get()));
 }
 
+void test_add_operation_float32()
+{
+    blaze::Rand<blaze::DynamicMatrix<float>> mat_gen{};
+    blaze::DynamicMatrix<float> m1 = mat_gen.generate(101UL, 104UL);
+    blaze::DynamicMatrix<float> m2 = mat_gen.generate(101UL, 104UL);
+
+    phylanx::execution_tree::primitive lhs =
+        phylanx::execution_tree::primitives::create_variable(
+            hpx::find_here(), phylanx::ir::node_data<float>(m1));
+
+    phylanx::execution_tree::primitive add =
+        phylanx::execution_tree::primitives::create_add_operation(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{std::move(lhs),
+                phylanx::ir::node_data<float>(m2)});
+
+    // the result keeps the single precision element type
+    phylanx::execution_tree::primitive_argument_type result = add.eval().get();
+    HPX_TEST(phylanx::execution_tree::is_float32_operand_strict(result));
+
+    blaze::DynamicMatrix<float> expected = m1 + m2;
+    HPX_TEST_EQ(phylanx::ir::node_data<float>(std::move(expected)),
+        phylanx::execution_tree::extract_float32_value_strict(result));
+}
+
+void test_add_operation_int32_float32()
+{
+    blaze::DynamicVector<std::int32_t> v1{1, 2, 3};
+    blaze::DynamicVector<float> v2{0.5f, 1.5f, 2.5f};
+
+    phylanx::execution_tree::primitive add =
+        phylanx::execution_tree::primitives::create_add_operation(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{
+                phylanx::ir::node_data<std::int32_t>(v1),
+                phylanx::ir::node_data<float>(v2)});
+
+    // mixing 32 bit integers with single precision values yields double
+    // precision values
+    phylanx::execution_tree::primitive_argument_type result = add.eval().get();
+    HPX_TEST(!phylanx::execution_tree::is_float32_operand_strict(result));
+
+    blaze::DynamicVector<double> expected{1.5, 3.5, 5.5};
+    HPX_TEST_EQ(phylanx::ir::node_data<double>(std::move(expected)),
+        phylanx::execution_tree::extract_numeric_value(result));
+}
+
+void test_add_operation_int64_float32()
+{
+    blaze::DynamicVector<std::int64_t> v1{16777217, 2, 3};
+    blaze::DynamicVector<float> v2{0.0f, 1.5f, 2.5f};
+
+    phylanx::execution_tree::primitive add =
+        phylanx::execution_tree::primitives::create_add_operation(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{
+                phylanx::ir::node_data<std::int64_t>(v1),
+                phylanx::ir::node_data<float>(v2)});
+
+    // 2^24 + 1 can't be represented in single precision, the result has to
+    // be double precision
+    phylanx::execution_tree::primitive_argument_type result = add.eval().get();
+    HPX_TEST(!phylanx::execution_tree::is_float32_operand_strict(result));
+
+    blaze::DynamicVector<double> expected{16777217.0, 3.5, 5.5};
+    HPX_TEST_EQ(phylanx::ir::node_data<double>(std::move(expected)),
+        phylanx::execution_tree::extract_numeric_value(result));
+}
+
 int main(int argc, char* argv[])
 {
     test_add_operation_0d();
@@ -524,5 +594,9 @@ int main(int argc, char* argv[])
     test_add_operation_2d1d();
     test_add_operation_2d1d_lit();
 
+    test_add_operation_float32();
+    test_add_operation_int32_float32();
+    test_add_operation_int64_float32();
+
     return hpx::util::report_errors();
 }
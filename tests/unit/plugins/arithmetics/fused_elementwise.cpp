@@ -0,0 +1,178 @@
+//   Copyright (c) 2026 agent
+//
+//   Distributed under the Boost Software License, Version 1.0. (See accompanying
+//   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/agas.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run().arg_;
+}
+
+std::size_t count_fused_primitives()
+{
+    return hpx::agas::find_symbols(
+        hpx::launch::sync, "/phylanx$*/__fused_elementwise$*").size();
+}
+
+std::size_t count_primitives()
+{
+    return hpx::agas::find_symbols(hpx::launch::sync, "/phylanx$*/*").size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_fused_vector()
+{
+    std::size_t fused = count_fused_primitives();
+
+    auto result = phylanx::execution_tree::extract_numeric_value(
+        compile_and_run(R"(block(
+            define(a, [1.0, 2.0, 3.0]),
+            define(b, [4.0, 5.0, 6.0]),
+            define(c, [7.0, 8.0, 9.0]),
+            define(d, [1.0, 1.0, 1.0]),
+            a * b + c - d
+        ))"));
+
+    blaze::DynamicVector<double> expected{10.0, 17.0, 26.0};
+    HPX_TEST_EQ(result, phylanx::ir::node_data<double>(std::move(expected)));
+
+    HPX_TEST_EQ(count_fused_primitives(), fused + 1);
+}
+
+void test_fused_matrix()
+{
+    // large enough for the evaluation to be parallelized
+    blaze::Rand<blaze::DynamicMatrix<double>> gen{};
+    blaze::DynamicMatrix<double> m1 = gen.generate(301, 307);
+    blaze::DynamicMatrix<double> m2 = gen.generate(301, 307);
+
+    // -(x - y) * (x + y) / 2.0 + x
+    phylanx::execution_tree::primitive f =
+        phylanx::execution_tree::primitives::create_fused_elementwise(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{
+                std::string("1 2 - neg 1 2 + * 3 / 1 +"),
+                phylanx::ir::node_data<double>{m1},
+                phylanx::ir::node_data<double>{m2},
+                phylanx::ir::node_data<double>{2.0}});
+
+    auto result =
+        phylanx::execution_tree::extract_numeric_value(f.eval().get());
+
+    blaze::DynamicMatrix<double> expected =
+        blaze::map(m1, m2, [](double x, double y) {
+            return -(x - y) * (x + y) / 2.0 + x;
+        });
+    HPX_TEST_EQ(result, phylanx::ir::node_data<double>(std::move(expected)));
+}
+
+void test_fused_boolean()
+{
+    auto result = phylanx::execution_tree::extract_boolean_value(
+        compile_and_run(R"(block(
+            define(a, [1.0, 2.0, 3.0, 4.0]),
+            define(b, [4.0, 3.0, 2.0, 1.0]),
+            a < b && a != 1 || !(a * 2 < 7)
+        ))"));
+
+    blaze::DynamicVector<std::uint8_t> expected{0, 1, 0, 1};
+    HPX_TEST_EQ(
+        result, phylanx::ir::node_data<std::uint8_t>(std::move(expected)));
+}
+
+void test_scalar_not_fused()
+{
+    std::size_t fused = count_fused_primitives();
+
+    // expressions on scalar literals and variables are not fused
+    phylanx::execution_tree::compiler::function_list snippets;
+    auto const& code = phylanx::execution_tree::compile(R"(block(
+            define(a, 3.0),
+            define(b, 2.0),
+            a * b + a - b / 2.0
+        ))", snippets);
+
+    HPX_TEST_EQ(count_fused_primitives(), fused);
+
+    // evaluating the code does not create any primitives
+    std::size_t primitives = count_primitives();
+    for (int i = 0; i != 3; ++i)
+    {
+        HPX_TEST_EQ(8.0,
+            phylanx::execution_tree::extract_scalar_numeric_value(
+                code.run().arg_));
+    }
+    HPX_TEST_EQ(count_primitives(), primitives);
+}
+
+void test_fused_scalar_fallback()
+{
+    // a fused primitive invoked with scalars falls back to the primitives
+    // implementing the operations, those are created only once
+    phylanx::execution_tree::primitive f =
+        phylanx::execution_tree::primitives::create_fused_elementwise(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{
+                std::string("1 2 * 1 + 2 -"), std::int64_t(7),
+                std::int64_t(2)});
+
+    std::size_t primitives = count_primitives();
+    for (int i = 0; i != 3; ++i)
+    {
+        HPX_TEST_EQ(std::int64_t(19),
+            phylanx::execution_tree::extract_scalar_integer_value(
+                f.eval().get()));
+    }
+    HPX_TEST_EQ(count_primitives(), primitives);
+}
+
+void test_fused_fallback()
+{
+    // scalar integer arithmetic is not fused, but has to give the same result
+    HPX_TEST_EQ(phylanx::execution_tree::extract_scalar_integer_value(
+                    compile_and_run("7 / 2 * 2 + 3 - 1")),
+        std::int64_t(8));
+
+    // broadcasting is handled by the separate primitives
+    auto result = phylanx::execution_tree::extract_numeric_value(
+        compile_and_run(R"(block(
+            define(m, [[1.0, 2.0], [3.0, 4.0]]),
+            define(v, [1.0, 2.0]),
+            m * v + v - 1
+        ))"));
+
+    blaze::DynamicMatrix<double> expected{{1.0, 5.0}, {3.0, 9.0}};
+    HPX_TEST_EQ(result, phylanx::ir::node_data<double>(std::move(expected)));
+}
+
+int main(int argc, char* argv[])
+{
+    test_fused_vector();
+    test_fused_matrix();
+    test_fused_boolean();
+    test_scalar_not_fused();
+    test_fused_scalar_fallback();
+    test_fused_fallback();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,173 @@
+//   Copyright (c) 2026 agent
+//
+//   Distributed under the Boost Software License, Version 1.0. (See accompanying
+//   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/agas.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run().arg_;
+}
+
+std::size_t count_scalar_loops()
+{
+    return hpx::agas::find_symbols(
+        hpx::launch::sync, "/phylanx$*/__scalar_loop$*").size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_while_sum()
+{
+    std::size_t loops = count_scalar_loops();
+
+    auto result = compile_and_run(R"(block(
+            define(i, 0),
+            define(n, 0),
+            while(n < 10,
+                block(
+                    store(n, n + 1),
+                    store(i, i + n)
+                )
+            ),
+            i
+        ))");
+
+    HPX_TEST_EQ(
+        phylanx::execution_tree::extract_scalar_integer_value(result),
+        std::int64_t(55));
+
+    HPX_TEST_EQ(count_scalar_loops(), loops + 1);
+}
+
+void test_while_fibonacci()
+{
+    auto result = compile_and_run(R"(block(
+            define(x, 1.0),
+            define(y, 1.0),
+            define(z, 0.0),
+            define(step, 2),
+            while(step < 10,
+                block(
+                    store(z, x + y),
+                    store(x, y),
+                    store(y, z),
+                    store(step, step + 1)
+                )
+            ),
+            z
+        ))");
+
+    HPX_TEST_EQ(
+        phylanx::execution_tree::extract_scalar_numeric_value(result), 55.0);
+}
+
+void test_for_nested_if()
+{
+    // count the numbers below 100 that are divisible by 3 but not by 5
+    auto result = compile_and_run(R"(block(
+            define(i, 0),
+            define(count, 0),
+            define(last, -1),
+            for(store(i, 0), i < 100, store(i, i + 1),
+                if(i - i / 3 * 3 == 0 && !(i - i / 5 * 5 == 0),
+                    block(
+                        store(count, count + 1),
+                        store(last, i)
+                    )
+                )
+            ),
+            count * 1000 + last
+        ))");
+
+    HPX_TEST_EQ(
+        phylanx::execution_tree::extract_scalar_integer_value(result),
+        std::int64_t(27099));
+}
+
+void test_nested_loops()
+{
+    auto result = compile_and_run(R"(block(
+            define(i, 0),
+            define(j, 0),
+            define(sum, 0.0),
+            while(i < 10,
+                block(
+                    store(j, 0),
+                    while(j < i,
+                        block(
+                            store(sum, sum + 0.5 * j),
+                            store(j, j + 1)
+                        )
+                    ),
+                    store(i, i + 1)
+                )
+            ),
+            sum
+        ))");
+
+    HPX_TEST_EQ(
+        phylanx::execution_tree::extract_scalar_numeric_value(result), 60.0);
+}
+
+void test_fallback()
+{
+    // arrays are handled by the original loop
+    auto result = compile_and_run(R"(block(
+            define(v, [1.0, 2.0]),
+            define(n, 0),
+            while(n < 3,
+                block(
+                    store(v, v + v),
+                    store(n, n + 1)
+                )
+            ),
+            v
+        ))");
+
+    blaze::DynamicVector<double> expected{8.0, 16.0};
+    HPX_TEST_EQ(phylanx::execution_tree::extract_numeric_value(result),
+        phylanx::ir::node_data<double>(std::move(expected)));
+
+    // loops calling functions are not lowered at all
+    std::size_t loops = count_scalar_loops();
+
+    auto sum = compile_and_run(R"(block(
+            define(n, 0.0),
+            while(n < 4.0, store(n, n + sqrt(4.0))),
+            n
+        ))");
+
+    HPX_TEST_EQ(
+        phylanx::execution_tree::extract_scalar_numeric_value(sum), 4.0);
+    HPX_TEST_EQ(count_scalar_loops(), loops);
+}
+
+int main(int argc, char* argv[])
+{
+    test_while_sum();
+    test_while_fibonacci();
+    test_for_nested_if();
+    test_nested_loops();
+    test_fallback();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,402 @@
+//   Copyright (c) 2026 agent
+//
+//   Distributed under the Boost Software License, Version 1.0. (See accompanying
+//   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& name, std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(name, codestr, snippets, env);
+    return code.run().arg_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_dot_operation(std::string const& name, std::string const& code,
+    std::string const& expected_str)
+{
+    HPX_TEST_EQ(
+        compile_and_run(name, code), compile_and_run(name, expected_str));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// square grid of equally sized tiles, uses Cannon's algorithm
+void test_dot_2d2d_cannon()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_dot_operation("test2d2d_cannon", R"(
+            dot_d(
+                annotate_d([[1]], "test2d2d_cannon_1",
+                    list("args",
+                        list("locality", 0, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 0, 1)))),
+                annotate_d([[5]], "test2d2d_cannon_2",
+                    list("args",
+                        list("locality", 0, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 0, 1))))
+            )
+        )", R"(
+            annotate_d([[19]], "test2d2d_cannon_1/1",
+                list("args",
+                    list("locality", 0, 4),
+                    list("tile", list("columns", 0, 1), list("rows", 0, 1))))
+        )");
+    }
+    else if (hpx::get_locality_id() == 1)
+    {
+        test_dot_operation("test2d2d_cannon", R"(
+            dot_d(
+                annotate_d([[2]], "test2d2d_cannon_1",
+                    list("args",
+                        list("locality", 1, 4),
+                        list("tile", list("columns", 1, 2), list("rows", 0, 1)))),
+                annotate_d([[6]], "test2d2d_cannon_2",
+                    list("args",
+                        list("locality", 1, 4),
+                        list("tile", list("columns", 1, 2), list("rows", 0, 1))))
+            )
+        )", R"(
+            annotate_d([[22]], "test2d2d_cannon_1/1",
+                list("args",
+                    list("locality", 1, 4),
+                    list("tile", list("columns", 1, 2), list("rows", 0, 1))))
+        )");
+    }
+    else if (hpx::get_locality_id() == 2)
+    {
+        test_dot_operation("test2d2d_cannon", R"(
+            dot_d(
+                annotate_d([[3]], "test2d2d_cannon_1",
+                    list("args",
+                        list("locality", 2, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 1, 2)))),
+                annotate_d([[7]], "test2d2d_cannon_2",
+                    list("args",
+                        list("locality", 2, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 1, 2))))
+            )
+        )", R"(
+            annotate_d([[43]], "test2d2d_cannon_1/1",
+                list("args",
+                    list("locality", 2, 4),
+                    list("tile", list("columns", 0, 1), list("rows", 1, 2))))
+        )");
+    }
+    else
+    {
+        test_dot_operation("test2d2d_cannon", R"(
+            dot_d(
+                annotate_d([[4]], "test2d2d_cannon_1",
+                    list("args",
+                        list("locality", 3, 4),
+                        list("tile", list("columns", 1, 2), list("rows", 1, 2)))),
+                annotate_d([[8]], "test2d2d_cannon_2",
+                    list("args",
+                        list("locality", 3, 4),
+                        list("tile", list("columns", 1, 2), list("rows", 1, 2))))
+            )
+        )", R"(
+            annotate_d([[50]], "test2d2d_cannon_1/1",
+                list("args",
+                    list("locality", 3, 4),
+                    list("tile", list("columns", 1, 2), list("rows", 1, 2))))
+        )");
+    }
+}
+
+// the lhs column tiles do not match the rhs row tiles, uses SUMMA
+void test_dot_2d2d_summa()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_dot_operation("test2d2d_summa", R"(
+            dot_d(
+                annotate_d([[1], [4]], "test2d2d_summa_1",
+                    list("args",
+                        list("locality", 0, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 0, 2)))),
+                annotate_d([[1], [0]], "test2d2d_summa_2",
+                    list("args",
+                        list("locality", 0, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 0, 2))))
+            )
+        )", R"(
+            annotate_d([[4], [10]], "test2d2d_summa_1/1",
+                list("args",
+                    list("locality", 0, 4),
+                    list("tile", list("columns", 0, 1), list("rows", 0, 2))))
+        )");
+    }
+    else if (hpx::get_locality_id() == 1)
+    {
+        test_dot_operation("test2d2d_summa", R"(
+            dot_d(
+                annotate_d([[2, 3], [5, 6]], "test2d2d_summa_1",
+                    list("args",
+                        list("locality", 1, 4),
+                        list("tile", list("columns", 1, 3), list("rows", 0, 2)))),
+                annotate_d([[0, 2], [1, 0]], "test2d2d_summa_2",
+                    list("args",
+                        list("locality", 1, 4),
+                        list("tile", list("columns", 1, 3), list("rows", 0, 2))))
+            )
+        )", R"(
+            annotate_d([[5, 5], [11, 14]], "test2d2d_summa_1/1",
+                list("args",
+                    list("locality", 1, 4),
+                    list("tile", list("columns", 1, 3), list("rows", 0, 2))))
+        )");
+    }
+    else if (hpx::get_locality_id() == 2)
+    {
+        test_dot_operation("test2d2d_summa", R"(
+            dot_d(
+                annotate_d([[7]], "test2d2d_summa_1",
+                    list("args",
+                        list("locality", 2, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 2, 3)))),
+                annotate_d([[1]], "test2d2d_summa_2",
+                    list("args",
+                        list("locality", 2, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 2, 3))))
+            )
+        )", R"(
+            annotate_d([[16]], "test2d2d_summa_1/1",
+                list("args",
+                    list("locality", 2, 4),
+                    list("tile", list("columns", 0, 1), list("rows", 2, 3))))
+        )");
+    }
+    else
+    {
+        test_dot_operation("test2d2d_summa", R"(
+            dot_d(
+                annotate_d([[8, 9]], "test2d2d_summa_1",
+                    list("args",
+                        list("locality", 3, 4),
+                        list("tile", list("columns", 1, 3), list("rows", 2, 3)))),
+                annotate_d([[1, 1]], "test2d2d_summa_2",
+                    list("args",
+                        list("locality", 3, 4),
+                        list("tile", list("columns", 1, 3), list("rows", 2, 3))))
+            )
+        )", R"(
+            annotate_d([[17, 23]], "test2d2d_summa_1/1",
+                list("args",
+                    list("locality", 3, 4),
+                    list("tile", list("columns", 1, 3), list("rows", 2, 3))))
+        )");
+    }
+}
+
+// localities 2 and 3 hold replicas of the tiles of localities 0 and 1,
+// uses SUMMA with two layers
+void test_dot_2d2d_replicated()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_dot_operation("test2d2d_replicated", R"(
+            dot_d(
+                annotate_d([[1], [3]], "test2d2d_replicated_1",
+                    list("args",
+                        list("locality", 0, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 0, 2)))),
+                annotate_d([[5], [7]], "test2d2d_replicated_2",
+                    list("args",
+                        list("locality", 0, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 0, 2))))
+            )
+        )", R"(
+            annotate_d([[19], [43]], "test2d2d_replicated_1/1",
+                list("args",
+                    list("locality", 0, 4),
+                    list("tile", list("columns", 0, 1), list("rows", 0, 2))))
+        )");
+    }
+    else if (hpx::get_locality_id() == 1)
+    {
+        test_dot_operation("test2d2d_replicated", R"(
+            dot_d(
+                annotate_d([[2], [4]], "test2d2d_replicated_1",
+                    list("args",
+                        list("locality", 1, 4),
+                        list("tile", list("columns", 1, 2), list("rows", 0, 2)))),
+                annotate_d([[6], [8]], "test2d2d_replicated_2",
+                    list("args",
+                        list("locality", 1, 4),
+                        list("tile", list("columns", 1, 2), list("rows", 0, 2))))
+            )
+        )", R"(
+            annotate_d([[22], [50]], "test2d2d_replicated_1/1",
+                list("args",
+                    list("locality", 1, 4),
+                    list("tile", list("columns", 1, 2), list("rows", 0, 2))))
+        )");
+    }
+    else if (hpx::get_locality_id() == 2)
+    {
+        test_dot_operation("test2d2d_replicated", R"(
+            dot_d(
+                annotate_d([[1], [3]], "test2d2d_replicated_1",
+                    list("args",
+                        list("locality", 2, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 0, 2)))),
+                annotate_d([[5], [7]], "test2d2d_replicated_2",
+                    list("args",
+                        list("locality", 2, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 0, 2))))
+            )
+        )", R"(
+            annotate_d([[19], [43]], "test2d2d_replicated_1/1",
+                list("args",
+                    list("locality", 2, 4),
+                    list("tile", list("columns", 0, 1), list("rows", 0, 2))))
+        )");
+    }
+    else
+    {
+        test_dot_operation("test2d2d_replicated", R"(
+            dot_d(
+                annotate_d([[2], [4]], "test2d2d_replicated_1",
+                    list("args",
+                        list("locality", 3, 4),
+                        list("tile", list("columns", 1, 2), list("rows", 0, 2)))),
+                annotate_d([[6], [8]], "test2d2d_replicated_2",
+                    list("args",
+                        list("locality", 3, 4),
+                        list("tile", list("columns", 1, 2), list("rows", 0, 2))))
+            )
+        )", R"(
+            annotate_d([[22], [50]], "test2d2d_replicated_1/1",
+                list("args",
+                    list("locality", 3, 4),
+                    list("tile", list("columns", 1, 2), list("rows", 0, 2))))
+        )");
+    }
+}
+
+// only locality 2 holds a replica of the tiles of locality 0, uses SUMMA
+// without layers
+void test_dot_2d2d_unevenly_replicated()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_dot_operation("test2d2d_uneven", R"(
+            dot_d(
+                annotate_d([[1], [3]], "test2d2d_uneven_1",
+                    list("args",
+                        list("locality", 0, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 0, 2)))),
+                annotate_d([[5], [7]], "test2d2d_uneven_2",
+                    list("args",
+                        list("locality", 0, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 0, 2))))
+            )
+        )", R"(
+            annotate_d([[19], [43]], "test2d2d_uneven_1/1",
+                list("args",
+                    list("locality", 0, 4),
+                    list("tile", list("columns", 0, 1), list("rows", 0, 2))))
+        )");
+    }
+    else if (hpx::get_locality_id() == 1)
+    {
+        test_dot_operation("test2d2d_uneven", R"(
+            dot_d(
+                annotate_d([[2], [4]], "test2d2d_uneven_1",
+                    list("args",
+                        list("locality", 1, 4),
+                        list("tile", list("columns", 1, 2), list("rows", 0, 2)))),
+                annotate_d([[6], [8]], "test2d2d_uneven_2",
+                    list("args",
+                        list("locality", 1, 4),
+                        list("tile", list("columns", 1, 2), list("rows", 0, 2))))
+            )
+        )", R"(
+            annotate_d([[22], [50]], "test2d2d_uneven_1/1",
+                list("args",
+                    list("locality", 1, 4),
+                    list("tile", list("columns", 1, 2), list("rows", 0, 2))))
+        )");
+    }
+    else if (hpx::get_locality_id() == 2)
+    {
+        test_dot_operation("test2d2d_uneven", R"(
+            dot_d(
+                annotate_d([[1], [3]], "test2d2d_uneven_1",
+                    list("args",
+                        list("locality", 2, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 0, 2)))),
+                annotate_d([[5], [7]], "test2d2d_uneven_2",
+                    list("args",
+                        list("locality", 2, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 0, 2))))
+            )
+        )", R"(
+            annotate_d([[19], [43]], "test2d2d_uneven_1/1",
+                list("args",
+                    list("locality", 2, 4),
+                    list("tile", list("columns", 0, 1), list("rows", 0, 2))))
+        )");
+    }
+    else
+    {
+        test_dot_operation("test2d2d_uneven", R"(
+            dot_d(
+                annotate_d([[2], [4]], "test2d2d_uneven_1",
+                    list("args",
+                        list("locality", 3, 4),
+                        list("tile", list("columns", 1, 2), list("rows", 0, 2)))),
+                annotate_d([[5], [7]], "test2d2d_uneven_2",
+                    list("args",
+                        list("locality", 3, 4),
+                        list("tile", list("columns", 0, 1), list("rows", 0, 2))))
+            )
+        )", R"(
+            annotate_d([[19], [43]], "test2d2d_uneven_1/1",
+                list("args",
+                    list("locality", 3, 4),
+                    list("tile", list("columns", 0, 1), list("rows", 0, 2))))
+        )");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_dot_2d2d_cannon();
+    test_dot_2d2d_summa();
+    test_dot_2d2d_replicated();
+    test_dot_2d2d_unevenly_replicated();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    hpx::init_params params;
+    params.cfg = std::move(cfg);
+    return hpx::init(argc, argv, params);
+}
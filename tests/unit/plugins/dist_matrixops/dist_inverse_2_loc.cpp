@@ -300,6 +300,74 @@ void test_gauss_inverse_5()
     }
 }
 
+// solve A * x = b using the matrix from test_gauss_inverse_4, the right hand
+// side is either available on both localities or tiled by columns
+void test_linear_solver_lu_d_0()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_ginv_operation("test_6", R"(
+            linear_solver_lu_d(
+                annotate_d( [[1.0, 1.0], [0.0, 3.0], [2.0, 3.0], [1.0, 0.0]],
+                    "test_6_1",
+                    list("tile", list("columns", 0, 2), list("rows", 0,4))),
+                [6.0, 17.0, 11.0, 11.0]
+            )
+        )", "[1.0, 2.0, 3.0, 4.0]");
+    }
+    else
+    {
+        test_ginv_operation("test_6", R"(
+            linear_solver_lu_d(
+                annotate_d( [[1.0, 0.0], [1.0, 2.0], [1.0, 0.0], [2.0, 1.0]],
+                    "test_6_1",
+                    list("tile", list("columns", 2, 4), list("rows", 0,4))),
+                [6.0, 17.0, 11.0, 11.0]
+            )
+        )", "[1.0, 2.0, 3.0, 4.0]");
+    }
+}
+
+void test_linear_solver_lu_d_1()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_ginv_operation("test_7", R"(
+            linear_solver_lu_d(
+                annotate_d( [[1.0, 1.0], [0.0, 3.0], [2.0, 3.0], [1.0, 0.0]],
+                    "test_7_1",
+                    list("tile", list("columns", 0, 2), list("rows", 0,4))),
+                annotate_d( [[1.0], [0.0], [2.0], [1.0]],
+                    "test_7_2",
+                    list("tile", list("columns", 0, 1), list("rows", 0,4)))
+            )
+        )",
+            R"(
+            annotate_d([[1.0], [0.0], [0.0], [0.0]], "test_7_2/1",
+                list("tile", list("columns", 0, 1), list("rows", 0, 4)))
+        )");
+    }
+    else
+    {
+        test_ginv_operation("test_7", R"(
+            linear_solver_lu_d(
+                annotate_d( [[1.0, 0.0], [1.0, 2.0], [1.0, 0.0], [2.0, 1.0]],
+                    "test_7_1",
+                    list("tile", list("columns", 2, 4), list("rows", 0,4))),
+                annotate_d( [[1.0, 1.0, 0.0], [3.0, 1.0, 2.0],
+                        [3.0, 1.0, 0.0], [0.0, 2.0, 1.0]],
+                    "test_7_2",
+                    list("tile", list("columns", 1, 4), list("rows", 0,4)))
+            )
+        )",
+            R"(
+            annotate_d([[0.0, 0.0, 0.0], [1.0, 0.0, 0.0],
+                [0.0, 1.0, 0.0], [0.0, 0.0, 1.0]], "test_7_2/1",
+                list("tile", list("columns", 1, 4), list("rows", 0, 4)))
+        )");
+    }
+}
+
 int hpx_main(int argc, char* argv[])
 {
       test_gauss_inverse_0();
@@ -307,6 +375,8 @@ int hpx_main(int argc, char* argv[])
       //test_gauss_inverse_3(5);
       test_gauss_inverse_4();
       test_gauss_inverse_5();
+      test_linear_solver_lu_d_0();
+      test_linear_solver_lu_d_1();
 
     hpx::finalize();
     return hpx::util::report_errors();
@@ -314,7 +384,12 @@ int hpx_main(int argc, char* argv[])
 
 int main(int argc, char* argv[])
 {
-    std::vector<std::string> cfg = {"hpx.run_hpx_main!=1"};
+    // use panels of a single column to exercise the look-ahead between the
+    // panels owned by the same locality
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1",
+        "phylanx.inverse_d_block_size!=1"
+    };
 
     hpx::init_params params;
     params.cfg = std::move(cfg);
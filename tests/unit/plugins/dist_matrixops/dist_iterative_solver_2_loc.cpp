@@ -0,0 +1,173 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& name, std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(name, codestr, snippets, env);
+    return code.run().arg_;
+}
+
+void test_solver_operation(std::string const& name, std::string const& code,
+    std::string const& expected_str)
+{
+    phylanx::execution_tree::primitive_argument_type result =
+        compile_and_run(name, code);
+    phylanx::execution_tree::primitive_argument_type comparison =
+        compile_and_run(name, expected_str);
+
+    HPX_TEST_EQ(hpx::cout, result, comparison);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the symmetric positive definite system
+//    | 4  1  0  0 |       | 6  |          | 1 |
+//    | 1  3  1  0 |  x =  | 10 |   ->  x = | 2 |
+//    | 0  1  4  1 |       | 18 |          | 3 |
+//    | 0  0  1  3 |       | 15 |          | 4 |
+// is tiled by rows, the right hand side is tiled in the same way
+void test_solver_d(std::string const& solver)
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_solver_operation("test_" + solver + "_0", solver + R"((
+                annotate_d([[4.0, 1.0, 0.0, 0.0], [1.0, 3.0, 1.0, 0.0]],
+                    "a_)" + solver + R"(_0",
+                    list("tile", list("rows", 0, 2), list("columns", 0, 4))),
+                annotate_d([6.0, 10.0], "b_)" + solver + R"(_0",
+                    list("tile", list("columns", 0, 2)))
+            )
+        )", R"(
+            annotate_d([1.0, 2.0], "a_)" + solver + R"(_0/1",
+                list("tile", list("columns", 0, 2)))
+        )");
+    }
+    else
+    {
+        test_solver_operation("test_" + solver + "_0", solver + R"((
+                annotate_d([[0.0, 1.0, 4.0, 1.0], [0.0, 0.0, 1.0, 3.0]],
+                    "a_)" + solver + R"(_0",
+                    list("tile", list("rows", 2, 4), list("columns", 0, 4))),
+                annotate_d([18.0, 15.0], "b_)" + solver + R"(_0",
+                    list("tile", list("columns", 2, 4)))
+            )
+        )", R"(
+            annotate_d([3.0, 4.0], "a_)" + solver + R"(_0/1",
+                list("tile", list("columns", 2, 4)))
+        )");
+    }
+}
+
+// the right hand side is available on both localities
+void test_solver_d_full_rhs(std::string const& solver)
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_solver_operation("test_" + solver + "_1", solver + R"((
+                annotate_d([[4.0, 1.0, 0.0, 0.0], [1.0, 3.0, 1.0, 0.0]],
+                    "a_)" + solver + R"(_1",
+                    list("tile", list("rows", 0, 2), list("columns", 0, 4))),
+                [6.0, 10.0, 18.0, 15.0], 1e-12, 20
+            )
+        )", R"(
+            annotate_d([1.0, 2.0], "a_)" + solver + R"(_1/1",
+                list("tile", list("columns", 0, 2)))
+        )");
+    }
+    else
+    {
+        test_solver_operation("test_" + solver + "_1", solver + R"((
+                annotate_d([[0.0, 1.0, 4.0, 1.0], [0.0, 0.0, 1.0, 3.0]],
+                    "a_)" + solver + R"(_1",
+                    list("tile", list("rows", 2, 4), list("columns", 0, 4))),
+                [6.0, 10.0, 18.0, 15.0], 1e-12, 20
+            )
+        )", R"(
+            annotate_d([3.0, 4.0], "a_)" + solver + R"(_1/1",
+                list("tile", list("columns", 2, 4)))
+        )");
+    }
+}
+
+// GMRES with a non-symmetric matrix, restarted after every other iteration
+//    | 2  1  0  0 |       | 4  |          | 1 |
+//    | 0  3  1  0 |  x =  | 9  |   ->  x = | 2 |
+//    | 1  0  4  1 |       | 17 |          | 3 |
+//    | 0  1  0  2 |       | 10 |          | 4 |
+void test_gmres_d_restart()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_solver_operation("test_gmres_d_2", R"(
+            iterative_solver_gmres_d(
+                annotate_d([[2.0, 1.0, 0.0, 0.0], [0.0, 3.0, 1.0, 0.0]],
+                    "a_gmres_d_2",
+                    list("tile", list("rows", 0, 2), list("columns", 0, 4))),
+                [4.0, 9.0, 17.0, 10.0], 2, 1e-12, 100
+            )
+        )", R"(
+            annotate_d([1.0, 2.0], "a_gmres_d_2/1",
+                list("tile", list("columns", 0, 2)))
+        )");
+    }
+    else
+    {
+        test_solver_operation("test_gmres_d_2", R"(
+            iterative_solver_gmres_d(
+                annotate_d([[1.0, 0.0, 4.0, 1.0], [0.0, 1.0, 0.0, 2.0]],
+                    "a_gmres_d_2",
+                    list("tile", list("rows", 2, 4), list("columns", 0, 4))),
+                [4.0, 9.0, 17.0, 10.0], 2, 1e-12, 100
+            )
+        )", R"(
+            annotate_d([3.0, 4.0], "a_gmres_d_2/1",
+                list("tile", list("columns", 2, 4)))
+        )");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_solver_d("iterative_solver_conjugate_gradient_d");
+    test_solver_d("iterative_solver_cg_jacobi_d");
+    test_solver_d("iterative_solver_gmres_d");
+
+    test_solver_d_full_rhs("iterative_solver_conjugate_gradient_d");
+    test_solver_d_full_rhs("iterative_solver_cg_jacobi_d");
+
+    test_gmres_d_restart();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    hpx::init_params params;
+    params.cfg = std::move(cfg);
+    return hpx::init(argc, argv, params);
+}
@@ -0,0 +1,113 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& name, std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(name, codestr, snippets, env);
+    return code.run().arg_;
+}
+
+void test_kmeans_d_operation(std::string const& name, std::string const& code,
+    std::string const& expected_str)
+{
+    phylanx::execution_tree::primitive_argument_type result =
+        compile_and_run(name, code);
+    phylanx::execution_tree::primitive_argument_type comparison =
+        compile_and_run(name, expected_str);
+
+    HPX_TEST_EQ(hpx::cout, result, comparison);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_kmeans_d_0()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_kmeans_d_operation("test_kmeans_d_2loc_0", R"(
+            kmeans_d(annotate_d(
+                    [[0.0, 0.0], [1.0, 0.0], [10.0, 10.0], [11.0, 10.0]],
+                    "points_0",
+                    list("tile", list("columns", 0, 2), list("rows", 0, 4))),
+                [[0.0, 0.0], [11.0, 11.0]])
+        )", "[[0.5, 0.5], [10.5, 10.5]]");
+    }
+    else
+    {
+        test_kmeans_d_operation("test_kmeans_d_2loc_0", R"(
+            kmeans_d(annotate_d(
+                    [[0.0, 1.0], [1.0, 1.0], [10.0, 11.0], [11.0, 11.0]],
+                    "points_0",
+                    list("tile", list("columns", 0, 2), list("rows", 4, 8))),
+                [[0.0, 0.0], [11.0, 11.0]])
+        )", "[[0.5, 0.5], [10.5, 10.5]]");
+    }
+}
+
+// uneven tiles, three features, and one of the clusters has only points on
+// the second locality
+void test_kmeans_d_1()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_kmeans_d_operation("test_kmeans_d_2loc_1", R"(
+            kmeans_d(annotate_d(
+                    [[0.0, 0.0, 0.0], [2.0, 0.0, 0.0]],
+                    "points_1",
+                    list("tile", list("columns", 0, 3), list("rows", 0, 2))),
+                [[0.0, 0.0, 0.0], [1.0, 1.0, 1.0], [20.0, 20.0, 20.0]],
+                20, 0.0)
+        )", "[[1.0, 0.0, 0.0], [4.0, 5.0, 5.0], [20.0, 20.0, 20.5]]");
+    }
+    else
+    {
+        test_kmeans_d_operation("test_kmeans_d_2loc_1", R"(
+            kmeans_d(annotate_d(
+                    [[4.0, 5.0, 5.0], [20.0, 20.0, 20.0], [20.0, 20.0, 21.0]],
+                    "points_1",
+                    list("tile", list("columns", 0, 3), list("rows", 2, 5))),
+                [[0.0, 0.0, 0.0], [1.0, 1.0, 1.0], [20.0, 20.0, 20.0]],
+                20, 0.0)
+        )", "[[1.0, 0.0, 0.0], [4.0, 5.0, 5.0], [20.0, 20.0, 20.5]]");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_kmeans_d_0();
+    test_kmeans_d_1();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    hpx::init_params params;
+    params.cfg = std::move(cfg);
+    return hpx::init(argc, argv, params);
+}
@@ -0,0 +1,207 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& name, std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(name, codestr, snippets, env);
+    return code.run().arg_;
+}
+
+void test_sort_d_operation(std::string const& name, std::string const& code,
+    std::string const& expected_str)
+{
+    phylanx::execution_tree::primitive_argument_type result =
+        compile_and_run(name, code);
+    phylanx::execution_tree::primitive_argument_type comparison =
+        compile_and_run(name, expected_str);
+
+    HPX_TEST_EQ(hpx::cout, result, comparison);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sort_d_1d_0()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_sort_d_operation("test_sort_d_2loc1d_0", R"(
+            sort_d(annotate_d([5.0, 1.0, 4.0], "array_0",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 3)))))
+        )", R"(
+            annotate_d([0.0, 1.0, 2.0, 3.0, 4.0], "array_0/1",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 5))))
+        )");
+    }
+    else
+    {
+        test_sort_d_operation("test_sort_d_2loc1d_0", R"(
+            sort_d(annotate_d([2.0, 6.0, 3.0, 0.0], "array_0",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 3, 7)))))
+        )", R"(
+            annotate_d([5.0, 6.0], "array_0/1",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 5, 7))))
+        )");
+    }
+}
+
+void test_argsort_d_1d_0()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_sort_d_operation("test_argsort_d_2loc1d_0", R"(
+            argsort_d(annotate_d([5, 1, 4], "array_1",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 3)))))
+        )", R"(
+            annotate_d([6, 1, 3, 5, 2], "array_1/1",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 5))))
+        )");
+    }
+    else
+    {
+        test_sort_d_operation("test_argsort_d_2loc1d_0", R"(
+            argsort_d(annotate_d([2, 6, 3, 0], "array_1",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 3, 7)))))
+        )", R"(
+            annotate_d([0, 4], "array_1/1",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 5, 7))))
+        )");
+    }
+}
+
+// equal values are distributed over both localities, the order of their
+// indices is preserved
+void test_argsort_d_1d_1()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_sort_d_operation("test_argsort_d_2loc1d_1", R"(
+            argsort_d(annotate_d([1.0, 1.0, 1.0, 1.0], "array_2",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 4)))), "stable")
+        )", R"(
+            annotate_d([0, 1, 2, 3, 4, 5, 6], "array_2/1",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 7))))
+        )");
+    }
+    else
+    {
+        test_sort_d_operation("test_argsort_d_2loc1d_1", R"(
+            argsort_d(annotate_d([1.0, 1.0, 1.0, 1.0], "array_2",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 4, 8)))), "stable")
+        )", R"(
+            annotate_d([7], "array_2/1",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 7, 8))))
+        )");
+    }
+}
+
+// there are more localities than elements, locality 1 holds an empty tile
+void test_sort_d_1d_empty_tile()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_sort_d_operation("test_sort_d_2loc1d_empty", R"(
+            sort_d(annotate_d([4.0], "array_3",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 1)))))
+        )", R"(
+            annotate_d([4.0], "array_3/1",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 1))))
+        )");
+    }
+    else
+    {
+        test_sort_d_operation("test_sort_d_2loc1d_empty", R"(
+            sort_d(annotate_d([], "array_3",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 0, 0)))))
+        )", R"(
+            annotate_d([], "array_3/1",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 1, 1))))
+        )");
+    }
+}
+
+void test_sort_d_1d_local()
+{
+    // arrays that are not distributed are sorted locally
+    test_sort_d_operation("test_sort_d_1d_local", R"(
+            sort_d([3, 1, 2])
+        )", "[1, 2, 3]");
+
+    test_sort_d_operation("test_argsort_d_1d_local", R"(
+            argsort_d([3.0, 1.0, 3.0, 2.0])
+        )", "[1, 3, 0, 2]");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_sort_d_1d_0();
+    test_argsort_d_1d_0();
+    test_argsort_d_1d_1();
+    test_sort_d_1d_empty_tile();
+    test_sort_d_1d_local();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    hpx::init_params params;
+    params.cfg = std::move(cfg);
+    return hpx::init(argc, argv, params);
+}
@@ -91,6 +91,56 @@ void test_read_csv_2d_0()
     }
 }
 
+void test_read_csv_2d_1()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_read_csv_d_operation("test_read_csv_2loc2d_1", R"(
+            file_read_csv_d(
+                "test_20200713_2loc",
+                false,
+                1,
+                "column",
+                nil,
+                "test_2d_1"
+            )
+        )", R"(
+            annotate_d([[22], [17.99], [20.57], [19.69], [11.42], [20.29],
+                [12.45], [18.25], [13.71], [13], [12.46], [16.02], [15.78],
+                [19.17], [15.85], [13.73], [14.54], [14.68], [16.13], [19.81],
+                [13.54], [13.08], [9.504], [15.34], [21.16], [16.65], [17.14],
+                [14.58], [18.61], [15.3]],
+                "test_2d_1",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 1), list("rows", 0, 30))))
+        )");
+    }
+    else
+    {
+        test_read_csv_d_operation("test_read_csv_2loc2d_1", R"(
+            file_read_csv_d(
+                "test_20200713_2loc",
+                false,
+                1,
+                "column",
+                nil,
+                "test_2d_1"
+            )
+        )", R"(
+            annotate_d([[30], [10.38], [17.77], [21.25], [20.38], [14.34],
+                [15.7], [19.98], [20.83], [21.82], [24.04], [23.24], [17.89],
+                [24.8], [23.95], [22.61], [27.54], [20.13], [20.68], [22.15],
+                [14.36], [15.71], [12.44], [14.26], [23.04], [21.38], [16.4],
+                [21.53], [20.25], [25.27]],
+                "test_2d_1",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 1, 2), list("rows", 0, 30))))
+        )");
+    }
+}
+
 void test_read_csv_3d_0()
 {
     if (hpx::get_locality_id() == 0)
@@ -218,6 +268,7 @@ int hpx_main(int argc, char* argv[])
     f.get();
 
     test_read_csv_2d_0();
+    test_read_csv_2d_1();
 
     test_read_csv_3d_0();
     test_read_csv_3d_1();
@@ -0,0 +1,175 @@
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& name, std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(name, codestr, snippets, env);
+    return code.run().arg_;
+}
+
+void test_read_hdf5_d_operation(std::string const& name,
+    std::string const& code, std::string const& expected_str)
+{
+    phylanx::execution_tree::primitive_argument_type result =
+        compile_and_run(name, code);
+    phylanx::execution_tree::primitive_argument_type comparison =
+        compile_and_run(name, expected_str);
+
+    HPX_TEST_EQ(hpx::cout, result, comparison);
+}
+
+void write_hdf5(std::string const& filename, std::string const& dataset_name,
+    phylanx::ir::node_data<double>&& data)
+{
+    phylanx::execution_tree::primitive outfile =
+        phylanx::execution_tree::primitives::create_file_write_hdf5(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{
+                filename, dataset_name, std::move(data)});
+
+    outfile.eval().get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_read_hdf5_1d_0(std::string const& filename)
+{
+    std::string code = "file_read_hdf5_d(\"" + filename +
+        "\", \"vector\", \"sym\", nil, \"hdf5_vector\")";
+
+    if (hpx::get_locality_id() == 0)
+    {
+        test_read_hdf5_d_operation("test_read_hdf5_2loc1d_0", code, R"(
+            annotate_d([1, 2, 3], "hdf5_vector",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 3))))
+        )");
+    }
+    else
+    {
+        test_read_hdf5_d_operation("test_read_hdf5_2loc1d_0", code, R"(
+            annotate_d([4, 5], "hdf5_vector",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 3, 5))))
+        )");
+    }
+}
+
+void test_read_hdf5_2d_0(std::string const& filename)
+{
+    std::string code = "file_read_hdf5_d(\"" + filename +
+        "\", \"matrix\", \"sym\", nil, \"hdf5_matrix_0\")";
+
+    if (hpx::get_locality_id() == 0)
+    {
+        test_read_hdf5_d_operation("test_read_hdf5_2loc2d_0", code, R"(
+            annotate_d([[1, 2, 3, 4], [5, 6, 7, 8], [9, 10, 11, 12]],
+                "hdf5_matrix_0",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 4), list("rows", 0, 3))))
+        )");
+    }
+    else
+    {
+        test_read_hdf5_d_operation("test_read_hdf5_2loc2d_0", code, R"(
+            annotate_d([[13, 14, 15, 16], [17, 18, 19, 20], [21, 22, 23, 24]],
+                "hdf5_matrix_0",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 0, 4), list("rows", 3, 6))))
+        )");
+    }
+}
+
+void test_read_hdf5_2d_1(std::string const& filename)
+{
+    std::string code = "file_read_hdf5_d(\"" + filename +
+        "\", \"matrix\", \"column\", 1, \"hdf5_matrix_1\")";
+
+    if (hpx::get_locality_id() == 0)
+    {
+        test_read_hdf5_d_operation("test_read_hdf5_2loc2d_1", code, R"(
+            annotate_d([[1, 2, 3], [5, 6, 7], [9, 10, 11], [13, 14, 15],
+                    [17, 18, 19], [21, 22, 23]],
+                "hdf5_matrix_1",
+                list("args",
+                    list("locality", 0, 2),
+                    list("tile", list("columns", 0, 3), list("rows", 0, 6))))
+        )");
+    }
+    else
+    {
+        test_read_hdf5_d_operation("test_read_hdf5_2loc2d_1", code, R"(
+            annotate_d([[2, 3, 4], [6, 7, 8], [10, 11, 12], [14, 15, 16],
+                    [18, 19, 20], [22, 23, 24]],
+                "hdf5_matrix_1",
+                list("args",
+                    list("locality", 1, 2),
+                    list("tile", list("columns", 1, 4), list("rows", 0, 6))))
+        )");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    // each locality writes its own copy of the data to avoid concurrent
+    // writes to the same file
+    std::string suffix = std::to_string(hpx::get_locality_id());
+    std::string vector_file = "test_hdf5_vector_2loc_" + suffix;
+    std::string matrix_file = "test_hdf5_matrix_2loc_" + suffix;
+
+    write_hdf5(vector_file, "vector",
+        phylanx::ir::node_data<double>(
+            blaze::DynamicVector<double>{1, 2, 3, 4, 5}));
+    write_hdf5(matrix_file, "matrix",
+        phylanx::ir::node_data<double>(blaze::DynamicMatrix<double>{
+            {1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}, {13, 14, 15, 16},
+            {17, 18, 19, 20}, {21, 22, 23, 24}}));
+
+    test_read_hdf5_1d_0(vector_file);
+    test_read_hdf5_2d_0(matrix_file);
+    test_read_hdf5_2d_1(matrix_file);
+
+    std::remove(vector_file.c_str());
+    std::remove(matrix_file.c_str());
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    hpx::init_params params;
+    params.cfg = std::move(cfg);
+    return hpx::init(argc, argv, params);
+}
@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <fstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -85,6 +86,78 @@ void test_file_io_primitive(phylanx::ir::node_data<double> const& in)
     std::remove(filename.c_str());
 }
 
+void test_file_read_header_crlf()
+{
+    std::string filename = std::tmpnam(nullptr);
+
+    // header lines are skipped, "\r\n" line endings are accepted
+    {
+        std::ofstream outfile(filename.c_str(), std::ios::binary);
+        outfile << "1 header line\r\n"
+                << "1.5,-2,+3e2\r\n"
+                << "4,5.25,6\r\n"
+                << "7,8,9";
+    }
+
+    hpx::future<phylanx::execution_tree::primitive_argument_type> f;
+    {
+        phylanx::execution_tree::primitive infile =
+            phylanx::execution_tree::primitives::create_file_read_csv(
+                hpx::find_here(),
+                phylanx::execution_tree::primitive_arguments_type{
+                    {filename}});
+
+        f = infile.eval();
+    }
+
+    blaze::DynamicMatrix<double> expected{
+        {1.5, -2.0, 300.0}, {4.0, 5.25, 6.0}, {7.0, 8.0, 9.0}};
+
+    HPX_TEST(phylanx::ir::node_data<double>(std::move(expected)) ==
+        phylanx::execution_tree::extract_numeric_value(f.get()));
+
+    std::remove(filename.c_str());
+}
+
+void test_file_read_malformed_sign(char const* value)
+{
+    std::string filename = std::tmpnam(nullptr);
+
+    // a value with more than one leading sign is rejected
+    {
+        std::ofstream outfile(filename.c_str(), std::ios::binary);
+        outfile << "1,2,3\n"
+                << "4," << value << ",6\n";
+    }
+
+    hpx::future<phylanx::execution_tree::primitive_argument_type> f;
+    {
+        phylanx::execution_tree::primitive infile =
+            phylanx::execution_tree::primitives::create_file_read_csv(
+                hpx::find_here(),
+                phylanx::execution_tree::primitive_arguments_type{
+                    {filename}});
+
+        f = infile.eval();
+    }
+
+    bool exception_thrown = false;
+    try
+    {
+        // Must throw an exception
+        f.get();
+        HPX_TEST(false);
+    }
+    catch (std::exception const&)
+    {
+        exception_thrown = true;
+    }
+
+    HPX_TEST(exception_thrown);
+
+    std::remove(filename.c_str());
+}
+
 void test_file_io(phylanx::ir::node_data<double> const& in)
 {
     test_file_io_lit(in);
@@ -109,5 +182,9 @@ int main(int argc, char* argv[])
     blaze::DynamicMatrix<double> m = gen2.generate(101UL, 101UL);
     test_file_io(phylanx::ir::node_data<double>(std::move(m)));
 
+    test_file_read_header_crlf();
+    test_file_read_malformed_sign("+-5");
+    test_file_read_malformed_sign("++5");
+
     return hpx::util::report_errors();
 }
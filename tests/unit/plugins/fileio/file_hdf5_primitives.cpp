@@ -10,6 +10,7 @@
 #include <hpx/modules/testing.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <string>
 #include <utility>
@@ -93,6 +94,53 @@ void test_file_io(phylanx::ir::node_data<double> const& in)
     test_file_io_primitive(in);
 }
 
+void test_file_read_hyperslab()
+{
+    std::string filename = std::tmpnam(nullptr);
+    std::string dataset_name("dataset");
+
+    blaze::DynamicMatrix<double> m{
+        {1.0, 2.0, 3.0, 4.0}, {5.0, 6.0, 7.0, 8.0}, {9.0, 10.0, 11.0, 12.0}};
+
+    // write to file
+    {
+        phylanx::execution_tree::primitive outfile =
+            phylanx::execution_tree::primitives::create_file_write_hdf5(
+                hpx::find_here(),
+                phylanx::execution_tree::primitive_arguments_type{filename,
+                    dataset_name, phylanx::ir::node_data<double>(m)});
+
+        outfile.eval().get();
+    }
+
+    // read back a part of the dataset
+    hpx::future<phylanx::execution_tree::primitive_argument_type> f;
+    {
+        phylanx::execution_tree::primitive_argument_type offset{
+            phylanx::ir::range(std::vector<
+                phylanx::execution_tree::primitive_argument_type>{
+                std::int64_t(1), std::int64_t(1)})};
+        phylanx::execution_tree::primitive_argument_type count{
+            phylanx::ir::range(std::vector<
+                phylanx::execution_tree::primitive_argument_type>{
+                std::int64_t(2), std::int64_t(2)})};
+
+        phylanx::execution_tree::primitive infile =
+            phylanx::execution_tree::primitives::create_file_read_hdf5(
+                hpx::find_here(),
+                phylanx::execution_tree::primitive_arguments_type{filename,
+                    dataset_name, std::move(offset), std::move(count)});
+
+        f = infile.eval();
+    }
+
+    blaze::DynamicMatrix<double> expected = blaze::submatrix(m, 1, 1, 2, 2);
+    HPX_TEST(phylanx::ir::node_data<double>(std::move(expected)) ==
+        phylanx::execution_tree::extract_numeric_value(f.get()));
+
+    std::remove(filename.c_str());
+}
+
 int main(int argc, char* argv[])
 {
     test_file_io(phylanx::ir::node_data<double>(42.0));
@@ -110,5 +158,7 @@ int main(int argc, char* argv[])
     blaze::DynamicMatrix<double> m = gen2.generate(101UL, 102UL);
     test_file_io(phylanx::ir::node_data<double>(std::move(m)));
 
+    test_file_read_hyperslab();
+
     return hpx::util::report_errors();
 }
@@ -0,0 +1,151 @@
+//   Copyright (c) 2026 agent
+//
+//   Distributed under the Boost Software License, Version 1.0. (See accompanying
+//   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run().arg_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// write a csv file with a header line and n_rows rows of three columns each,
+// the value of each element is row * 3 + column (header lines have to start
+// with a number to be recognized as such)
+std::string write_test_file(std::size_t n_rows)
+{
+    std::string filename = std::tmpnam(nullptr);
+
+    std::ofstream outfile(filename.c_str());
+    outfile << "1,x\n";
+    for (std::size_t row = 0; row != n_rows; ++row)
+    {
+        outfile << row * 3 << ',' << row * 3 + 1 << ',' << row * 3 + 2
+                << '\n';
+    }
+
+    return filename;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_file_read_chunks_shape()
+{
+    std::string filename = write_test_file(10);
+
+    std::string const code = R"(block(
+            define(chunks, file_read_chunks(")" + filename + R"(", 3)),
+            list(len(chunks), shape(slice(chunks, 0), 0),
+                shape(slice(chunks, -1), 0), slice(chunks, -1))
+        ))";
+
+    auto result = phylanx::execution_tree::extract_list_value(
+        compile_and_run(code));
+
+    auto it = result.begin();
+    HPX_TEST_EQ(phylanx::execution_tree::extract_scalar_integer_value(*it++),
+        std::int64_t(4));
+    HPX_TEST_EQ(phylanx::execution_tree::extract_scalar_integer_value(*it++),
+        std::int64_t(3));
+    HPX_TEST_EQ(phylanx::execution_tree::extract_scalar_integer_value(*it++),
+        std::int64_t(1));
+
+    blaze::DynamicMatrix<double> expected{{27.0, 28.0, 29.0}};
+    HPX_TEST(phylanx::ir::node_data<double>(std::move(expected)) ==
+        phylanx::execution_tree::extract_numeric_value(*it));
+
+    std::remove(filename.c_str());
+}
+
+void test_file_read_chunks_fold_left()
+{
+    std::string filename = write_test_file(100);
+
+    std::string const code = R"(
+            fold_left(
+                lambda(s, chunk, s + sum(chunk)),
+                0,
+                file_read_chunks(")" + filename + R"(", 7)
+            )
+        )";
+
+    auto result = phylanx::execution_tree::extract_scalar_numeric_value(
+        compile_and_run(code));
+
+    // sum of 0 ... 299
+    HPX_TEST_EQ(result, 299.0 * 300.0 / 2.0);
+
+    std::remove(filename.c_str());
+}
+
+void test_file_read_chunks_for_each()
+{
+    std::string filename = write_test_file(20);
+
+    std::string const code = R"(block(
+            define(n, 0),
+            for_each(
+                lambda(chunk, store(n, n + shape(chunk, 0))),
+                file_read_chunks(")" + filename + R"(", 6)
+            ),
+            n
+        ))";
+
+    auto result = phylanx::execution_tree::extract_scalar_integer_value(
+        compile_and_run(code));
+
+    HPX_TEST_EQ(result, std::int64_t(20));
+
+    std::remove(filename.c_str());
+}
+
+void test_file_read_chunks_parallel_map()
+{
+    std::string filename = write_test_file(8);
+
+    std::string const code = R"(
+            parallel_map(
+                lambda(chunk, sum(chunk)),
+                file_read_chunks(")" + filename + R"(", 4)
+            )
+        )";
+
+    auto result = phylanx::execution_tree::extract_list_value(
+        compile_and_run(code));
+
+    // sums of 0 ... 11 and 12 ... 23
+    auto it = result.begin();
+    HPX_TEST_EQ(
+        phylanx::execution_tree::extract_scalar_numeric_value(*it++), 66.0);
+    HPX_TEST_EQ(
+        phylanx::execution_tree::extract_scalar_numeric_value(*it), 210.0);
+
+    std::remove(filename.c_str());
+}
+
+int main(int argc, char* argv[])
+{
+    test_file_read_chunks_shape();
+    test_file_read_chunks_fold_left();
+    test_file_read_chunks_for_each();
+    test_file_read_chunks_parallel_map();
+
+    return hpx::util::report_errors();
+}
@@ -10,9 +10,14 @@
 #include <hpx/include/lcos.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <utility>
 
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
 phylanx::execution_tree::primitive_argument_type compile_and_run(
     std::string const& codestr)
 {
@@ -31,9 +36,81 @@ void test_conv1d_operation(std::string const& code,
     HPX_TEST_EQ(compile_and_run(code), compile_and_run(expected_str));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Evaluate each output element directly from its definition
+blaze::DynamicTensor<double> conv1d_direct(
+    blaze::DynamicTensor<double> const& x,
+    blaze::DynamicTensor<double> const& k, std::size_t res_length,
+    std::int64_t pad_left, std::int64_t strides)
+{
+    auto length = static_cast<std::int64_t>(x.rows());
+
+    blaze::DynamicTensor<double> result(
+        blaze::init_from_value, 0.0, x.pages(), res_length, k.columns());
+
+    for (std::size_t l = 0; l != x.pages(); ++l)
+        for (std::size_t i = 0; i != res_length; ++i)
+            for (std::size_t o = 0; o != k.columns(); ++o)
+                for (std::size_t p = 0; p != k.pages(); ++p)
+                {
+                    std::int64_t y = i * strides - pad_left + p;
+                    if (y < 0 || y >= length)
+                    {
+                        continue;
+                    }
+                    for (std::size_t c = 0; c != x.columns(); ++c)
+                    {
+                        result(l, i, o) += x(l, y, c) * k(p, c, o);
+                    }
+                }
+
+    return result;
+}
+
+// The number of output channels is not a multiple of the number of channels
+// that are computed together
+void test_conv1d_direct(std::string const& padding, std::int64_t strides)
+{
+    blaze::DynamicTensor<double> x(4, 11, 6);
+    for (std::size_t l = 0; l != x.pages(); ++l)
+        for (std::size_t i = 0; i != x.rows(); ++i)
+            for (std::size_t c = 0; c != x.columns(); ++c)
+                x(l, i, c) = double((l * 7 + i * 5 + c * 3) % 11) - 5.0;
+
+    blaze::DynamicTensor<double> k(3, 6, 35);
+    for (std::size_t p = 0; p != k.pages(); ++p)
+        for (std::size_t c = 0; c != k.rows(); ++c)
+            for (std::size_t o = 0; o != k.columns(); ++o)
+                k(p, c, o) = double((p * 3 + c * 7 + o) % 13) - 6.0;
+
+    blaze::DynamicTensor<double> expected;
+    if (padding == "valid")
+    {
+        expected = conv1d_direct(x, k, (11 - 3) / strides + 1, 0, strides);
+    }
+    else
+    {
+        // unit strides only
+        expected = conv1d_direct(x, k, 11, 1, 1);
+    }
+
+    phylanx::execution_tree::primitive conv =
+        phylanx::execution_tree::primitives::create_conv1d_operation(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{
+                phylanx::ir::node_data<double>{x},
+                phylanx::ir::node_data<double>{k}, padding, strides});
+
+    HPX_TEST_EQ(phylanx::ir::node_data<double>{std::move(expected)},
+        phylanx::execution_tree::extract_numeric_value(conv.eval().get()));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main(int argc, char* argv[])
 {
+    test_conv1d_direct("valid", 1);
+    test_conv1d_direct("valid", 2);
+    test_conv1d_direct("same", 1);
     test_conv1d_operation("conv1d([[[1,2],[3,4],[5,6]],[[7,8],[9,10],[11,12]]],"
         "[[[2,3,-3,-2],[0,1,-1,0]],[[4,5,-4,-5],[13,1,5,33]]])",
         "[[[  66.,   24.,    3.,  115.], [ 104.,   44.,   -3.,  167.]],"
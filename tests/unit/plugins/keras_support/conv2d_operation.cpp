@@ -10,8 +10,14 @@
 #include <hpx/include/lcos.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
 
 phylanx::execution_tree::primitive_argument_type compile_and_run(
     std::string const& codestr)
@@ -31,9 +37,98 @@ void test_conv2d_operation(std::string const& code,
     HPX_TEST_EQ(compile_and_run(code), compile_and_run(expected_str));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Evaluate each output element directly from its definition
+blaze::DynamicArray<4UL, double> conv2d_direct(
+    blaze::DynamicArray<4UL, double> const& x,
+    blaze::DynamicArray<4UL, double> const& k, std::size_t res_height,
+    std::size_t res_width, std::int64_t pad_top, std::int64_t pad_left,
+    std::int64_t stride_height, std::int64_t stride_width)
+{
+    auto in_height = static_cast<std::int64_t>(x.pages());
+    auto in_width = static_cast<std::int64_t>(x.rows());
+
+    blaze::DynamicArray<4UL, double> result(blaze::init_from_value, 0.0,
+        x.quats(), res_height, res_width, k.columns());
+
+    for (std::size_t l = 0; l != x.quats(); ++l)
+        for (std::size_t i = 0; i != res_height; ++i)
+            for (std::size_t j = 0; j != res_width; ++j)
+                for (std::size_t o = 0; o != k.columns(); ++o)
+                    for (std::size_t p = 0; p != k.quats(); ++p)
+                        for (std::size_t q = 0; q != k.pages(); ++q)
+                        {
+                            std::int64_t y = i * stride_height - pad_top + p;
+                            std::int64_t z = j * stride_width - pad_left + q;
+                            if (y < 0 || y >= in_height || z < 0 ||
+                                z >= in_width)
+                            {
+                                continue;
+                            }
+                            for (std::size_t c = 0; c != x.columns(); ++c)
+                            {
+                                result(l, i, j, o) +=
+                                    x(l, y, z, c) * k(p, q, c, o);
+                            }
+                        }
+
+    return result;
+}
+
+// The number of output channels is not a multiple of the number of channels
+// that are computed together
+void test_conv2d_direct(std::string const& padding,
+    std::int64_t stride_height, std::int64_t stride_width)
+{
+    blaze::DynamicArray<4UL, double> x(3, 9, 8, 5);
+    for (std::size_t l = 0; l != x.quats(); ++l)
+        for (std::size_t i = 0; i != x.pages(); ++i)
+            for (std::size_t j = 0; j != x.rows(); ++j)
+                for (std::size_t c = 0; c != x.columns(); ++c)
+                    x(l, i, j, c) =
+                        double((l * 7 + i * 5 + j * 3 + c * 2) % 11) - 5.0;
+
+    blaze::DynamicArray<4UL, double> k(3, 3, 5, 37);
+    for (std::size_t p = 0; p != k.quats(); ++p)
+        for (std::size_t q = 0; q != k.pages(); ++q)
+            for (std::size_t c = 0; c != k.rows(); ++c)
+                for (std::size_t o = 0; o != k.columns(); ++o)
+                    k(p, q, c, o) =
+                        double((p * 3 + q * 5 + c * 7 + o) % 13) - 6.0;
+
+    blaze::DynamicArray<4UL, double> expected;
+    if (padding == "valid")
+    {
+        expected = conv2d_direct(x, k, (9 - 3) / stride_height + 1,
+            (8 - 3) / stride_width + 1, 0, 0, stride_height, stride_width);
+    }
+    else
+    {
+        // unit strides only
+        expected = conv2d_direct(x, k, 9, 8, 1, 1, 1, 1);
+    }
+
+    phylanx::execution_tree::primitive conv =
+        phylanx::execution_tree::primitives::create_conv2d_operation(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{
+                phylanx::ir::node_data<double>{x},
+                phylanx::ir::node_data<double>{k}, padding,
+                phylanx::ir::range(std::vector<
+                    phylanx::execution_tree::primitive_argument_type>{
+                    stride_height, stride_width})});
+
+    HPX_TEST_EQ(phylanx::ir::node_data<double>{std::move(expected)},
+        phylanx::execution_tree::extract_numeric_value(conv.eval().get()));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main(int argc, char* argv[])
 {
+    test_conv2d_direct("valid", 1, 1);
+    test_conv2d_direct("valid", 2, 3);
+    test_conv2d_direct("same", 1, 1);
+
     test_conv2d_operation("conv2d([[[[ 1,  2],[ 3,  4]],[[ 5,  6],[ 7,  8]],"
                           "[[ 9, 10],[11, 12]]],[[[13, 14],[15, 16]],"
                           "[[17, 18],[19, 20]],[[21, 22],[23, 24]]]],"
@@ -747,6 +747,74 @@ void test_dot_operation(std::string const& code,
 }
 
 ///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type dot_sparse(
+    phylanx::ir::node_data<double>&& lhs, phylanx::ir::node_data<double>&& rhs)
+{
+    phylanx::execution_tree::primitive lhs_var =
+        phylanx::execution_tree::primitives::create_variable(
+            hpx::find_here(), std::move(lhs));
+
+    phylanx::execution_tree::primitive rhs_var =
+        phylanx::execution_tree::primitives::create_variable(
+            hpx::find_here(), std::move(rhs));
+
+    phylanx::execution_tree::primitive dot =
+        phylanx::execution_tree::primitives::create_dot_operation(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{
+                std::move(lhs_var), std::move(rhs_var)});
+
+    return dot.eval().get();
+}
+
+void test_dot_operation_sparse()
+{
+    blaze::CompressedMatrix<double> s1(3UL, 4UL);
+    s1(0, 1) = 2.0;
+    s1(1, 3) = -1.0;
+    s1(2, 0) = 4.0;
+
+    blaze::CompressedMatrix<double> s2(4UL, 2UL);
+    s2(1, 0) = 3.0;
+    s2(3, 1) = 5.0;
+
+    blaze::DynamicMatrix<double> d2(s2);
+    blaze::DynamicVector<double> v{1.0, 2.0, 3.0, 4.0};
+
+    // sparse x sparse stays sparse
+    auto result = phylanx::execution_tree::extract_sparse_numeric_value(
+        dot_sparse(phylanx::ir::node_data<double>{s1},
+            phylanx::ir::node_data<double>{s2}));
+    HPX_TEST(result.is_sparse());
+    HPX_TEST(result.dense().matrix() ==
+        blaze::DynamicMatrix<double>(blaze::DynamicMatrix<double>(s1) * d2));
+
+    // sparse x dense is dense
+    result = phylanx::execution_tree::extract_sparse_numeric_value(
+        dot_sparse(phylanx::ir::node_data<double>{s1},
+            phylanx::ir::node_data<double>{d2}));
+    HPX_TEST(!result.is_sparse());
+    HPX_TEST(result.matrix() ==
+        blaze::DynamicMatrix<double>(blaze::DynamicMatrix<double>(s1) * d2));
+
+    result = phylanx::execution_tree::extract_sparse_numeric_value(
+        dot_sparse(phylanx::ir::node_data<double>{s1},
+            phylanx::ir::node_data<double>{v}));
+    HPX_TEST(!result.is_sparse());
+    HPX_TEST_EQ(result,
+        phylanx::ir::node_data<double>(blaze::DynamicVector<double>{
+            4.0, -4.0, 4.0}));
+
+    // scaling keeps the data sparse
+    result = phylanx::execution_tree::extract_sparse_numeric_value(
+        dot_sparse(phylanx::ir::node_data<double>{2.0},
+            phylanx::ir::node_data<double>{s2}));
+    HPX_TEST(result.is_sparse());
+    HPX_TEST(result.dense().matrix() ==
+        blaze::DynamicMatrix<double>(2.0 * d2));
+}
+
 int main(int argc, char* argv[])
 {
     // outer product
@@ -999,6 +1067,8 @@ int main(int argc, char* argv[])
         "[[[ 14,  10],[ 32,  28]],[[  4,   4],[ 38, 118]],"
         "[[ 14,  14],[-14, -14]],[[ 20,  20],[ 34,  34]]]");
 
+    test_dot_operation_sparse();
+
     return hpx::util::report_errors();
 }
 
@@ -4,6 +4,7 @@
 //   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/phylanx.hpp>
+#include <phylanx/util/random.hpp>
 
 #include <hpx/hpx_main.hpp>
 #include <hpx/modules/testing.hpp>
@@ -55,27 +56,47 @@ void set_seed(std::uint32_t seed)
     call(static_cast<std::int64_t>(seed));
 }
 ///////////////////////////////////////////////////////////////////////////////
+// Every invocation of random uses the next stream of the counter based
+// generator, element i of the result is drawn from a generator positioned at i
+struct reference_generator
+{
+    explicit reference_generator(std::uint32_t seed)
+      : stream_{seed, 0}
+    {
+    }
+
+    phylanx::util::random_stream next_stream()
+    {
+        phylanx::util::random_stream result = stream_;
+        ++stream_.stream_;
+        return result;
+    }
+
+    phylanx::util::random_stream stream_;
+};
+
 // generate single random double value
-template <typename T, typename Gen, typename Dist>
+template <typename T, typename Dist>
 void generate_0d(phylanx::execution_tree::compiler::function const& call,
-    Gen& gen, Dist& dist)
+    reference_generator& gen, Dist& dist)
 {
     phylanx::execution_tree::primitive_arguments_type dims = {
         phylanx::execution_tree::primitive_argument_type{std::int64_t{0}}
     };
 
     auto result = call(dims);
+    auto stream = gen.next_stream();
 
     HPX_TEST_EQ(
-        static_cast<T>(dist(gen)),
+        static_cast<T>(phylanx::util::random_element(dist, stream, 0)),
         static_cast<T>(
             phylanx::execution_tree::extract_node_data<T>(result)[0]));
 }
 
 // generate a random double vector
-template <typename T, typename Gen, typename Dist>
+template <typename T, typename Dist>
 void generate_1d(phylanx::execution_tree::compiler::function const& call,
-    Gen& gen, Dist& dist)
+    reference_generator& gen, Dist& dist)
 {
     phylanx::execution_tree::primitive_arguments_type dims = {
         phylanx::execution_tree::primitive_argument_type{std::int64_t{32}},
@@ -83,11 +104,13 @@ void generate_1d(phylanx::execution_tree::compiler::function const& call,
     };
 
     auto result = call(dims);
+    auto stream = gen.next_stream();
 
     blaze::DynamicVector<T> v(32);
+    std::size_t index = 0;
     for (auto& val : v)
     {
-        val = dist(gen);
+        val = phylanx::util::random_element(dist, stream, index++);
     }
 
     HPX_TEST_EQ(phylanx::ir::node_data<T>(std::move(v)),
@@ -95,9 +118,9 @@ void generate_1d(phylanx::execution_tree::compiler::function const& call,
 }
 
 // generate a random double matrix
-template <typename T, typename Gen, typename Dist>
+template <typename T, typename Dist>
 void generate_2d(phylanx::execution_tree::compiler::function const& call,
-    Gen& gen, Dist& dist)
+    reference_generator& gen, Dist& dist)
 {
     phylanx::execution_tree::primitive_arguments_type dims = {
         phylanx::execution_tree::primitive_argument_type{std::int64_t{32}},
@@ -105,13 +128,15 @@ void generate_2d(phylanx::execution_tree::compiler::function const& call,
     };
 
     auto result = call(dims);
+    auto stream = gen.next_stream();
 
     blaze::DynamicMatrix<T> m(32, 16);
+    std::size_t index = 0;
     for (std::size_t row = 0; row != blaze::rows(m); ++row)
     {
         for (auto& val : blaze::row(m, row))
         {
-            val = dist(gen);
+            val = phylanx::util::random_element(dist, stream, index++);
         }
     }
 
@@ -120,9 +145,9 @@ void generate_2d(phylanx::execution_tree::compiler::function const& call,
 }
 
 // generate a random double tensor
-template <typename T, typename Gen, typename Dist>
+template <typename T, typename Dist>
 void generate_3d(phylanx::execution_tree::compiler::function const& call,
-    Gen& gen, Dist& dist)
+    reference_generator& gen, Dist& dist)
 {
     phylanx::execution_tree::primitive_arguments_type dims = {
         phylanx::execution_tree::primitive_argument_type{std::int64_t{3}},
@@ -131,15 +156,17 @@ void generate_3d(phylanx::execution_tree::compiler::function const& call,
     };
 
     auto result = call(dims);
+    auto stream = gen.next_stream();
 
     blaze::DynamicTensor<T> t(3, 32, 16);
+    std::size_t index = 0;
     for (std::size_t page = 0; page != blaze::pages(t); ++page)
     {
         for (std::size_t row = 0; row != blaze::rows(t); ++row)
         {
             for (auto& val : blaze::row(blaze::pageslice(t, page), row))
             {
-                val = dist(gen);
+                val = phylanx::util::random_element(dist, stream, index++);
             }
         }
     }
@@ -149,9 +176,9 @@ void generate_3d(phylanx::execution_tree::compiler::function const& call,
 }
 
 // generate a random double 4d array
-template <typename T, typename Gen, typename Dist>
+template <typename T, typename Dist>
 void generate_4d(phylanx::execution_tree::compiler::function const& call,
-    Gen& gen, Dist& dist)
+    reference_generator& gen, Dist& dist)
 {
     phylanx::execution_tree::primitive_arguments_type dims = {
         phylanx::execution_tree::primitive_argument_type{std::int64_t{3}},
@@ -161,8 +188,10 @@ void generate_4d(phylanx::execution_tree::compiler::function const& call,
     };
 
     auto result = call(dims);
+    auto stream = gen.next_stream();
 
     blaze::DynamicArray<4UL, T> q(3UL, 32UL, 16UL, 13UL);
+    std::size_t index = 0;
     for (std::size_t quat = 0; quat != blaze::quats(q); ++quat)
     {
         for (std::size_t page = 0; page != blaze::pages(q); ++page)
@@ -173,7 +202,7 @@ void generate_4d(phylanx::execution_tree::compiler::function const& call,
                     blaze::row(
                         blaze::pageslice(blaze::quatslice(q, quat), page), row))
                 {
-                    val = dist(gen);
+                    val = phylanx::util::random_element(dist, stream, index++);
                 }
             }
         }
@@ -184,7 +213,7 @@ void generate_4d(phylanx::execution_tree::compiler::function const& call,
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_normal_distribution_implicit(std::mt19937& gen)
+void test_normal_distribution_implicit(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size)),
@@ -215,7 +244,7 @@ void test_normal_distribution_implicit(std::mt19937& gen)
     }
 }
 
-void test_uniform_distribution_explicit(std::mt19937& gen)
+void test_uniform_distribution_explicit(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "uniform")),
@@ -246,7 +275,7 @@ void test_uniform_distribution_explicit(std::mt19937& gen)
     }
 }
 
-void test_uniform_distribution_explicit_params(std::mt19937& gen)
+void test_uniform_distribution_explicit_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("uniform", 2.0, 4.0))),
@@ -278,7 +307,7 @@ void test_uniform_distribution_explicit_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_uniform_int_distribution_explicit(std::mt19937& gen)
+void test_uniform_int_distribution_explicit(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "uniform_int", __arg(dtype, "int"))),
@@ -309,7 +338,7 @@ void test_uniform_int_distribution_explicit(std::mt19937& gen)
     }
 }
 
-void test_uniform_int_distribution_explicit_params(std::mt19937& gen)
+void test_uniform_int_distribution_explicit_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size,
@@ -343,7 +372,7 @@ void test_uniform_int_distribution_explicit_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_bernoulli_distribution(std::mt19937& gen)
+void test_bernoulli_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "bernoulli", __arg(dtype, "bool"))),
@@ -374,7 +403,7 @@ void test_bernoulli_distribution(std::mt19937& gen)
     }
 }
 
-void test_bernoulli_distribution_params(std::mt19937& gen)
+void test_bernoulli_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size,
@@ -408,7 +437,7 @@ void test_bernoulli_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_binomial_distribution(std::mt19937& gen)
+void test_binomial_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("binomial", 1.0, 0.5))),
@@ -439,7 +468,7 @@ void test_binomial_distribution(std::mt19937& gen)
     }
 }
 
-void test_binomial_distribution_params(std::mt19937& gen)
+void test_binomial_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("binomial", 10, 0.8))),
@@ -471,7 +500,7 @@ void test_binomial_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_negative_binomial_distribution(std::mt19937& gen)
+void test_negative_binomial_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("negative_binomial", 1.0, 0.5))),
@@ -502,7 +531,7 @@ void test_negative_binomial_distribution(std::mt19937& gen)
     }
 }
 
-void test_negative_binomial_distribution_params(std::mt19937& gen)
+void test_negative_binomial_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("negative_binomial", 10, 0.8))),
@@ -534,7 +563,7 @@ void test_negative_binomial_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_geometric_distribution(std::mt19937& gen)
+void test_geometric_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("geometric", 0.5))),
@@ -565,7 +594,7 @@ void test_geometric_distribution(std::mt19937& gen)
     }
 }
 
-void test_geometric_distribution_params(std::mt19937& gen)
+void test_geometric_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("geometric", 0.8))),
@@ -597,7 +626,7 @@ void test_geometric_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_poisson_distribution(std::mt19937& gen)
+void test_poisson_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("poisson", 1.0))),
@@ -628,7 +657,7 @@ void test_poisson_distribution(std::mt19937& gen)
     }
 }
 
-void test_poisson_distribution_params(std::mt19937& gen)
+void test_poisson_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("poisson", 4))),
@@ -660,7 +689,7 @@ void test_poisson_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_exponential_distribution(std::mt19937& gen)
+void test_exponential_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("exponential", 1.0))),
@@ -691,7 +720,7 @@ void test_exponential_distribution(std::mt19937& gen)
     }
 }
 
-void test_exponential_distribution_params(std::mt19937& gen)
+void test_exponential_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("exponential", 2.0))),
@@ -723,7 +752,7 @@ void test_exponential_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_gamma_distribution(std::mt19937& gen)
+void test_gamma_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("gamma", 1.0))),
@@ -754,7 +783,7 @@ void test_gamma_distribution(std::mt19937& gen)
     }
 }
 
-void test_gamma_distribution_params(std::mt19937& gen)
+void test_gamma_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("gamma", 0.8, 1.2))),
@@ -786,7 +815,7 @@ void test_gamma_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_weibull_distribution(std::mt19937& gen)
+void test_weibull_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("weibull", 1.0))),
@@ -817,7 +846,7 @@ void test_weibull_distribution(std::mt19937& gen)
     }
 }
 
-void test_weibull_distribution_params(std::mt19937& gen)
+void test_weibull_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("weibull", 0.8, 1.2))),
@@ -849,7 +878,7 @@ void test_weibull_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_extreme_value_distribution(std::mt19937& gen)
+void test_extreme_value_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "extreme_value")),
@@ -880,7 +909,7 @@ void test_extreme_value_distribution(std::mt19937& gen)
     }
 }
 
-void test_extreme_value_distribution_params(std::mt19937& gen)
+void test_extreme_value_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("extreme_value", 0.8, 1.2))),
@@ -912,7 +941,7 @@ void test_extreme_value_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_normal_distribution(std::mt19937& gen)
+void test_normal_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "normal")),
@@ -943,7 +972,7 @@ void test_normal_distribution(std::mt19937& gen)
     }
 }
 
-void test_normal_distribution_params(std::mt19937& gen)
+void test_normal_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("normal", 0.8, 1.2))),
@@ -975,7 +1004,7 @@ void test_normal_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_truncated_normal_distribution(std::mt19937& gen)
+void test_truncated_normal_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "truncated_normal")),
@@ -1006,7 +1035,7 @@ void test_truncated_normal_distribution(std::mt19937& gen)
     }
 }
 
-void test_truncated_normal_distribution_params(std::mt19937& gen)
+void test_truncated_normal_distribution_params(reference_generator& gen)
 {
     using namespace phylanx::execution_tree::primitives;
 
@@ -1042,7 +1071,7 @@ void test_truncated_normal_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_lognormal_distribution(std::mt19937& gen)
+void test_lognormal_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "lognormal")),
@@ -1073,7 +1102,7 @@ void test_lognormal_distribution(std::mt19937& gen)
     }
 }
 
-void test_lognormal_distribution_params(std::mt19937& gen)
+void test_lognormal_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("lognormal", 0.8, 1.2))),
@@ -1105,7 +1134,7 @@ void test_lognormal_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_chi_squared_distribution(std::mt19937& gen)
+void test_chi_squared_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("chi_squared", 1.0))),
@@ -1136,7 +1165,7 @@ void test_chi_squared_distribution(std::mt19937& gen)
     }
 }
 
-void test_chi_squared_distribution_params(std::mt19937& gen)
+void test_chi_squared_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("chi_squared", 0.8))),
@@ -1168,7 +1197,7 @@ void test_chi_squared_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_cauchy_distribution(std::mt19937& gen)
+void test_cauchy_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "cauchy")),
@@ -1199,7 +1228,7 @@ void test_cauchy_distribution(std::mt19937& gen)
     }
 }
 
-void test_cauchy_distribution_params(std::mt19937& gen)
+void test_cauchy_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("cauchy", 0.6, 0.8))),
@@ -1231,7 +1260,7 @@ void test_cauchy_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_fisher_f_distribution(std::mt19937& gen)
+void test_fisher_f_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("fisher_f", 1.0))),
@@ -1262,7 +1291,7 @@ void test_fisher_f_distribution(std::mt19937& gen)
     }
 }
 
-void test_fisher_f_distribution_params(std::mt19937& gen)
+void test_fisher_f_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("fisher_f", 0.6, 0.8))),
@@ -1294,7 +1323,7 @@ void test_fisher_f_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_student_t_distribution(std::mt19937& gen)
+void test_student_t_distribution(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("student_t", 1.0))),
@@ -1325,7 +1354,7 @@ void test_student_t_distribution(std::mt19937& gen)
     }
 }
 
-void test_student_t_distribution_params(std::mt19937& gen)
+void test_student_t_distribution_params(reference_generator& gen)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("student_t", 0.8))),
@@ -1364,7 +1393,7 @@ int main(int argc, char* argv[])
     set_seed(seed);
     HPX_TEST_EQ(get_seed(), seed);
 
-    std::mt19937 gen(seed);
+    reference_generator gen(seed);
 
     test_normal_distribution_implicit(gen);
 
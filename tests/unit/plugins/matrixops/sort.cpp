@@ -92,5 +92,15 @@ int main(int argc, char* argv[])
         "[-24., -14., -8., 1., 1., 2., 3., 4., 5., 6., 7., 9., 12., 12., 14., "
         "15., 16., 17., 19., 22.]");
 
+    // large arrays are sorted in parallel
+    test_sort("sort(arange(200000, 0, -1), 0, \"quicksort\")",
+        "arange(1, 200001)");
+    test_sort("sort(arange(200000, 0, -1), 0, \"stable\")",
+        "arange(1, 200001)");
+    test_sort("sort(reshape(arange(400000, 0, -1), list(2, 200000)), 1, "
+              "\"mergesort\")",
+        "reshape(hstack(list(arange(200001, 400001), arange(1, 200001))), "
+        "list(2, 200000))");
+
     return hpx::util::report_errors();
 }
@@ -0,0 +1,49 @@
+#  Copyright (c) 2026 agent
+#
+#  Distributed under the Boost Software License, Version 1.0. (See accompanying
+#  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+import phylanx
+from phylanx import Phylanx, PhylanxSession
+import numpy as np
+
+PhylanxSession.init(4)
+
+et = phylanx.execution_tree
+cs = et.compiler_state('global', __name__)
+
+fibs = et.eval_batch(cs, """
+block(
+    define(fib,n,
+    if(n<2,n,
+        fib(n-1)+fib(n-2))),
+    fib)""", [(n,) for n in range(12)])
+
+assert fibs == [0, 1, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89], fibs
+
+
+@Phylanx
+def score(x, w):
+    return np.dot(x, w)
+
+
+w = np.array([1.0, 2.0, 3.0])
+inputs = [np.array([1.0, 0.0, 0.0]) * i for i in range(10)]
+
+results = score.batch([(x, w) for x in inputs])
+assert len(results) == 10
+for x, r in zip(inputs, results):
+    assert r == np.dot(x, w), (r, np.dot(x, w))
+
+
+@Phylanx
+def row_sum(x):
+    return np.sum(x)
+
+
+# the rows of a stacked array are the arguments of the invocations
+stacked = np.arange(12.0).reshape((4, 3))
+results = row_sum.batch(stacked)
+assert np.all(np.array(results) == np.sum(stacked, axis=1)), results
+
+assert row_sum.batch([]) == []
@@ -30,3 +30,23 @@ for dim in range(max_num_dimensions):
         test_argsort(arr[dim], axis)
     # test flatten
     test_argsort(arr[dim], None)
+
+
+@Phylanx
+def physl_argsort_kind(arr, axis, kind):
+    return argsort(arr, axis, kind) # noqa
+
+
+# large arrays with many duplicates are sorted in parallel, 'stable' has to
+# preserve the order of equal elements
+large = np.random.randint(0, 100, size=200000)
+assert (physl_argsort_kind(large, 0, "stable") ==
+        np.argsort(large, kind="stable")).all()
+assert (physl_argsort_kind(large, 0, "mergesort") ==
+        np.argsort(large, kind="stable")).all()
+assert (large[physl_argsort_kind(large, 0, "quicksort")] ==
+        np.sort(large)).all()
+
+large2d = np.random.randint(0, 10, size=(4, 100000))
+assert (physl_argsort_kind(large2d, 1, "stable") ==
+        np.argsort(large2d, axis=1, kind="stable")).all()
@@ -9,6 +9,7 @@
 #include <hpx/hpx_main.hpp>
 #include <hpx/include/agas.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
 
 #include <cstddef>
 #include <map>
@@ -90,6 +91,10 @@ const std::vector<std::string> performance_counter_name_last_part{
 
 int main()
 {
+    // the counts below refer to the primitives of the loop, don't run it
+    // using the scalar loop interpreter
+    hpx::set_config_entry("phylanx.scalar_loops", "0");
+
     // Compile the given code
     phylanx::execution_tree::compiler::function_list snippets;
 
@@ -0,0 +1,118 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/random.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// known answers of Philox4x32-10 as published with Random123
+void test_philox_known_answers()
+{
+    using phylanx::util::philox_engine;
+
+    std::array<std::uint32_t, 4> r0 =
+        philox_engine::generate({0, 0, 0, 0}, {0, 0});
+    HPX_TEST_EQ(r0[0], 0x6627e8d5u);
+    HPX_TEST_EQ(r0[1], 0xe169c58du);
+    HPX_TEST_EQ(r0[2], 0xbc57ac4cu);
+    HPX_TEST_EQ(r0[3], 0x9b00dbd8u);
+
+    std::array<std::uint32_t, 4> r1 = philox_engine::generate(
+        {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+        {0xffffffff, 0xffffffff});
+    HPX_TEST_EQ(r1[0], 0x408f276du);
+    HPX_TEST_EQ(r1[1], 0x41c83b0eu);
+    HPX_TEST_EQ(r1[2], 0xa20bc7c6u);
+    HPX_TEST_EQ(r1[3], 0x6d5451fdu);
+
+    std::array<std::uint32_t, 4> r2 = philox_engine::generate(
+        {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+        {0xa4093822, 0x299f31d0});
+    HPX_TEST_EQ(r2[0], 0xd16cfe09u);
+    HPX_TEST_EQ(r2[1], 0x94fdccebu);
+    HPX_TEST_EQ(r2[2], 0x5001e420u);
+    HPX_TEST_EQ(r2[3], 0x24126ea1u);
+}
+
+// the engine continues with the next block once the current one is used up
+void test_philox_engine_blocks()
+{
+    phylanx::util::philox_engine engine(42, 7, 3);
+
+    std::array<std::uint32_t, 4> block0 =
+        phylanx::util::philox_engine::generate({3, 0, 0, 0}, {42, 7});
+    std::array<std::uint32_t, 4> block1 =
+        phylanx::util::philox_engine::generate({3, 0, 1, 0}, {42, 7});
+
+    for (std::size_t i = 0; i != 4; ++i)
+    {
+        HPX_TEST_EQ(engine(), block0[i]);
+    }
+    for (std::size_t i = 0; i != 4; ++i)
+    {
+        HPX_TEST_EQ(engine(), block1[i]);
+    }
+}
+
+// elements do not depend on the order they are generated in
+void test_random_element()
+{
+    phylanx::util::random_stream stream{12345, 2};
+    std::normal_distribution<double> dist(1.0, 2.0);
+
+    std::vector<double> forward(100);
+    for (std::size_t i = 0; i != forward.size(); ++i)
+    {
+        forward[i] = phylanx::util::random_element(dist, stream, i);
+    }
+
+    for (std::size_t i = forward.size(); i != 0; --i)
+    {
+        HPX_TEST_EQ(
+            phylanx::util::random_element(dist, stream, i - 1), forward[i - 1]);
+    }
+
+    // different streams yield different sequences
+    phylanx::util::random_stream other{12345, 3};
+    HPX_TEST_NEQ(phylanx::util::random_element(dist, other, 0), forward[0]);
+}
+
+// elements filled concurrently match the ones generated sequentially
+void test_random_for_each()
+{
+    phylanx::util::random_stream stream{12345, 4};
+    std::normal_distribution<double> dist(1.0, 2.0);
+
+    std::vector<double> values(
+        phylanx::util::random_min_parallel_size + 1001);
+    phylanx::util::random_for_each(values.size(), dist,
+        [&](std::normal_distribution<double>& d, std::size_t i) {
+            values[i] = phylanx::util::random_element(d, stream, i);
+        });
+
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        HPX_TEST_EQ(
+            phylanx::util::random_element(dist, stream, i), values[i]);
+    }
+}
+
+int main()
+{
+    test_philox_known_answers();
+    test_philox_engine_blocks();
+    test_random_element();
+    test_random_for_each();
+
+    return hpx::util::report_errors();
+}